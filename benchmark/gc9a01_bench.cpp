@@ -0,0 +1,190 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_bench.cpp
+ * @brief Benchmarks of the public drawing API, shared by the target and the host build
+ */
+
+#include <cstdio>
+
+#include "gc9a01_bench.h"
+
+using Error = GC9A01::Error;
+
+GC9A01CountingTransport::GC9A01CountingTransport(GC9A01::Transport& bus) :
+    bus_(bus)
+{
+}
+
+/**
+ * @brief Count a transfer of `size` bytes if it was queued
+ */
+Error GC9A01CountingTransport::counted(const Error err, const u32 size) {
+    if (err == GC9A01::OK) {
+        bytes_ += size;
+        transactions_++;
+    }
+    return err;
+}
+
+Error GC9A01CountingTransport::begin() {
+    return bus_.begin();
+}
+
+Error GC9A01CountingTransport::cmd(const u8 command) {
+    return counted(bus_.cmd(command), 1);
+}
+
+Error GC9A01CountingTransport::data(const u8* data, const u32 size) {
+    return counted(bus_.data(data, size), size);
+}
+
+Error GC9A01CountingTransport::queue_data(const u8* data, const u32 size) {
+    return counted(bus_.queue_data(data, size), size);
+}
+
+Error GC9A01CountingTransport::collect(const TickType_t timeout) {
+    const i64 start = esp_timer_get_time();
+    const Error err = bus_.collect(timeout);
+    blocked_us_ += esp_timer_get_time() - start;
+    return err;
+}
+
+void GC9A01CountingTransport::set_reset(const bool level) {
+    bus_.set_reset(level);
+}
+
+bool GC9A01CountingTransport::has_reset() const {
+    return bus_.has_reset();
+}
+
+bool GC9A01CountingTransport::can_send_from(const void* data) const {
+    return bus_.can_send_from(data);
+}
+
+u32 GC9A01CountingTransport::max_transfer() const {
+    return bus_.max_transfer();
+}
+
+bool GC9A01CountingTransport::has_tear() const {
+    return bus_.has_tear();
+}
+
+Error GC9A01CountingTransport::wait_tear(const TickType_t timeout) {
+    return bus_.wait_tear(timeout);
+}
+
+void GC9A01CountingTransport::reset_counters() {
+    bytes_ = 0;
+    transactions_ = 0;
+    blocked_us_ = 0;
+}
+
+u64 GC9A01CountingTransport::bytes() const {
+    return bytes_;
+}
+
+u32 GC9A01CountingTransport::transactions() const {
+    return transactions_;
+}
+
+i64 GC9A01CountingTransport::blocked_us() const {
+    return blocked_us_;
+}
+
+// Source for the bitmap cases, one full screen
+static u16 bench_bitmap[GC9A01_PIXELS];
+
+struct BenchCase {
+    const char* name;
+    // One operation, `i` is the iteration to vary coordinates
+    Error (*run)(GC9A01& display, u32 i);
+    // Repeat at most this often, 0 for `GC9A01BenchConfig::max_iterations`
+    u32 max_iterations;
+};
+
+static const BenchCase bench_cases[] = {
+    {"init", [](GC9A01& d, u32) { return d.init(); }, 1},
+    {"fill", [](GC9A01& d, u32 i) { return d.fill(Color(i, 0x80, 0x40)); }, 0},
+    {"clear", [](GC9A01& d, u32) { return d.clear(); }, 0},
+#ifdef CONFIG_GC9A01_ROUND_MASK
+    {"fill_unmasked", [](GC9A01& d, u32 i) {
+        d.set_round_mask(false);
+        const Error err = d.fill(Color(i, 0x80, 0x40));
+        d.set_round_mask(true);
+        return err;
+    }, 0},
+#endif
+    {"fill_rect_8", [](GC9A01& d, u32 i) { return d.fill_rect(60 + i % 112, 60 + i % 104, 8, 8, Color(i, 0, 0)); }, 0},
+    {"fill_rect_32", [](GC9A01& d, u32 i) { return d.fill_rect(60 + i % 88, 60 + i % 80, 32, 32, Color(i, 0, 0)); }, 0},
+    {"fill_rect_120", [](GC9A01& d, u32 i) { return d.fill_rect(60, 60, 120, 120, Color(i, 0, 0)); }, 0},
+    {"fill_rect_240", [](GC9A01& d, u32 i) { return d.fill_rect(0, 0, 240, 240, Color(i, 0, 0)); }, 0},
+    {"draw_bitmap_32", [](GC9A01& d, u32 i) { return d.draw_bitmap(60 + i % 88, 60 + i % 80, 32, 32, bench_bitmap); }, 0},
+    {"draw_bitmap_240", [](GC9A01& d, u32) { return d.draw_bitmap(0, 0, 240, 240, bench_bitmap); }, 0},
+    {"set_pixel", [](GC9A01& d, u32 i) { return d.set_pixel(40 + i % 160, 40 + (i / 160) % 160, Color(i, i, i)); }, 0},
+    {"draw_hline", [](GC9A01& d, u32 i) { return d.draw_hline(70, 20 + i % 200, 100, Color(i, 0, 0)); }, 0},
+    {"draw_vline", [](GC9A01& d, u32 i) { return d.draw_vline(20 + i % 200, 70, 100, Color(i, 0, 0)); }, 0},
+    {"draw_rect", [](GC9A01& d, u32 i) { return d.draw_rect(70, 80, 100, 80, Color(i, 0, 0)); }, 0},
+    {"draw_circle", [](GC9A01& d, u32 i) { return d.draw_circle(120, 120, 100, Color(i, 0, 0)); }, 0},
+};
+
+/**
+ * Measured wall and CPU time are per operation; on the host (`real_bus == false`)
+ * the operation time is the CPU time plus the bus time estimated from the bytes
+ * and transactions, on hardware it is the wall time.
+ */
+GC9A01::Error gc9a01_bench_run(GC9A01& display, GC9A01CountingTransport& counter, const GC9A01BenchConfig& config) {
+    for (u32 i = 0; i < GC9A01_PIXELS; i++) {
+        bench_bitmap[i] = static_cast<u16>(i * 2654435761u >> 16);
+    }
+
+    if (config.format == BENCH_CSV) {
+        printf("name,iterations,ops_per_s,op_us,wall_us,cpu_us,bus_us,bytes,transactions\n");
+    } else {
+        printf("[\n");
+    }
+    bool first = true;
+    for (const BenchCase& bench : bench_cases) {
+        const u32 max_iterations = bench.max_iterations != 0 ? bench.max_iterations : config.max_iterations;
+        counter.reset_counters();
+        const i64 start = esp_timer_get_time();
+        i64 elapsed = 0;
+        u32 iterations = 0;
+        while (iterations < max_iterations && elapsed < static_cast<i64>(config.min_time_ms) * 1000) {
+            Error err = bench.run(display, iterations);
+            if (err == GC9A01::OK) {
+                err = display.flush();
+            }
+            if (err != GC9A01::OK) {
+                return err;
+            }
+            iterations++;
+            elapsed = esp_timer_get_time() - start;
+        }
+
+        const double wall_us = static_cast<double>(elapsed) / iterations;
+        const double cpu_us = static_cast<double>(elapsed - counter.blocked_us()) / iterations;
+        const double bus_us = (static_cast<double>(counter.transactions()) * config.transaction_overhead_ns
+            + static_cast<double>(counter.bytes()) * 8e9 / config.sck_hz) / 1000.0 / iterations;
+        const double op_us = config.real_bus ? wall_us : cpu_us + bus_us;
+        const double ops_per_s = op_us > 0 ? 1e6 / op_us : 0;
+        const double bytes = static_cast<double>(counter.bytes()) / iterations;
+        const double transactions = static_cast<double>(counter.transactions()) / iterations;
+
+        if (config.format == BENCH_CSV) {
+            printf("%s,%lu,%.1f,%.2f,%.2f,%.2f,%.2f,%.0f,%.1f\n", bench.name, static_cast<unsigned long>(iterations),
+                   ops_per_s, op_us, wall_us, cpu_us, bus_us, bytes, transactions);
+        } else {
+            printf("%s  {\"name\": \"%s\", \"iterations\": %lu, \"ops_per_s\": %.1f, \"op_us\": %.2f, \"wall_us\": %.2f, "
+                   "\"cpu_us\": %.2f, \"bus_us\": %.2f, \"bytes\": %.0f, \"transactions\": %.1f}",
+                   first ? "" : ",\n", bench.name, static_cast<unsigned long>(iterations),
+                   ops_per_s, op_us, wall_us, cpu_us, bus_us, bytes, transactions);
+        }
+        first = false;
+    }
+    if (config.format == BENCH_JSON) {
+        printf("\n]\n");
+    }
+    return GC9A01::OK;
+}
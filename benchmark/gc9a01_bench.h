@@ -0,0 +1,71 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_bench.h
+ * @brief Benchmarks of the public drawing API, shared by the target and the host build
+ */
+#pragma once
+
+#include "gc9a01.h"
+
+/**
+ * Forwards to another transport and counts what goes over the bus,
+ * plus the time spent waiting in `collect()`.
+ */
+class GC9A01CountingTransport : public GC9A01::Transport {
+public:
+    explicit GC9A01CountingTransport(GC9A01::Transport& bus);
+
+    GC9A01::Error begin         () override;
+    GC9A01::Error cmd           (const u8 command) override;
+    GC9A01::Error data          (const u8* data, const u32 size) override;
+    GC9A01::Error queue_data    (const u8* data, const u32 size) override;
+    GC9A01::Error collect       (const TickType_t timeout) override;
+    void  set_reset             (const bool level) override;
+    bool  has_reset             () const override;
+    bool  can_send_from         (const void* data) const override;
+    u32   max_transfer          () const override;
+    bool  has_tear              () const override;
+    GC9A01::Error wait_tear     (const TickType_t timeout) override;
+
+    void  reset_counters        ();
+    u64   bytes                 () const;
+    u32   transactions          () const;
+    // Time spent waiting for transfers to finish
+    i64   blocked_us            () const;
+
+private:
+    GC9A01::Error counted       (const GC9A01::Error err, const u32 size);
+
+    GC9A01::Transport& bus_;
+    u64 bytes_ = 0;
+    u32 transactions_ = 0;
+    i64 blocked_us_ = 0;
+};
+
+enum GC9A01BenchFormat {
+    BENCH_CSV,
+    BENCH_JSON
+};
+
+struct GC9A01BenchConfig {
+    // Bus model for the estimated bus time, same as `GC9A01MockPanel`
+    u32 sck_hz = 40000000;
+    u32 transaction_overhead_ns = 10000;
+    // `true` on hardware: the wall time already contains the bus time
+    bool real_bus = true;
+    // Each case repeats until it ran this long or `max_iterations` times
+    u32 min_time_ms = 200;
+    u32 max_iterations = 5000;
+    GC9A01BenchFormat format = BENCH_CSV;
+};
+
+/**
+ * @brief Run all benchmarks on an initialized `display` and print the results
+ *
+ * `counter` has to be the transport of `display`.
+ *
+ * @return `OK`, or the first error of a drawing call
+ */
+GC9A01::Error gc9a01_bench_run(GC9A01& display, GC9A01CountingTransport& counter, const GC9A01BenchConfig& config);
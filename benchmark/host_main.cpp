@@ -0,0 +1,56 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file host_main.cpp
+ * @brief Runs the benchmarks against the mock panel
+ *
+ * Usage: gc9a01_bench [--csv | --json] [--sck HZ] [--overhead NS] [--min-time MS]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "gc9a01_bench.h"
+#include "gc9a01_mock.h"
+
+int main(int argc, char** argv) {
+    GC9A01BenchConfig config;
+    config.real_bus = false;
+    for (int i = 1; i < argc; i++) {
+        const bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--csv") == 0) {
+            config.format = BENCH_CSV;
+        } else if (std::strcmp(argv[i], "--json") == 0) {
+            config.format = BENCH_JSON;
+        } else if (std::strcmp(argv[i], "--sck") == 0 && has_value) {
+            config.sck_hz = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--overhead") == 0 && has_value) {
+            config.transaction_overhead_ns = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && has_value) {
+            config.min_time_ms = std::strtoul(argv[++i], nullptr, 10);
+        } else {
+            fprintf(stderr, "Usage: %s [--csv | --json] [--sck HZ] [--overhead NS] [--min-time MS]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    GC9A01MockPanel panel(config.sck_hz, config.transaction_overhead_ns);
+    panel.set_recording(false);
+    GC9A01CountingTransport counter(panel);
+    GC9A01 display(counter);
+    GC9A01::Error err = display.init();
+    if (err == GC9A01::OK) {
+        err = gc9a01_bench_run(display, counter, config);
+    }
+    if (err != GC9A01::OK) {
+        fprintf(stderr, "Benchmark failed with error %d\n", err);
+        return 1;
+    }
+    if (panel.protocol_errors() != 0) {
+        fprintf(stderr, "Mock panel saw %lu protocol errors\n", static_cast<unsigned long>(panel.protocol_errors()));
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,46 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file main.cpp
+ * @brief Runs the benchmarks on the display configured in `menuconfig`
+ *
+ * Results are printed to the console as CSV, set `config.format` for JSON.
+ */
+
+#include <cstdio>
+
+#include "gc9a01.h"
+#include "gc9a01_spi.h"
+#include "gc9a01_bench.h"
+
+extern "C" void app_main(void)
+{
+    static GC9A01SpiTransport spi(
+        static_cast<spi_host_device_t>(CONFIG_GC9A01_SPI_HOST),
+        static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_MOSI),
+        static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_SCK),
+        static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_CS),
+        static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_DC),
+#ifdef CONFIG_GC9A01_RESET_USED
+        static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_RST)
+#else
+        GPIO_NUM_NC
+#endif
+    );
+    static GC9A01CountingTransport counter(spi);
+    static GC9A01 display(counter);
+
+    GC9A01BenchConfig config;
+    config.sck_hz = CONFIG_GC9A01_SPI_SCK_FREQ_M * 1000000;
+    config.real_bus = true;
+    config.format = BENCH_CSV;
+
+    GC9A01::Error err = display.init();
+    if (err == GC9A01::OK) {
+        err = gc9a01_bench_run(display, counter, config);
+    }
+    if (err != GC9A01::OK) {
+        printf("Benchmark failed with error %d\n", err);
+    }
+}
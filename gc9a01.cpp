@@ -13,181 +13,182 @@
 #include <algorithm>
 #include <array>
 
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-
-#include "esp_system.h"
-
-#include "driver/gpio.h"
-#include "driver/spi_master.h"
+#include "gc9a01_port.h"
 
 #include "gc9a01.h"
-
-#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
-#include "esp_log.h"
-
-
-#define CMD_SWRESET 0x01
-#define CMD_ID 0x04
-#define CMD_DISPLAY_STATUS 0x09
-#define CMD_SLEEP_ON 0x10
-#define CMD_SLEEP_OFF 0x11
-#define CMD_PARTIAL_MODE_ON 0x12
-#define CMD_NORMAL_MODE_ON 0x13
-#define CMD_INVERT_OFF 0x20
-#define CMD_INVERT_ON 0x21
-#define CMD_DISPLAY_OFF 0x28
-#define CMD_DISPLAY_ON 0x29
-#define CMD_COLADDRSET 0x2A
-#define CMD_ROWADDRSET 0x2B
-#define CMD_MEMORY_WRITE 0x2C
-#define CMD_PARTIAL_AREA 0x30
-#define CMD_VERTICAL_SCROLL 0x33
-#define CMD_TEARING_OFF 0x34
-#define CMD_TEARING_ON 0x35
-#define CMD_MEM_ACCESS_CTL 0x36
-#define CMD_VERTICAL_SCROLL_START_ADDR 0x37
-#define CMD_IDLE_OFF 0x38
-#define CMD_IDLE_ON 0x39
-#define CMD_COLMOD 0x3A
-#define CMD_WRITE_MEM_CONTINUE 0x3C
-#define CMD_SET_TEAR_SCANLINE 0x44
-#define CMD_GET_SCANLINE 0x45
-#define CMD_BRIGHTNESS 0x51
-#define CMD_CTRL_DISPLAY 0x53
-#define CMD_READ_ID1 0xDA
-#define CMD_READ_ID2 0xDB
-#define CMD_READ_ID3 0xDC
-
-// Extended command set as found in the datasheet
-#define CMD_RGB_INTERFACE_SIGNAL_CTRL 0xB0
-#define CMD_BLANKING_PORCH_CTRL 0xB5
-#define CMD_DISPLAY_FUNCTION_CTRL 0xB6
-#define CMD_TE_CTRL 0xBA
-#define CMD_INTERFACE_CTRL 0xF6
-#define CMD_POWER_CRITERION_CTRL 0xC1
-#define CMD_VCORE_VOLTAGE_CTRL 0xA7
-#define CMD_VREG1A_VOLTAGE_CTRL 0xC3
-#define CMD_VREG1B_VOLTAGE_CTRL 0xC4
-#define CMD_VREG2A_VOLTAGE_CTRL 0xC9
-#define CMD_FRAMERATE 0xE8
-#define CMD_SPI_2_DATA_CTRL 0xE9
-#define CMD_CHARGE_PUMP_FREQENT_CTRL 0xEC
-#define CMD_INTER_REG_EN_1 0xFE
-#define CMD_INTER_REG_EN_2 0xEF
-#define CMD_SET_GAMMA_1 0xF0
-#define CMD_SET_GAMMA_2 0xF1
-#define CMD_SET_GAMMA_3 0xF2
-#define CMD_SET_GAMMA_4 0xF3
-
-
-#define MADCTL_MY   0x80
-#define MADCTL_MX   0x40
-#define MADCTL_MV   0x20
-#define MADCTL_BGR  0x08
-
-#define ERROR_CHECK(error)\
-if ((error) != OK) {      \
-    return error;         \
-}
-
-#define NUM_INIT_COMMANDS 46
+#include "gc9a01_private.h"
+#ifdef ESP_PLATFORM
+#include "gc9a01_spi.h"
+#endif
 
 #define GC9A01_RST_DELAY 200
 
-// TODO: Find out if ESP_LOGD is optimized out when log level is lower
-#define LOG(msg, args...) ESP_LOGD("gc9a01", msg, ##args)
+#ifdef CONFIG_GC9A01_FAST_BOOT
+// Datasheet timings: RESX low pulse, wait before the first command after a reset
+// and SLPOUT, and wait between a reset and SLPOUT
+#define GC9A01_RST_PULSE_US     10
+#define GC9A01_RST_READY_MS     5
+#define GC9A01_SLEEP_OUT_MS     5
+#define GC9A01_RST_SLEEP_OUT_MS 120
+#endif
 
 /*
- * Commands to initialize the screen
+ * Commands to initialize the screen, packed as
+ * `command, number of parameters, parameters...`
+ *
  * Many commands are unknown since these
  * commands come from the manufacturer and
  * were not explained and as far as I know
- * are not in the datasheet
- */
-static const gc9a01_cmd_t gc9a01_init_cmds[] {
-    {CMD_INTER_REG_EN_2, {0}, 0},                                                           // TODO
-    {0xeb, {0x14}, 1},                                                                      // Unknown command
-    {CMD_INTER_REG_EN_1, {0}, 0},                                                           // TODO
-    {CMD_INTER_REG_EN_2, {0}, 0},                                                           // TODO
-    {0xeb, {0x14}, 1},                                                                      // Unknown command
-    {0x84, {0x40}, 1},                                                                      // Unknown command
-    {0x85, {0xff}, 1},                                                                      // Unknown command
-    {0x86, {0xff}, 1},                                                                      // Unknown command
-    {0x87, {0xff}, 1},                                                                      // Unknown command
-    {0x88, {0x0a}, 1},                                                                      // Unknown command
-    {0x89, {0x21}, 1},                                                                      // Unknown command
-    {0x8a, {0x00}, 1},                                                                      // Unknown command
-    {0x8b, {0x80}, 1},                                                                      // Unknown command
-    {0x8c, {0x01}, 1},                                                                      // Unknown command
-    {0x8d, {0x01}, 1},                                                                      // Unknown command
-    {0x8e, {0xff}, 1},                                                                      // Unknown command
-    {0x8f, {0xff}, 1},                                                                      // Unknown command
-    {CMD_DISPLAY_FUNCTION_CTRL, {0x00, 0x20}, 2},                                           // TODO
-    {CMD_MEM_ACCESS_CTL, {0x08}, 1},                                                        // TODO
-    {CMD_COLMOD, {COLOR_MODE_MCU_16BIT}, 1},                                                // TODO
-    {0x90, {0x08, 0x08, 0x08, 0x08}, 4},                                                    // Unknown command
-    {0xbd, {0x06}, 1},                                                                      // Unknown command
-    {0xbc, {0x00}, 1},                                                                      // Unknown command
-    {0xff, {0x60, 0x01, 0x04}, 3},                                                          // Unknown command
-    {CMD_VREG1A_VOLTAGE_CTRL, {0x13}, 1},                                                   // TODO
-    {CMD_VREG1B_VOLTAGE_CTRL, {0x13}, 1},                                                   // TODO
-    {CMD_VREG2A_VOLTAGE_CTRL, {0x22}, 1},                                                   // TODO
-    {0xbe, {0x11}, 1},                                                                      // Unknown command
-    {0xe1, {0x10, 0x0e}, 2},                                                                // Unknown command
-    {0xdf, {0x21, 0x0c, 0x02}, 3},                                                          // Unknown command
-    {CMD_SET_GAMMA_1, {0x45, 0x09, 0x08, 0x08, 0x26, 0x2a}, 6},                             // TODO
-    {CMD_SET_GAMMA_2, {0x43, 0x70, 0x72, 0x36, 0x37, 0x6f}, 6},                             // TODO
-    {CMD_SET_GAMMA_3, {0x45, 0x09, 0x08, 0x08, 0x26, 0x2a}, 6},                             // TODO
-    {CMD_SET_GAMMA_4, {0x43, 0x70, 0x72, 0x36, 0x37, 0x6f}, 6},                             // TODO
-    {0xed, {0x1b, 0x0b}, 2},                                                                // Unknown command
-    {0xae, {0x77}, 1},                                                                      // Unknown command
-    {0xcd, {0x63}, 1},                                                                      // Unknown command
+ * are not in the datasheet.
+ * SLEEP_OFF and DISPLAY_ON are sent by `init_panel()` which
+ * has to respect the timing around them.
+ */
+static constexpr u8 gc9a01_init_stream[] {
+    CMD_INTER_REG_EN_2, 0,                                                                 // TODO
+    0xeb, 1, 0x14,                                                                         // Unknown command
+    CMD_INTER_REG_EN_1, 0,                                                                 // TODO
+    CMD_INTER_REG_EN_2, 0,                                                                 // TODO
+    0xeb, 1, 0x14,                                                                         // Unknown command
+    0x84, 1, 0x40,                                                                         // Unknown command
+    0x85, 1, 0xff,                                                                         // Unknown command
+    0x86, 1, 0xff,                                                                         // Unknown command
+    0x87, 1, 0xff,                                                                         // Unknown command
+    0x88, 1, 0x0a,                                                                         // Unknown command
+    0x89, 1, 0x21,                                                                         // Unknown command
+    0x8a, 1, 0x00,                                                                         // Unknown command
+    0x8b, 1, 0x80,                                                                         // Unknown command
+    0x8c, 1, 0x01,                                                                         // Unknown command
+    0x8d, 1, 0x01,                                                                         // Unknown command
+    0x8e, 1, 0xff,                                                                         // Unknown command
+    0x8f, 1, 0xff,                                                                         // Unknown command
+    CMD_DISPLAY_FUNCTION_CTRL, 2, 0x00, 0x20,                                              // TODO
+    CMD_MEM_ACCESS_CTL, 1, 0x08,                                                           // TODO
+    CMD_COLMOD, 1, CONFIG_GC9A01_COLOR_MODE,                                               // TODO
+    0x90, 4, 0x08, 0x08, 0x08, 0x08,                                                       // Unknown command
+    0xbd, 1, 0x06,                                                                         // Unknown command
+    0xbc, 1, 0x00,                                                                         // Unknown command
+    0xff, 3, 0x60, 0x01, 0x04,                                                             // Unknown command
+    CMD_VREG1A_VOLTAGE_CTRL, 1, 0x13,                                                      // TODO
+    CMD_VREG1B_VOLTAGE_CTRL, 1, 0x13,                                                      // TODO
+    CMD_VREG2A_VOLTAGE_CTRL, 1, 0x22,                                                      // TODO
+    0xbe, 1, 0x11,                                                                         // Unknown command
+    0xe1, 2, 0x10, 0x0e,                                                                   // Unknown command
+    0xdf, 3, 0x21, 0x0c, 0x02,                                                             // Unknown command
+    CMD_SET_GAMMA_1, 6, 0x45, 0x09, 0x08, 0x08, 0x26, 0x2a,                                // TODO
+    CMD_SET_GAMMA_2, 6, 0x43, 0x70, 0x72, 0x36, 0x37, 0x6f,                                // TODO
+    CMD_SET_GAMMA_3, 6, 0x45, 0x09, 0x08, 0x08, 0x26, 0x2a,                                // TODO
+    CMD_SET_GAMMA_4, 6, 0x43, 0x70, 0x72, 0x36, 0x37, 0x6f,                                // TODO
+    0xed, 2, 0x1b, 0x0b,                                                                   // Unknown command
+    0xae, 1, 0x77,                                                                         // Unknown command
+    0xcd, 1, 0x63,                                                                         // Unknown command
     // Apparently the next line causes issues for some people (TODO: need to look into)
-    // {0x70, {0x07,0x07,0x04,0x0e,0x0f,0x09,0x07,0x08,0x03}, 9},
-    {CMD_FRAMERATE, {0x34}, 1},                                                             // TODO
-    {0x62, {0x18, 0x0D, 0x71, 0xED, 0x70, 0x70, 0x18, 0x0F, 0x71, 0xEF, 0x70, 0x70}, 12},   // Unknown command
-    {0x63, {0x18, 0x11, 0x71, 0xF1, 0x70, 0x70, 0x18, 0x13, 0x71, 0xF3, 0x70, 0x70}, 12},   // Unknown command
-    {0x64, {0x28, 0x29, 0xF1, 0x01, 0xF1, 0x00, 0x07}, 7},                                  // Unknown command
-    {0x66, {0x3C, 0x00, 0xCD, 0x67, 0x45, 0x45, 0x10, 0x00, 0x00, 0x00}, 10},               // Unknown command
-    {0x67, {0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x54, 0x10, 0x32, 0x98}, 10},               // Unknown command
-    {0x74, {0x10, 0x85, 0x80, 0x00, 0x00, 0x4E, 0x00}, 7},                                  // Unknown command
-    {0x98, {0x3e, 0x07}, 2},                                                                // Unknown command
-    {CMD_TEARING_ON, {0}, 0},                                                               // TODO
-    // TODO: Check if commands below are needed
-    {CMD_INVERT_ON, {0x00}, 0},
-    {CMD_SLEEP_OFF, {0x80}, 1},
-    {CMD_DISPLAY_ON, {0x80}, 1},
+    // 0x70, 9, 0x07, 0x07, 0x04, 0x0e, 0x0f, 0x09, 0x07, 0x08, 0x03,
+    CMD_FRAMERATE, 1, 0x34,                                                                // TODO
+    0x62, 12, 0x18, 0x0D, 0x71, 0xED, 0x70, 0x70, 0x18, 0x0F, 0x71, 0xEF, 0x70, 0x70,      // Unknown command
+    0x63, 12, 0x18, 0x11, 0x71, 0xF1, 0x70, 0x70, 0x18, 0x13, 0x71, 0xF3, 0x70, 0x70,      // Unknown command
+    0x64, 7, 0x28, 0x29, 0xF1, 0x01, 0xF1, 0x00, 0x07,                                     // Unknown command
+    0x66, 10, 0x3C, 0x00, 0xCD, 0x67, 0x45, 0x45, 0x10, 0x00, 0x00, 0x00,                  // Unknown command
+    0x67, 10, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x54, 0x10, 0x32, 0x98,                  // Unknown command
+    0x74, 7, 0x10, 0x85, 0x80, 0x00, 0x00, 0x4E, 0x00,                                     // Unknown command
+    0x98, 2, 0x3e, 0x07,                                                                   // Unknown command
+    CMD_TEARING_ON, 1, 0x00,                                                               // TE pulse once per frame
+    CMD_INVERT_ON, 0,
     // {0, {0}, 0xff}, // END
 };
 
 
-void lcd_spi_pre_transfer_callback(spi_transaction_t *t)
-{
-    int dc = (int)t->user;
-    gpio_set_level(static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_DC), dc);
-}
-
+#ifdef ESP_PLATFORM
 GC9A01::GC9A01() :
-    host_(static_cast<spi_host_device_t>(CONFIG_GC9A01_SPI_HOST)),
-    mosi_(static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_MOSI)),
-    clk_(static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_SCK)),
-    cs_(static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_CS)),
-    dc_(static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_DC)),
+    GC9A01(static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_MOSI),
+           static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_SCK),
+           static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_CS),
+           static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_DC),
 #ifdef CONFIG_GC9A01_RESET_USED
-    rst_(static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_RST))
+           static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_RST),
+#else
+           GPIO_NUM_NC,
+#endif
+#ifdef CONFIG_GC9A01_TE_USED
+           static_cast<gpio_num_t>(CONFIG_GC9A01_PIN_NUM_TE)
 #else
-    rst_(GPIO_NUM_NC)
+           GPIO_NUM_NC
 #endif
+    )
 {
 }
 
-GC9A01::GC9A01(gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs, gpio_num_t dc, gpio_num_t rst) : 
-    mosi_(mosi), clk_(clk), cs_(cs), dc_(dc), rst_(rst)
+GC9A01::GC9A01(gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs, gpio_num_t dc, gpio_num_t rst, gpio_num_t te) : 
+    transport_(new GC9A01SpiTransport(static_cast<spi_host_device_t>(CONFIG_GC9A01_SPI_HOST), mosi, clk, cs, dc, rst, te))
+{
+    owned_transport_ = transport_;
+}
+#endif
+
+GC9A01::GC9A01(Transport& transport) :
+    transport_(&transport)
 {
+}
+
+GC9A01::~GC9A01() {
+    if (ready_ != nullptr) {
+        wait_ready(portMAX_DELAY);
+        vSemaphoreDelete(ready_);
+    }
+    sync();
+    heap_caps_free(dma_buf_[0]);
+    heap_caps_free(dma_buf_[1]);
+    heap_caps_free(text_cache_);
+#ifdef CONFIG_GC9A01_BAND_MODE
+    heap_caps_free(painted_);
+#endif
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    heap_caps_free(fb_);
+#ifdef CONFIG_GC9A01_DIFF_FLUSH
+    heap_caps_free(shadow_);
+#endif
+#endif
+    delete owned_transport_;
+}
+
 
+/**
+ * @brief Make room for one more transfer
+ *
+ * Collects the oldest transaction if `GC9A01_QUEUE_SIZE` of them are in flight.
+ *
+ * @return `OK` if a transfer can be queued, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::reserve() const {
+    if (queued_ - completed_ < GC9A01_QUEUE_SIZE) {
+        return OK;
+    }
+#if defined(CONFIG_GC9A01_STATS) || defined(CONFIG_GC9A01_TRACE)
+    const i64 start = esp_timer_get_time();
+    const Error err = collect(portMAX_DELAY);
+    const u32 blocked = esp_timer_get_time() - start;
+#ifdef CONFIG_GC9A01_STATS
+    stats_.blocked_us[primitive_] += blocked;
+#endif
+#ifdef CONFIG_GC9A01_TRACE
+    trace(TRACE_BLOCKED, blocked);
+#endif
+    return err;
+#else
+    return collect(portMAX_DELAY);
+#endif
 }
 
+/**
+ * @brief Collect the oldest transaction in flight
+ * @param timeout Ticks to wait for it to finish
+ * @return `OK` if the transaction finished successfully, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::collect(const TickType_t timeout) const {
+    Error err = transport_->collect(timeout);
+    ERROR_CHECK(err);
+    completed_++;
+    return OK;
+}
 
 /**
  * @brief Send `cmnd` to the display
@@ -196,50 +197,157 @@ GC9A01::GC9A01(gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs, gpio_num_t dc, gp
  * @return `OK` if the command was sent successfully, else `SPI_TRANSMIT_ERROR`
  */
 GC9A01::Error GC9A01::cmd(const u8 cmnd) const {
-    esp_err_t err;
-    spi_transaction_t t;
-
-    // Zero out the transmission ??
-    std::memset(&t, 0, sizeof(t));
-    // Command is 8 bits
-    t.length = 8;
-    // Data is the command itself
-    t.tx_buffer = &cmnd;
-    // D/C needs to be set to 0
-    t.user = (void *)0;
-
-    LOG("CMD: 0x%02x", cmnd);
-
-    // Transmit data
-    err = spi_device_polling_transmit(this->spi_, &t);
-    // assert(err == ESP_OK);
-    return err == ESP_OK ? OK : SPI_TRANSMIT_ERROR;
+    // Any other command ends a memory write
+    writing_ = cmnd == CMD_MEMORY_WRITE || cmnd == CMD_WRITE_MEM_CONTINUE;
+    if (cmnd == CMD_SWRESET) {
+        invalidate_window();
+    }
+    Error err = reserve();
+    ERROR_CHECK(err);
+    err = transport_->cmd(cmnd);
+    ERROR_CHECK(err);
+    queued_++;
+#ifdef CONFIG_GC9A01_STATS
+    stats_.transactions[primitive_]++;
+    stats_.bytes[primitive_]++;
+#endif
+#ifdef CONFIG_GC9A01_TRACE
+    trace(TRACE_CMD, cmnd);
+#endif
+    return OK;
 }
 
 /**
  * @brief Send `data` to the display
+ *
+ * Data larger than 4 bytes is not copied and has to stay untouched
+ * until the transaction finished.
  * 
  * @param data Data to send
  * @param datasize Size of the data
  * @return `OK` if the data was sent successfully, else `SPI_TRANSMIT_ERROR`
  */
 GC9A01::Error GC9A01::data(const u8* data, const u32 datasize) const { 
-    esp_err_t err;
-    spi_transaction_t t;
-
-    // LOG("DATA: %ld bytes", datasize);
-
     // no data
     if (datasize == 0 or data == nullptr) {
         return OK;
     }
-    // Zero out the transmission ??
-    std::memset(&t, 0, sizeof(t));
-    t.length = 8 * datasize;
-    t.tx_buffer = data;
-    t.user = (void *)1; // TODO: When 1 and when 0?
-    err = spi_device_polling_transmit(this->spi_, &t);
-    return err == ESP_OK ? OK : SPI_TRANSMIT_ERROR;
+    if (writing_) {
+        win_written_ += wire_pixels(colmod_, datasize);
+    }
+    Error err = reserve();
+    ERROR_CHECK(err);
+    if (datasize <= GC9A01_INLINE_DATA) {
+        err = transport_->data(data, datasize);
+    } else {
+        err = transport_->queue_data(data, datasize);
+    }
+    ERROR_CHECK(err);
+    queued_++;
+#ifdef CONFIG_GC9A01_STATS
+    stats_.transactions[primitive_]++;
+    stats_.bytes[primitive_] += datasize;
+#endif
+#ifdef CONFIG_GC9A01_TRACE
+    trace(TRACE_DATA, datasize);
+#endif
+    return OK;
+}
+
+/**
+ * @brief Wait for the queued transactions unless asynchronous operation is enabled
+ *
+ * Every public drawing call ends with this.
+ *
+ * @param err Result of the call so far
+ * @return `err` if it is not `OK`, else the result of waiting
+ */
+GC9A01::Error GC9A01::finish(const Error err) const {
+    if (err != OK || async_) {
+        return err;
+    }
+    return sync();
+}
+
+/**
+ * @brief Enable or disable asynchronous operation
+ *
+ * When enabled drawing calls return once their transfers are queued.
+ *
+ * @param async `true` to return without waiting for the transfers
+ */
+void GC9A01::set_async(const bool async) {
+    async_ = async;
+}
+
+/**
+ * @brief Set a callback invoked from the SPI interrupt whenever a transaction finished
+ *
+ * The callback runs in interrupt context and has to be short.
+ *
+ * @param callback Callback, `nullptr` to disable
+ * @param arg Argument passed to the callback
+ */
+void GC9A01::set_completion_callback(const CompletionCallback callback, void* arg) {
+    transport_->set_completion_callback(callback, arg);
+}
+
+/**
+ * @brief Get a handle for everything queued so far
+ * @return Fence to pass to `is_done()` or `wait()`
+ */
+u32 GC9A01::fence() const {
+    return queued_;
+}
+
+/**
+ * @brief Check whether everything queued up to `fence` was sent, without blocking
+ * @param fence Fence returned by `fence()`
+ * @return `true` if all transactions up to `fence` finished
+ */
+bool GC9A01::is_done(const u32 fence) const {
+    while (static_cast<i32>(fence - completed_) > 0) {
+        if (collect(0) != OK) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Wait until everything queued up to `fence` was sent
+ * @param fence Fence returned by `fence()`
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::wait(const u32 fence) const {
+    if (static_cast<i32>(fence - completed_) <= 0) {
+        return OK;
+    }
+#if defined(CONFIG_GC9A01_STATS) || defined(CONFIG_GC9A01_TRACE)
+    const i64 start = esp_timer_get_time();
+#endif
+    Error err = OK;
+    while (err == OK && static_cast<i32>(fence - completed_) > 0) {
+        err = collect(portMAX_DELAY);
+    }
+#if defined(CONFIG_GC9A01_STATS) || defined(CONFIG_GC9A01_TRACE)
+    const u32 waited = esp_timer_get_time() - start;
+#ifdef CONFIG_GC9A01_STATS
+    stats_.wait_us += waited;
+#endif
+#ifdef CONFIG_GC9A01_TRACE
+    trace(TRACE_WAIT, waited);
+#endif
+#endif
+    return err;
+}
+
+/**
+ * @brief Wait until everything queued so far was sent
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::sync() const {
+    return wait(fence());
 }
 
 /**
@@ -249,12 +357,21 @@ GC9A01::Error GC9A01::data(const u8* data, const u32 datasize) const {
  */
 GC9A01::Error GC9A01::hard_reset() const {
     LOG("Hard reset");
-    gpio_set_level(this->rst_, 1);
+    invalidate_window();
+#ifdef CONFIG_GC9A01_FAST_BOOT
+    transport_->set_reset(false);
+    esp_rom_delay_us(GC9A01_RST_PULSE_US);
+    transport_->set_reset(true);
+    reset_at_ = esp_timer_get_time();
+    delay_until(reset_at_ + GC9A01_RST_READY_MS * 1000);
+#else
+    transport_->set_reset(true);
     vTaskDelay(GC9A01_RST_DELAY / portTICK_PERIOD_MS);
-    gpio_set_level(this->rst_, 0);
+    transport_->set_reset(false);
     vTaskDelay(GC9A01_RST_DELAY / portTICK_PERIOD_MS);
-    gpio_set_level(this->rst_, 1);
+    transport_->set_reset(true);
     vTaskDelay(GC9A01_RST_DELAY / portTICK_PERIOD_MS);
+#endif
     return OK;
 }
 
@@ -264,7 +381,18 @@ GC9A01::Error GC9A01::hard_reset() const {
  */
 GC9A01::Error GC9A01::soft_reset() const {
     LOG("Soft reset");
-    return cmd(CMD_SWRESET);
+#ifdef CONFIG_GC9A01_FAST_BOOT
+    // The reset timing starts once the command is on the wire
+    Error err = cmd(CMD_SWRESET);
+    ERROR_CHECK(err);
+    err = sync();
+    ERROR_CHECK(err);
+    reset_at_ = esp_timer_get_time();
+    delay_until(reset_at_ + GC9A01_RST_READY_MS * 1000);
+    return OK;
+#else
+    return finish(cmd(CMD_SWRESET));
+#endif
 }
 
 /**
@@ -273,70 +401,207 @@ GC9A01::Error GC9A01::soft_reset() const {
  * This function initializes the display with the settings configured in `menuconfig`.
  * It sets up the GPIO pins, SPI bus and device, and sends the initialization commands.
  * 
- * @return `OK` if the initialization was successful, else `SPI_TRANSMIT_ERROR`
+ * @return `OK` if the initialization was successful, `OUT_OF_MEMORY` if the DMA buffer
+ *         could not be allocated, `INVALID_ARGUMENT` if the transfer limit of the bus
+ *         is below `GC9A01_MIN_TRANSFER_SZ`, else `SPI_TRANSMIT_ERROR`
  */
 GC9A01::Error GC9A01::init() 
+{
+    Error err = init_bus();
+    ERROR_CHECK(err);
+    return init_panel();
+}
+
+/**
+ * @brief Initialize the display in a background task
+ *
+ * The bus is set up before returning, the panel initialization runs in a
+ * task of priority `priority` so the application can boot meanwhile.
+ * No other method may be called before `wait_ready()` returned.
+ *
+ * @param priority Priority of the initialization task
+ * @return `OK` if the task was started, `OUT_OF_MEMORY` if the DMA buffer or the
+ *         task could not be allocated, `INVALID_ARGUMENT` if the transfer limit of
+ *         the bus is below `GC9A01_MIN_TRANSFER_SZ`, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::init_async(const UBaseType_t priority)
+{
+    Error err = init_bus();
+    ERROR_CHECK(err);
+    if (ready_ == nullptr) {
+        ready_ = xSemaphoreCreateBinary();
+    }
+    if (ready_ == nullptr) {
+        return OUT_OF_MEMORY;
+    }
+    if (xTaskCreate(init_task, "gc9a01_init", 3072, this, priority, nullptr) != pdPASS) {
+        return OUT_OF_MEMORY;
+    }
+    return OK;
+}
+
+void GC9A01::init_task(void* arg)
+{
+    GC9A01* self = static_cast<GC9A01*>(arg);
+    self->init_result_ = self->init_panel();
+    xSemaphoreGive(self->ready_);
+    vTaskDelete(nullptr);
+}
+
+/**
+ * @brief Wait for the initialization started by `init_async()`
+ * @param timeout Ticks to wait
+ * @return The result of the initialization, `TIMEOUT` if it did not finish in time,
+ *         `INVALID_ARGUMENT` if `init_async()` was not called
+ */
+GC9A01::Error GC9A01::wait_ready(const TickType_t timeout)
+{
+    if (ready_ == nullptr) {
+        return INVALID_ARGUMENT;
+    }
+    if (xSemaphoreTake(ready_, timeout) != pdTRUE) {
+        return TIMEOUT;
+    }
+    // Later calls return immediately
+    xSemaphoreGive(ready_);
+    return init_result_;
+}
+
+/**
+ * @brief Set up the transport and the driver buffers
+ * @return `OK` on success, `OUT_OF_MEMORY` if a buffer could not be allocated,
+ *         `INVALID_ARGUMENT` if the bus takes less than `GC9A01_MIN_TRANSFER_SZ`
+ *         bytes per transfer, else the error of the transport
+ */
+GC9A01::Error GC9A01::init_bus()
 {
     LOG("Display Initialization");
-    LOG("SPI Host: %d", host_);
-    esp_err_t esp_err;
-    // GPIO setup
-    gpio_config_t io_conf = {
-        .pin_bit_mask = (1ULL << this->dc_),
-        .mode = GPIO_MODE_OUTPUT,
-        .pull_up_en = GPIO_PULLUP_ENABLE,
-    };
-    #ifdef CONFIG_GC9A01_RESET_USED
-    io_conf.pin_bit_mask |= (1ULL << rst_);
-    #endif
-    esp_err = gpio_config(&io_conf);
-    ESP_ERROR_CHECK(esp_err);
-
-    // SPI setup
-    spi_bus_config_t buscfg = {
-        .mosi_io_num = mosi_,
-        .miso_io_num = GPIO_NUM_NC,
-        .sclk_io_num = clk_,
-        .quadwp_io_num = -1,
-        .quadhd_io_num = -1,
-        .max_transfer_sz = CONFIG_GC9A01_HEIGHT * CONFIG_GC9A01_WIDTH * 2
-        
-    };
-    spi_device_interface_config_t devcfg = {
-        .mode = 0,
-        .clock_speed_hz = 80000000, // 40MHz
-        .spics_io_num = cs_,
-        .flags = SPI_DEVICE_HALFDUPLEX,
-        .queue_size = 7,
-        .pre_cb = lcd_spi_pre_transfer_callback,
-    };
+    Error err = transport_->begin();
+    ERROR_CHECK(err);
+    // Rows are sent as single transfers in the band and sprite paths
+    if (transport_->max_transfer() < GC9A01_MIN_TRANSFER_SZ) {
+        return INVALID_ARGUMENT;
+    }
+
+    // Line buffers for burst transfers
+    for (auto& buf : dma_buf_) {
+        if (buf == nullptr) {
+            buf = static_cast<u16*>(heap_caps_malloc(GC9A01_DMA_BUFFER_PIXELS * sizeof(u16), MALLOC_CAP_DMA));
+        }
+        if (buf == nullptr) {
+            return OUT_OF_MEMORY;
+        }
+    }
+    dma_buf_filled_ = 0;
 
-    esp_err = spi_bus_initialize(this->host_, &buscfg, SPI_DMA_CH_AUTO);
-    ESP_ERROR_CHECK(esp_err);
-    esp_err = spi_bus_add_device(this->host_, &devcfg, &this->spi_);
-    ESP_ERROR_CHECK(esp_err);
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    // Prefer DMA capable memory so `flush()` can send without copying
+    if (fb_ == nullptr) {
+        fb_ = static_cast<u16*>(heap_caps_malloc(GC9A01_PIXELS * sizeof(u16), MALLOC_CAP_DMA));
+    }
+    if (fb_ == nullptr) {
+        fb_ = static_cast<u16*>(heap_caps_malloc(GC9A01_PIXELS * sizeof(u16), MALLOC_CAP_8BIT));
+    }
+    if (fb_ == nullptr) {
+        return OUT_OF_MEMORY;
+    }
+    dirty_count_ = 0;
+#ifdef CONFIG_GC9A01_DIFF_FLUSH
+    // Only compared against, never sent
+    if (shadow_ == nullptr) {
+        shadow_ = static_cast<u16*>(heap_caps_malloc(GC9A01_PIXELS * sizeof(u16), MALLOC_CAP_8BIT));
+    }
+    if (shadow_ == nullptr) {
+        return OUT_OF_MEMORY;
+    }
+    shadow_valid_ = false;
+#endif
+#endif
 
+    return OK;
+}
 
+/**
+ * @brief Reset the panel and send the initialization commands
+ *
+ * With `CONFIG_GC9A01_FAST_BOOT` only the delays required by the datasheet
+ * are applied and the commands are queued without waiting for each of them.
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::init_panel()
+{
+    Error err;
+#ifdef CONFIG_GC9A01_FAST_BOOT
+    // A hard reset already restores the register defaults
+    if (transport_->has_reset()) {
+        hard_reset();
+    } else {
+        err = soft_reset();
+        ERROR_CHECK(err);
+    }
+#else
     hard_reset();
     vTaskDelay(100 / portTICK_PERIOD_MS);
     soft_reset();
+    sync();
     vTaskDelay(100 / portTICK_PERIOD_MS);
+#endif
 
-    Error result = OK;
-    for (const auto& init_cmd : gc9a01_init_cmds)
-    {
-        if ((result = cmd(init_cmd.cmd)) != OK)
-        {
-            break;
-        }
-        if ((result = data(init_cmd.data, init_cmd.datasize)) != OK)
-        {
-            break;
-        }
+    // Parameters are sent from the DMA buffer, the stream itself lives in flash
+    static_assert(sizeof(gc9a01_init_stream) <= GC9A01_DMA_BUFFER_PIXELS * sizeof(u16));
+    // Uses the second buffer, so the solid fill of `clear()` does not wait for them
+    err = wait(dma_buf_fence_[1]);
+    ERROR_CHECK(err);
+    u8* params = reinterpret_cast<u8*>(dma_buf_[1]);
+    std::memcpy(params, gc9a01_init_stream, sizeof(gc9a01_init_stream));
+
+    // The stream selects the configured color mode
+    colmod_ = CONFIG_GC9A01_COLOR_MODE;
+    // Scrolling is off after a reset
+    scroll_top_ = 0;
+    scroll_lines_ = GC9A01_HEIGHT;
+    dma_buf_filled_ = 0;
+    for (u32 i = 0; i < sizeof(gc9a01_init_stream); i += 2 + params[i + 1]) {
+        err = cmd(params[i]);
+        ERROR_CHECK(err);
+        err = data(&params[i + 2], params[i + 1]);
+        ERROR_CHECK(err);
+#ifndef CONFIG_GC9A01_FAST_BOOT
+        err = sync();
+        ERROR_CHECK(err);
         vTaskDelay(10 / portTICK_PERIOD_MS);
+#endif
     }
-    clear();
-    return result;
+    dma_buf_fence_[1] = fence();
+
+#ifdef CONFIG_GC9A01_FAST_BOOT
+    // GRAM is writable in sleep mode, clearing it now overlaps the wait before SLPOUT
+    err = clear();
+    ERROR_CHECK(err);
+    err = flush();
+    ERROR_CHECK(err);
+    err = sync();
+    ERROR_CHECK(err);
+    delay_until(reset_at_ + GC9A01_RST_SLEEP_OUT_MS * 1000);
+    err = cmd(CMD_SLEEP_OFF);
+    ERROR_CHECK(err);
+    err = sync();
+    ERROR_CHECK(err);
+    delay_until(esp_timer_get_time() + GC9A01_SLEEP_OUT_MS * 1000);
+#else
+    err = cmd(CMD_SLEEP_OFF);
+    ERROR_CHECK(err);
+    err = sync();
+    ERROR_CHECK(err);
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+    err = clear();
+    ERROR_CHECK(err);
+    err = flush();
+    ERROR_CHECK(err);
+#endif
+    // Only turned on once GRAM holds a defined image
+    return finish(cmd(CMD_DISPLAY_ON));
 }
 
 /**
@@ -345,7 +610,7 @@ GC9A01::Error GC9A01::init()
  * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
  */
 GC9A01::Error GC9A01::display_off() const {
-    return cmd(CMD_DISPLAY_OFF);
+    return finish(cmd(CMD_DISPLAY_OFF));
 }
 
 /**
@@ -354,7 +619,7 @@ GC9A01::Error GC9A01::display_off() const {
  * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
  */
 GC9A01::Error GC9A01::display_on() const {
-    return cmd(CMD_DISPLAY_ON);
+    return finish(cmd(CMD_DISPLAY_ON));
 }
 
 /**
@@ -363,7 +628,74 @@ GC9A01::Error GC9A01::display_on() const {
  * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
  */
 GC9A01::Error GC9A01::invert(const bool inv) const {
-    return cmd(inv ? CMD_INVERT_ON : CMD_INVERT_OFF);
+    return finish(cmd(inv ? CMD_INVERT_ON : CMD_INVERT_OFF));
+}
+
+/**
+ * @brief Define the area moved by vertical scrolling
+ *
+ * Rows are GRAM rows, which are the rows of rotation 0 (`MADCTL_MV` off). The
+ * `top_fixed` rows above and the rows below the scroll area do not move.
+ * Also resets the scroll position to 0.
+ *
+ * @param top_fixed Number of fixed rows at the top
+ * @param lines Number of rows in the scroll area
+ * @return `OK` on success, `INVALID_ARGUMENT` if the area does not fit the screen, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::set_scroll_area(const u16 top_fixed, const u16 lines) const {
+    if (lines == 0 || static_cast<u32>(top_fixed) + lines > GC9A01_HEIGHT) {
+        return INVALID_ARGUMENT;
+    }
+    const u16 bottom_fixed = GC9A01_HEIGHT - top_fixed - lines;
+    // TFA, VSA and BFA have to add up to the GRAM height
+    const u8 params[] = {
+        static_cast<u8>(top_fixed >> 8),
+        static_cast<u8>(top_fixed & 0xFF),
+        static_cast<u8>(lines >> 8),
+        static_cast<u8>(lines & 0xFF),
+        static_cast<u8>(bottom_fixed >> 8),
+        static_cast<u8>(bottom_fixed & 0xFF)
+    };
+    // Sent in two parts, the transport only copies up to `GC9A01_INLINE_DATA` bytes
+    Error err = cmd(CMD_VERTICAL_SCROLL);
+    ERROR_CHECK(err);
+    err = data(params, 4);
+    ERROR_CHECK(err);
+    err = data(params + 4, 2);
+    ERROR_CHECK(err);
+    scroll_top_ = top_fixed;
+    scroll_lines_ = lines;
+    err = scroll_to(0);
+    return finish(err);
+}
+
+/**
+ * @brief Scroll the area set by `set_scroll_area()`
+ *
+ * Only the start address changes, GRAM is not touched: row `line` of the scroll
+ * area is shown at its top, the rows above it wrap around to the bottom.
+ *
+ * @param line Scroll position, taken modulo the height of the scroll area
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::scroll_to(const u16 line) const {
+    const u16 start = scroll_top_ + line % scroll_lines_;
+    const u8 params[] = {
+        static_cast<u8>(start >> 8),
+        static_cast<u8>(start & 0xFF)
+    };
+    Error err = cmd(CMD_VERTICAL_SCROLL_START_ADDR);
+    ERROR_CHECK(err);
+    err = data(params, 2);
+    return finish(err);
+}
+
+/**
+ * @brief Undo `set_scroll_area()` and `scroll_to()`, the whole screen shows GRAM as it is
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::reset_scroll() const {
+    return set_scroll_area(0, GC9A01_HEIGHT);
 }
 
 /**
@@ -404,24 +736,45 @@ GC9A01::Error GC9A01::set_rotation(const u8 rotation) const {
             return INVALID_ARGUMENT;
     }
     madctl |= is_bgr_ ? MADCTL_BGR : 0x00;
+    // The address counter runs differently now
+    invalidate_window();
 
     err = cmd(CMD_MEM_ACCESS_CTL);
     ERROR_CHECK(err);
     err = data(&madctl, 1);
-    ERROR_CHECK(err);
-    return OK;
+    return finish(err);
+}
+
+/**
+ * @brief Forget the cached address window, the next write sends a full setup
+ *
+ * Called whenever GRAM is reset or addressed differently, so with
+ * `CONFIG_GC9A01_DIFF_FLUSH` the next flush does not diff against the last frame.
+ */
+void GC9A01::invalidate_window() const {
+    win_valid_ = false;
+    writing_ = false;
+#ifdef CONFIG_GC9A01_DIFF_FLUSH
+    shadow_valid_ = false;
+#endif
 }
 
 /**
  * @brief Sets the write window for the display
+ *
+ * The window last sent is cached: CASET and RASET are only sent if the columns
+ * or rows changed. If the new window continues a memory write exactly where it
+ * stopped (same columns, starting at the row the address counter is on) only
+ * `CMD_WRITE_MEM_CONTINUE` is sent.
+ *
  * @param x starting `x` coordinate
  * @param y starting `y` coordinate
  * @param w width of the window
  * @param h height of the window
  * @return `OK` on success, `INVALID_ARGUMENT` if the arguments are invalid, else `SPI_TRANSMIT_ERROR`
  */
-GC9A01::Error GC9A01::set_write_window(const u8 x, const u8 y, const u8 w, const u8 h) const {
-    if (x > GC9A01_WIDTH || y > GC9A01_HEIGHT) {
+GC9A01::Error GC9A01::set_write_window(const u16 x, const u16 y, const u16 w, const u16 h) const {
+    if (x >= GC9A01_WIDTH || y >= GC9A01_HEIGHT || w == 0 || h == 0) {
         return INVALID_ARGUMENT;
     }
     if (x + w > GC9A01_WIDTH || y + h > GC9A01_HEIGHT) {
@@ -429,87 +782,789 @@ GC9A01::Error GC9A01::set_write_window(const u8 x, const u8 y, const u8 w, const
     }
 
     Error err;
+    const u16 x1 = x + w - 1;
+    const u16 y1 = y + h - 1;
+    u8 transactions = 0;
 
-    // Column address set
-    u16 start = x;
-    u16 end = x + w - 1;
-    const u8 col[] = {
-        static_cast<u8>(start >> 8),
-        static_cast<u8>(start & 0xFF),
-        static_cast<u8>(end >> 8),
-        static_cast<u8>(end & 0xFF)
-    };
-    err = cmd(CMD_COLADDRSET);
-    ERROR_CHECK(err);
-    err = data(col, 4);
-    ERROR_CHECK(err);
+    if (win_valid_ && writing_ && x == win_x0_ && x1 == win_x1_) {
+        // Where the address counter currently is
+        const u32 win_w = win_x1_ - win_x0_ + 1;
+        const u32 win_h = win_y1_ - win_y0_ + 1;
+        const u32 pos = win_written_ % (win_w * win_h);
+        if (pos % win_w == 0 && win_y0_ + pos / win_w == y && y1 <= win_y1_) {
+            err = cmd(CMD_WRITE_MEM_CONTINUE);
+            ERROR_CHECK(err);
+            // Keep counting from the start of the window
+            win_written_ = pos;
+            transactions = 1;
+#ifdef CONFIG_GC9A01_STATS
+            stats_.window_setups[primitive_]++;
+            stats_.transactions_saved[primitive_] += WINDOW_SETUP_TRANSACTIONS - transactions;
+#endif
+            return OK;
+        }
+    }
+
+    if (!win_valid_ || x != win_x0_ || x1 != win_x1_) {
+        // Column address set
+        const u8 col[] = {
+            static_cast<u8>(x >> 8),
+            static_cast<u8>(x & 0xFF),
+            static_cast<u8>(x1 >> 8),
+            static_cast<u8>(x1 & 0xFF)
+        };
+        err = cmd(CMD_COLADDRSET);
+        ERROR_CHECK(err);
+        err = data(col, 4);
+        ERROR_CHECK(err);
+        transactions += 2;
+    }
+    if (!win_valid_ || y != win_y0_ || y1 != win_y1_) {
+        // Row address set
+        const u8 row[] = {
+            static_cast<u8>(y >> 8),
+            static_cast<u8>(y & 0xFF),
+            static_cast<u8>(y1 >> 8),
+            static_cast<u8>(y1 & 0xFF)
+        };
+        err = cmd(CMD_ROWADDRSET);
+        ERROR_CHECK(err);
+        err = data(row, 4);
+        ERROR_CHECK(err);
+        transactions += 2;
+    }
+    win_x0_ = x;
+    win_x1_ = x1;
+    win_y0_ = y;
+    win_y1_ = y1;
+    win_valid_ = true;
 
-    // Row address set
-    start = y;
-    end = y + h - 1;
-    const u8 row[] = {
-        static_cast<u8>(start >> 8),
-        static_cast<u8>(start & 0xFF),
-        static_cast<u8>(end >> 8),
-        static_cast<u8>(end & 0xFF)
-    };
-    err = cmd(CMD_ROWADDRSET);
-    ERROR_CHECK(err);
-    err = data(row, 4);
-    ERROR_CHECK(err);
     err = cmd(CMD_MEMORY_WRITE);
     ERROR_CHECK(err);
+    win_written_ = 0;
+    transactions++;
+#ifdef CONFIG_GC9A01_STATS
+    stats_.window_setups[primitive_]++;
+    stats_.transactions_saved[primitive_] += WINDOW_SETUP_TRANSACTIONS - transactions;
+#endif
     return OK;
 }
 
+GC9A01::PrimitiveScope::PrimitiveScope(const GC9A01* display, const Primitive primitive) :
+    display_(display), outermost_(display->primitive_ == PRIM_OTHER)
+{
+    if (outermost_) {
+        display_->primitive_ = primitive;
+#ifdef CONFIG_GC9A01_STATS
+        display_->stats_.calls[primitive]++;
+#endif
+    }
+}
+
+GC9A01::PrimitiveScope::~PrimitiveScope() {
+    if (outermost_) {
+        display_->primitive_ = PRIM_OTHER;
+    }
+}
+
+#ifdef CONFIG_GC9A01_STATS
 /**
- * @brief Fill the screen with a `color`
- * TODO: Replace with `fill_rect`
- * @param color Color to fill the screen with
+ * @brief Get the statistics collected since `init()` or `reset_stats()`
+ * @return Statistics per primitive
+ */
+const GC9A01::Stats& GC9A01::stats() const {
+    return stats_;
+}
+
+/**
+ * @brief Reset all statistics to zero
+ */
+void GC9A01::reset_stats() {
+    stats_ = {};
+}
+#endif
+
+#ifdef CONFIG_GC9A01_TRACE
+// Layout of the second word of a trace entry
+#define TRACE_VALUE_BITS    24
+#define TRACE_VALUE_MAX     ((1u << TRACE_VALUE_BITS) - 1)
+#define TRACE_PRIM_SHIFT    TRACE_VALUE_BITS
+#define TRACE_EVENT_SHIFT   (TRACE_VALUE_BITS + 6)
+static_assert(GC9A01::PRIM_COUNT <= 64, "Primitive does not fit into a trace entry");
+
+/**
+ * @brief Append a transaction to the trace ring buffer, overwriting the oldest entry
+ * @param event Kind of the entry
+ * @param value Command byte, size or time, depending on `event`
+ */
+void GC9A01::trace(const TraceEvent event, const u32 value) const {
+    const u32 head = trace_head_.load(std::memory_order_relaxed);
+    auto& entry = trace_[head & (CONFIG_GC9A01_TRACE_DEPTH - 1)];
+    // A reader seeing any of the stores below also sees `head`, so it knows the slot is being reused
+    std::atomic_thread_fence(std::memory_order_release);
+    entry[0].store(static_cast<u32>(esp_timer_get_time()), std::memory_order_relaxed);
+    entry[1].store(static_cast<u32>(event) << TRACE_EVENT_SHIFT |
+                   static_cast<u32>(primitive_) << TRACE_PRIM_SHIFT |
+                   std::min(value, TRACE_VALUE_MAX), std::memory_order_relaxed);
+    // Publishes the entry to `read_trace()`
+    trace_head_.store(head + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Copy the most recent trace entries, oldest first
+ *
+ * Does not block the drawing task. Entries it overwrote during the copy are dropped.
+ * Once the ring wrapped, the oldest slot is the next one to be written and is
+ * left out, so at most `CONFIG_GC9A01_TRACE_DEPTH - 1` entries are returned.
+ *
+ * @param entries Destination
+ * @param count Capacity of `entries`
+ * @return Number of entries copied
+ */
+u32 GC9A01::read_trace(TraceEntry* entries, const u32 count) const {
+    const u32 head = trace_head_.load(std::memory_order_acquire);
+    u32 first = head - std::min({head, count, static_cast<u32>(CONFIG_GC9A01_TRACE_DEPTH)});
+    u32 words[CONFIG_GC9A01_TRACE_DEPTH][2];
+    for (u32 i = first; i != head; i++) {
+        const auto& entry = trace_[i & (CONFIG_GC9A01_TRACE_DEPTH - 1)];
+        words[i - first][0] = entry[0].load(std::memory_order_relaxed);
+        words[i - first][1] = entry[1].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // Entry `i` gets overwritten by entry `i + DEPTH`, which may be in progress once the head reached it
+    const u32 now = trace_head_.load(std::memory_order_relaxed);
+    const u32 skip = static_cast<i32>(now - first) >= CONFIG_GC9A01_TRACE_DEPTH
+        ? std::min(head - first, now - first - CONFIG_GC9A01_TRACE_DEPTH + 1) : 0;
+
+    u32 copied = 0;
+    for (u32 i = first + skip; i != head; i++, copied++) {
+        const u32* word = words[i - first];
+        entries[copied].time_us = word[0];
+        entries[copied].event = static_cast<TraceEvent>(word[1] >> TRACE_EVENT_SHIFT);
+        entries[copied].primitive = static_cast<Primitive>((word[1] >> TRACE_PRIM_SHIFT) & 0x3F);
+        entries[copied].value = word[1] & TRACE_VALUE_MAX;
+    }
+    return copied;
+}
+
+/**
+ * @brief Print the trace ring buffer, oldest entry first
+ */
+void GC9A01::dump_trace() const {
+    static constexpr const char* events[] = {"CMD", "DATA", "BLOCKED", "WAIT"};
+    static constexpr const char* primitives[PRIM_COUNT] = {
+        "other", "set_pixel", "hline", "vline", "rect", "fill_rect", "bitmap", "circle",
+        "fill_circle", "arc", "line", "round_rect", "triangle", "fill", "flush", "text", "sprite", "rotated"
+    };
+    TraceEntry entries[CONFIG_GC9A01_TRACE_DEPTH];
+    const u32 count = read_trace(entries, CONFIG_GC9A01_TRACE_DEPTH);
+    for (u32 i = 0; i < count; i++) {
+        const TraceEntry& entry = entries[i];
+        if (entry.event == TRACE_CMD) {
+            printf("%10lu %-11s %-7s 0x%02lx\n", static_cast<unsigned long>(entry.time_us),
+                   primitives[entry.primitive], events[entry.event], static_cast<unsigned long>(entry.value));
+        } else {
+            printf("%10lu %-11s %-7s %lu\n", static_cast<unsigned long>(entry.time_us),
+                   primitives[entry.primitive], events[entry.event], static_cast<unsigned long>(entry.value));
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Largest burst sent from a DMA buffer, in bytes
+ *
+ * The bus may have been set up with a smaller transfer limit than a buffer holds.
+ */
+u32 GC9A01::burst_bytes() const {
+    return std::min<u32>(GC9A01_DMA_BUFFER_PIXELS * 2, transport_->max_transfer());
+}
+
+/**
+ * @brief Stream `pixels` pixels of `color16` into the current write window
+ *
+ * The color is repeated into the DMA buffer once and then sent in bursts of
+ * at most `burst_bytes()` instead of one transaction per pixel.
+ * The buffer keeps its content between calls, so consecutive fills with the
+ * same color skip the refill.
+ *
+ * @param color16 16-bit color
+ * @param pixels number of pixels to send
  * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
  */
-GC9A01::Error GC9A01::fill(const Color color) const {
+template <class Format>
+GC9A01::Error GC9A01::fill_color_as(const u16 color16, const u32 pixels) const {
     Error err;
-    LOG("Fill screen: Color(%d)", color.to_16bit());
-    err = set_write_window(0, 0, GC9A01_WIDTH, GC9A01_HEIGHT);
-    ERROR_CHECK(err);
-    u16 color16 = color.to_16bit();
-    u8 buf[2] = {static_cast<u8>(color16 >> 8), static_cast<u8>(color16 & 0xFF)};
-    for (u32 i = 0; i < GC9A01_PIXELS; i++) {
-        err = data(buf, 2);
+    const u32 burst = std::min(pixels, Format::capacity(burst_bytes()));
+    if (dma_buf_color_ != color16) {
+        dma_buf_filled_ = 0;
+        dma_buf_color_ = color16;
+    }
+    if (dma_buf_filled_ < burst) {
+        // The buffer may still be on the wire from a previous fill
+        err = wait(dma_buf_fence_[0]);
+        ERROR_CHECK(err);
+        // Encode one period, then repeat it word by word, buffer is 4-byte aligned
+        u32 period[std::max(Format::period_pixels * 2, Format::period_bytes) / 4];
+        u8* bytes = reinterpret_cast<u8*>(period);
+        for (u32 i = 0; i < Format::period_pixels; i++) {
+            bytes[2 * i] = static_cast<u8>(color16 >> 8);
+            bytes[2 * i + 1] = static_cast<u8>(color16);
+        }
+        Format::pack(bytes, Format::period_pixels);
+        u32* words = reinterpret_cast<u32*>(dma_buf_[0]);
+        const u32 count = (Format::bytes(burst) + 3) / 4;
+        for (u32 i = 0; i < count; i++) {
+            words[i] = period[i % (Format::period_bytes / 4)];
+        }
+        dma_buf_filled_ = burst;
+    }
+
+    u32 remaining = pixels;
+    while (remaining > 0) {
+        const u32 n = std::min(remaining, burst);
+        err = data(reinterpret_cast<const u8*>(dma_buf_[0]), Format::bytes(n));
         ERROR_CHECK(err);
+        dma_buf_fence_[0] = fence();
+        remaining -= n;
     }
     return OK;
 }
 
+/**
+ * @brief Fill the screen with a `color`
+ * @param color Color to fill the screen with
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::fill(const Color color) const {
+    PRIMITIVE(PRIM_FILL);
+    return fill_rect(0, 0, GC9A01_WIDTH, GC9A01_HEIGHT, color);
+}
+
 /**
  * @brief Set a pixel at `x`, `y` with a `color`
  * @param x `x` coordinate
  * @param y `y` coordinate
  * @param color Color of the pixel
- * @return `OK` on success, `INVALID_ARGUMENT` if the arguments are invalid, else `SPI_TRANSMIT_ERROR`
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
  */
-GC9A01::Error GC9A01::set_pixel(const u16 x, const u16 y, const Color color) const {
-    if (x >= GC9A01_WIDTH || y >= GC9A01_HEIGHT) {
+GC9A01::Error GC9A01::set_pixel(const i16 x, const i16 y, const Color color) const {
+    PRIMITIVE(PRIM_SET_PIXEL);
+    return finish(clip_fill(x, y, 1, 1, color.to_16bit()));
+}
+
+
+/**
+ * @brief Clear the screen buffer
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::clear() const {
+    return fill(Color(0, 0, 0));
+}
+
+/**
+ * @brief Stream a `w` x `h` block of pixels into the current write window
+ *
+ * Rows of `src` are `stride` pixels apart. The pixels are gathered into the two
+ * DMA buffers in turns, so the next chunk is prepared while the previous one is
+ * still on the wire. If `swap` is `false` the pixels are expected to be stored
+ * big-endian already, and contiguous DMA capable data is sent without any copy.
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+template <class Format>
+GC9A01::Error GC9A01::write_pixels_as(const u16* src, const u16 w, const u16 h, const u32 stride, const bool swap) const {
+    const u32 total = static_cast<u32>(w) * h;
+    Error err;
+
+    // Zero-copy path: the data can be handed to the DMA as it is
+    if (Format::identity && !swap && stride == w && transport_->can_send_from(src) && (reinterpret_cast<uintptr_t>(src) & 3) == 0) {
+        // Whole words, so every burst starts aligned
+        const u32 burst = transport_->max_transfer() / 4 * 2;
+        for (u32 sent = 0; sent < total; sent += burst) {
+            err = data(reinterpret_cast<const u8*>(src + sent), std::min(burst, total - sent) * 2);
+            ERROR_CHECK(err);
+        }
+        return OK;
+    }
+
+    // Both buffers get overwritten
+    dma_buf_filled_ = 0;
+
+    // Pixels are gathered as big-endian RGB565 and converted to the wire format in place
+    const u32 capacity = Format::staged_capacity(burst_bytes());
+    u32 row = 0;
+    u32 col = 0;
+    u8 current = 0;
+    for (u32 sent = 0; sent < total;) {
+        // The buffer we are about to fill has to be off the wire first
+        err = wait(dma_buf_fence_[current]);
+        ERROR_CHECK(err);
+        // Gather the next chunk, possibly spanning several rows,
+        // while the other buffer is still being transmitted
+        u16* buf = dma_buf_[current];
+        const u32 chunk = std::min(capacity, total - sent);
+        u32 filled = 0;
+        while (filled < chunk) {
+            const u32 n = std::min<u32>(chunk - filled, w - col);
+            const u16* from = src + row * stride + col;
+            if (swap) {
+                swap_copy(buf + filled, from, n);
+            } else {
+                std::memcpy(buf + filled, from, n * 2);
+            }
+            filled += n;
+            col += n;
+            if (col == w) {
+                col = 0;
+                row++;
+            }
+        }
+        Format::pack(reinterpret_cast<u8*>(buf), chunk);
+        err = data(reinterpret_cast<const u8*>(buf), Format::bytes(chunk));
+        ERROR_CHECK(err);
+        dma_buf_fence_[current] = fence();
+        sent += chunk;
+        current ^= 1;
+    }
+    return OK;
+}
+
+/**
+ * @brief Stream `pixels` pixels of `color16` in the active color mode
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::fill_color(const u16 color16, const u32 pixels) const {
+    switch (colmod_) {
+    case COLOR_MODE_MCU_12BIT:
+        return fill_color_as<PixelFormat<COLOR_MODE_MCU_12BIT>>(color16, pixels);
+    case COLOR_MODE_MCU_18BIT:
+        return fill_color_as<PixelFormat<COLOR_MODE_MCU_18BIT>>(color16, pixels);
+    default:
+        return fill_color_as<PixelFormat<COLOR_MODE_MCU_16BIT>>(color16, pixels);
+    }
+}
+
+/**
+ * @brief Stream a `w` x `h` block of pixels in the active color mode
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::write_pixels(const u16* src, const u16 w, const u16 h, const u32 stride, const bool swap) const {
+    switch (colmod_) {
+    case COLOR_MODE_MCU_12BIT:
+        return write_pixels_as<PixelFormat<COLOR_MODE_MCU_12BIT>>(src, w, h, stride, swap);
+    case COLOR_MODE_MCU_18BIT:
+        return write_pixels_as<PixelFormat<COLOR_MODE_MCU_18BIT>>(src, w, h, stride, swap);
+    default:
+        return write_pixels_as<PixelFormat<COLOR_MODE_MCU_16BIT>>(src, w, h, stride, swap);
+    }
+}
+
+/**
+ * @brief Switch the pixel format used on the wire
+ *
+ * Drawing calls keep taking RGB565, only the data sent to the display changes.
+ * GRAM keeps its content. `init()` restores the mode selected in `menuconfig`.
+ *
+ * @param colmod `COLOR_MODE_MCU_12BIT`, `COLOR_MODE_MCU_16BIT` or `COLOR_MODE_MCU_18BIT`
+ * @return `OK` on success, `INVALID_ARGUMENT` for an unknown mode, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::set_color_mode(const u8 colmod) {
+    if (colmod != COLOR_MODE_MCU_12BIT && colmod != COLOR_MODE_MCU_16BIT && colmod != COLOR_MODE_MCU_18BIT) {
         return INVALID_ARGUMENT;
     }
+    Error err = cmd(CMD_COLMOD);
+    ERROR_CHECK(err);
+    err = data(&colmod, 1);
+    ERROR_CHECK(err);
+    colmod_ = colmod;
+    // The repeated fill color is in the old format
+    dma_buf_filled_ = 0;
+    return finish(OK);
+}
+
+/**
+ * @brief Get the pixel format used on the wire
+ * @return One of the `COLOR_MODE_MCU_*` values
+ */
+u8 GC9A01::color_mode() const {
+    return colmod_;
+}
+
+#ifdef CONFIG_GC9A01_ROUND_MASK
+/**
+ * @brief Enable or disable skipping of the invisible corners of the round panel
+ * @param enable `true` to only send pixels behind the glass
+ */
+void GC9A01::set_round_mask(const bool enable) {
+    round_mask_ = enable;
+}
+#endif
+
+/**
+ * @brief Send a solid area to the display
+ *
+ * With the round mask enabled only the visible bands of the area are sent.
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::send_fill(const u16 x, const u16 y, const u16 w, const u16 h, const u16 color16) const {
+    Error err;
+#ifdef CONFIG_GC9A01_ROUND_MASK
+    if (round_mask_) {
+        Band band;
+        u16 row = y;
+        while (next_visible_band(x, w, row, y + h, band)) {
+            err = set_write_window(band.x, band.y, band.w, band.h);
+            ERROR_CHECK(err);
+            err = fill_color(color16, static_cast<u32>(band.w) * band.h);
+            ERROR_CHECK(err);
+        }
+        return OK;
+    }
+#endif
+    err = set_write_window(x, y, w, h);
+    ERROR_CHECK(err);
+    return fill_color(color16, static_cast<u32>(w) * h);
+}
+
+/**
+ * @brief Send a block of pixels to the display
+ *
+ * With the round mask enabled only the visible bands of the block are sent.
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::send_pixels(const u16 x, const u16 y, const u16 w, const u16 h, const u16* src, const u32 stride, const bool swap) const {
     Error err;
-    err = set_write_window(x, y, 1, 1);
+#ifdef CONFIG_GC9A01_ROUND_MASK
+    if (round_mask_) {
+        Band band;
+        u16 row = y;
+        while (next_visible_band(x, w, row, y + h, band)) {
+            err = set_write_window(band.x, band.y, band.w, band.h);
+            ERROR_CHECK(err);
+            err = write_pixels(src + (band.y - y) * stride + (band.x - x), band.w, band.h, stride, swap);
+            ERROR_CHECK(err);
+        }
+        return OK;
+    }
+#endif
+    err = set_write_window(x, y, w, h);
     ERROR_CHECK(err);
-    u16 color16 = color.to_16bit();
-    u8 buf[2] = {static_cast<u8>(color16 >> 8), static_cast<u8>(color16 & 0xFF)};
-    err = data(buf, 2);
+    return write_pixels(src, w, h, stride, swap);
+}
+
+/**
+ * @brief Fill an on-screen area with `color16`
+ *
+ * In buffer mode the framebuffer is written and the area marked dirty, in band
+ * mode the fill is recorded, in direct mode the area is sent to the display right away.
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::fill_area(const u16 x, const u16 y, const u16 w, const u16 h, const u16 color16) const {
+    if (w == 0 || h == 0) {
+        return OK;
+    }
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    // Do not modify what an asynchronous flush is still sending
+    Error err = wait(fb_fence_);
+    ERROR_CHECK(err);
+    const u16 swapped = static_cast<u16>((color16 >> 8) | (color16 << 8));
+    for (u32 row = y; row < static_cast<u32>(y) + h; row++) {
+        std::fill_n(fb_ + row * GC9A01_WIDTH + x, w, swapped);
+    }
+    mark_dirty(x, y, w, h);
+    return OK;
+#elif defined(CONFIG_GC9A01_BAND_MODE)
+    return record_fill(x, y, w, h, color16);
+#else
+    return send_fill(x, y, w, h, color16);
+#endif
+}
+
+/**
+ * @brief Copy a block of pixels to an on-screen area
+ *
+ * Rows of `src` are `stride` pixels apart, `swap` is `false` if they are stored big-endian.
+ * In band mode `src` is only read by the next `flush()`.
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::blit_area(const u16 x, const u16 y, const u16 w, const u16 h, const u16* src, const u32 stride, const bool swap) const {
+    if (w == 0 || h == 0) {
+        return OK;
+    }
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    Error err = wait(fb_fence_);
     ERROR_CHECK(err);
+    for (u32 row = 0; row < h; row++) {
+        u16* dst = fb_ + (y + row) * GC9A01_WIDTH + x;
+        if (swap) {
+            swap_copy(dst, src + row * stride, w);
+        } else {
+            std::memcpy(dst, src + row * stride, w * 2);
+        }
+    }
+    mark_dirty(x, y, w, h);
     return OK;
+#elif defined(CONFIG_GC9A01_BAND_MODE)
+    return record({src, static_cast<i16>(x), static_cast<i16>(y), w, h, static_cast<u16>(stride), OP_BITMAP, swap},
+                  {x, y, static_cast<u16>(x + w), static_cast<u16>(y + h)});
+#else
+    return send_pixels(x, y, w, h, src, stride, swap);
+#endif
 }
 
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+/**
+ * @brief Add an area to the dirty rectangles
+ *
+ * Rectangles that overlap or touch are merged. If no slot is left the new
+ * area is merged into the rectangle whose bounding box grows the least.
+ */
+void GC9A01::mark_dirty(const u16 x, const u16 y, const u16 w, const u16 h) const {
+    Rect rect = {x, y, static_cast<u16>(x + w), static_cast<u16>(y + h)};
+    const auto touches = [](const Rect& a, const Rect& b) {
+        return a.x0 <= b.x1 && b.x0 <= a.x1 && a.y0 <= b.y1 && b.y0 <= a.y1;
+    };
+    const auto merge = [](Rect& a, const Rect& b) {
+        a.x0 = std::min(a.x0, b.x0);
+        a.y0 = std::min(a.y0, b.y0);
+        a.x1 = std::max(a.x1, b.x1);
+        a.y1 = std::max(a.y1, b.y1);
+    };
+
+    // Keep merging until `rect` does not touch any other rectangle
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (u8 i = 0; i < dirty_count_; i++) {
+            if (touches(dirty_[i], rect)) {
+                merge(rect, dirty_[i]);
+                dirty_[i] = dirty_[--dirty_count_];
+                merged = true;
+                break;
+            }
+        }
+    }
 
+    if (dirty_count_ == GC9A01_MAX_DIRTY_RECTS) {
+        u8 best = 0;
+        u32 best_growth = UINT32_MAX;
+        for (u8 i = 0; i < dirty_count_; i++) {
+            Rect u = dirty_[i];
+            merge(u, rect);
+            const u32 growth = static_cast<u32>(u.x1 - u.x0) * (u.y1 - u.y0)
+                - static_cast<u32>(dirty_[i].x1 - dirty_[i].x0) * (dirty_[i].y1 - dirty_[i].y0);
+            if (growth < best_growth) {
+                best_growth = growth;
+                best = i;
+            }
+        }
+        merge(rect, dirty_[best]);
+        dirty_[best] = dirty_[--dirty_count_];
+        // The grown rectangle may touch others now
+        mark_dirty(rect.x0, rect.y0, rect.x1 - rect.x0, rect.y1 - rect.y0);
+        return;
+    }
+    dirty_[dirty_count_++] = rect;
+}
+#endif
+
+#ifdef CONFIG_GC9A01_DIFF_FLUSH
 /**
- * @brief Clear the screen buffer
+ * @brief Index of the first pixel from `x` on where `a` and `b` differ (`same`) or match
+ *
+ * Both rows have the same alignment, so whole pairs of pixels are compared as 32-bit words.
+ *
+ * @return First such index, `end` if there is none
+ */
+static u16 scan_row(const u16* a, const u16* b, u16 x, const u16 end, const bool same) {
+    if ((x & 1) && x < end) {
+        if ((a[x] == b[x]) != same) {
+            return x;
+        }
+        x++;
+    }
+    const u32* a32 = reinterpret_cast<const u32*>(a + x);
+    const u32* b32 = reinterpret_cast<const u32*>(b + x);
+    for (; x + 1 < end; x += 2, a32++, b32++) {
+        const u32 changed = *a32 ^ *b32;
+        // A run of changes ends at the first pixel of the pair that matches
+        if (same ? changed != 0 : (changed & 0xFFFF) == 0 || (changed >> 16) == 0) {
+            break;
+        }
+    }
+    // One of the two pixels may still fit `same`
+    for (; x < end; x++) {
+        if ((a[x] == b[x]) != same) {
+            return x;
+        }
+    }
+    return end;
+}
+
+/**
+ * @brief Send the pixels of a dirty rectangle that differ from the last frame
+ *
+ * Each row is split into runs of changed pixels. Runs are combined into one
+ * area, both along a row and across rows, as long as the unchanged pixels
+ * that get resent cost less than a new write window (`WINDOW_COST_PIXELS`).
+ * What is sent is copied to `shadow_`.
+ *
  * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
  */
-GC9A01::Error GC9A01::clear() const {
-    return fill(Color(0, 0, 0));
+GC9A01::Error GC9A01::send_changed(const Rect& rect) const {
+    // Area collected so far, `pixels` of it changed
+    Rect area = {0, 0, 0, 0};
+    u32 pixels = 0;
+    const auto send = [&]() {
+        if (pixels == 0) {
+            return OK;
+        }
+        for (u32 row = area.y0; row < area.y1; row++) {
+            std::memcpy(shadow_ + row * GC9A01_WIDTH + area.x0, fb_ + row * GC9A01_WIDTH + area.x0, (area.x1 - area.x0) * 2);
+        }
+        pixels = 0;
+        return send_pixels(area.x0, area.y0, area.x1 - area.x0, area.y1 - area.y0,
+                           fb_ + area.y0 * GC9A01_WIDTH + area.x0, GC9A01_WIDTH, false);
+    };
+
+    Error err;
+    for (u16 y = rect.y0; y < rect.y1; y++) {
+        const u16* cur = fb_ + y * GC9A01_WIDTH;
+        const u16* old = shadow_ + y * GC9A01_WIDTH;
+        u16 x = scan_row(cur, old, rect.x0, rect.x1, true);
+        while (x < rect.x1) {
+            const u16 start = x;
+            x = scan_row(cur, old, x, rect.x1, false);
+            const u16 end = x;
+            x = scan_row(cur, old, x, rect.x1, true);
+
+            const Rect run = {start, y, end, static_cast<u16>(y + 1)};
+            if (pixels > 0) {
+                const Rect grown = {
+                    std::min(area.x0, run.x0), area.y0,
+                    std::max(area.x1, run.x1), run.y1
+                };
+                // Unchanged pixels the grown area adds, negative if the run was already covered
+                const i32 added = static_cast<i32>((grown.x1 - grown.x0) * (grown.y1 - grown.y0))
+                    - static_cast<i32>((area.x1 - area.x0) * (area.y1 - area.y0)) - (end - start);
+                if (added <= WINDOW_COST_PIXELS) {
+                    area = grown;
+                    pixels += end - start;
+                    continue;
+                }
+                err = send();
+                ERROR_CHECK(err);
+            }
+            area = run;
+            pixels = end - start;
+        }
+    }
+    return send();
+}
+#endif
+
+/**
+ * @brief Send the dirty area of the framebuffer to the display
+ *
+ * Each dirty rectangle costs one write window. Rectangles spanning the full
+ * width are contiguous in the framebuffer and are sent without copying.
+ * In band mode the display list is rendered, see `render_list()`.
+ * Does nothing in direct mode.
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::flush() const {
+    PRIMITIVE(PRIM_FLUSH);
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    Error err;
+#ifdef CONFIG_GC9A01_DIFF_FLUSH
+    if (!shadow_valid_) {
+        // GRAM is unknown, send the whole frame once
+        mark_dirty(0, 0, GC9A01_WIDTH, GC9A01_HEIGHT);
+    }
+#endif
+    while (dirty_count_ > 0) {
+        const Rect& r = dirty_[dirty_count_ - 1];
+#ifdef CONFIG_GC9A01_DIFF_FLUSH
+        if (shadow_valid_) {
+            err = send_changed(r);
+            ERROR_CHECK(err);
+            fb_fence_ = fence();
+            dirty_count_--;
+            continue;
+        }
+        for (u32 row = r.y0; row < r.y1; row++) {
+            std::memcpy(shadow_ + row * GC9A01_WIDTH + r.x0, fb_ + row * GC9A01_WIDTH + r.x0, (r.x1 - r.x0) * 2);
+        }
+#endif
+        err = send_pixels(r.x0, r.y0, r.x1 - r.x0, r.y1 - r.y0, fb_ + r.y0 * GC9A01_WIDTH + r.x0, GC9A01_WIDTH, false);
+        ERROR_CHECK(err);
+        fb_fence_ = fence();
+        dirty_count_--;
+    }
+#ifdef CONFIG_GC9A01_DIFF_FLUSH
+    shadow_valid_ = true;
+#endif
+#elif defined(CONFIG_GC9A01_BAND_MODE)
+    Error err = render_list();
+    // The next frame starts over
+    rendered_early_ = false;
+    ERROR_CHECK(err);
+#endif
+    return finish(OK);
+}
+
+/**
+ * @brief Fill the part of an area that is on screen with `color16`
+ *
+ * All drawing goes through here, so shapes may be partly or fully off-screen.
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::clip_fill(i32 x, i32 y, i32 w, i32 h, const u16 color16) const {
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    w = std::min<i32>(w, GC9A01_WIDTH - x);
+    h = std::min<i32>(h, GC9A01_HEIGHT - y);
+    if (w <= 0 || h <= 0) {
+        return OK;
+    }
+    return fill_area(x, y, w, h, color16);
+}
+
+/**
+ * @brief Copy the part of a `w` x `h` block of pixels that is on screen
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::clip_blit(i32 x, i32 y, i32 w, i32 h, const u16* src, const bool swap) const {
+    const u32 stride = w;
+    if (x < 0) {
+        src -= x;
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        src -= y * static_cast<i32>(stride);
+        h += y;
+        y = 0;
+    }
+    w = std::min<i32>(w, GC9A01_WIDTH - x);
+    h = std::min<i32>(h, GC9A01_HEIGHT - y);
+    if (w <= 0 || h <= 0) {
+        return OK;
+    }
+    return blit_area(x, y, w, h, src, stride, swap);
 }
 
 /**
@@ -520,102 +1575,61 @@ GC9A01::Error GC9A01::clear() const {
  * @param w width of the bitmap
  * @param h height of the bitmap
  * @param bitmap 16-bit color array of the bitmap with size `w * h`
- * @return `OK` on success, `INVALID_ARGUMENT` if the arguments are invalid, else `SPI_TRANSMIT_ERROR`
+ * @return `OK` on success, `INVALID_ARGUMENT` if `bitmap` is `nullptr`, else `SPI_TRANSMIT_ERROR`
  */
-GC9A01::Error GC9A01::draw_bitmap(const u16 x, const u16 y, u16 w, u16 h, const u16* bitmap) const {
+GC9A01::Error GC9A01::draw_bitmap(const i16 x, const i16 y, const u16 w, const u16 h, const u16* bitmap) const {
+    PRIMITIVE(PRIM_BITMAP);
     if (bitmap == nullptr) {
         return INVALID_ARGUMENT;
     }
-    if (x >= GC9A01_WIDTH || y >= GC9A01_HEIGHT) {
-        return INVALID_ARGUMENT;
-    }
-    if (x + w > GC9A01_WIDTH || y + h > GC9A01_HEIGHT) {
-        w = std::min(w, static_cast<u16>(GC9A01_WIDTH - x));
-        h = std::min(h, static_cast<u16>(GC9A01_HEIGHT - y));
-    }
-    Error err;
-    err = set_write_window(x, y, w, h);
-    ERROR_CHECK(err);
-    for (u32 i = 0; i < w * h; i++) {
-        u16 color16 = bitmap[i];
-        u8 buf[2] = {static_cast<u8>(color16 >> 8), static_cast<u8>(color16 & 0xFF)};
-        err = data(buf, 2);
-        ERROR_CHECK(err);
-    }
-    return OK;
+    return finish(clip_blit(x, y, w, h, bitmap, true));
 }
 
 /**
- * @brief Draw a horizontal line at `x`, `y` with a width of `w` and a `color`
+ * @brief Draw a bitmap at `x`, `y` whose pixels are already stored big-endian
+ *
+ * Same as `draw_bitmap()` but without the byte swap. If the bitmap is fully
+ * on screen and lies in DMA capable memory it is sent without any copy.
+ *
  * @param x `x` coordinate
  * @param y `y` coordinate
- * @param w width
- * @param color Color of the line
- * @return `OK` on success, `INVALID_ARGUMENT` if the arguments are invalid, else `SPI_TRANSMIT_ERROR`
+ * @param w width of the bitmap
+ * @param h height of the bitmap
+ * @param bitmap big-endian 16-bit color array of the bitmap with size `w * h`
+ * @return `OK` on success, `INVALID_ARGUMENT` if `bitmap` is `nullptr`, else `SPI_TRANSMIT_ERROR`
  */
-GC9A01::Error GC9A01::draw_hline(const u16 x, const u16 y, u16 w, const Color color) const {
-    if (x >= GC9A01_WIDTH || y >= GC9A01_HEIGHT) {
+GC9A01::Error GC9A01::draw_bitmap_be(const i16 x, const i16 y, const u16 w, const u16 h, const u16* bitmap) const {
+    PRIMITIVE(PRIM_BITMAP);
+    if (bitmap == nullptr) {
         return INVALID_ARGUMENT;
     }
-    if (x + w > GC9A01_WIDTH) {
-        w = GC9A01_WIDTH - x;
-    }
-    Error err;
-    err = set_write_window(x, y, w, 1);
-    ERROR_CHECK(err);
-    u16 color16 = color.to_16bit();
-    u8 buf[2] = {static_cast<u8>(color16 >> 8), static_cast<u8>(color16 & 0xFF)};
-    for (u32 i = 0; i < w; i++) {
-        err = data(buf, 2);
-        ERROR_CHECK(err);
-    }
-    return OK;
+    return finish(clip_blit(x, y, w, h, bitmap, false));
 }
 
 /**
- * @brief Draw a vertical line at `x`, `y` with a height of `h` and a `color`
+ * @brief Draw a horizontal line at `x`, `y` with a width of `w` and a `color`
  * @param x `x` coordinate
  * @param y `y` coordinate
- * @param h height
+ * @param w width
  * @param color Color of the line
- * @return `OK` on success, `INVALID_ARGUMENT` if the arguments are invalid, else `SPI_TRANSMIT_ERROR`
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
  */
-GC9A01::Error GC9A01::draw_vline(const u16 x, const u16 y, u16 h, const Color color) const {
-    if (x >= GC9A01_WIDTH || y >= GC9A01_HEIGHT) {
-        return INVALID_ARGUMENT;
-    }
-    if (y + h > GC9A01_HEIGHT) {
-        h = GC9A01_HEIGHT - y;
-    }
-    Error err;
-    err = set_write_window(x, y, 1, h);
-    ERROR_CHECK(err);
-    u16 color16 = color.to_16bit();
-    u8 buf[2] = {static_cast<u8>(color16 >> 8), static_cast<u8>(color16 & 0xFF)};
-    for (u32 i = 0; i < h; i++) {
-        err = data(buf, 2);
-        ERROR_CHECK(err);
-    }
-    return OK;
+GC9A01::Error GC9A01::draw_hline(const i16 x, const i16 y, const u16 w, const Color color) const {
+    PRIMITIVE(PRIM_HLINE);
+    return finish(clip_fill(x, y, w, 1, color.to_16bit()));
 }
 
 /**
- * @brief Draw a line from `x0`, `y0` to `x1`, `y1` with a `color`
- * **NOTE**: Not implemented
- * @param x0 `x0` coordinate
- * @param y0 `y0` coordinate
- * @param x1 `x1` coordinate
- * @param y1 `y1` coordinate
+ * @brief Draw a vertical line at `x`, `y` with a height of `h` and a `color`
+ * @param x `x` coordinate
+ * @param y `y` coordinate
+ * @param h height
  * @param color Color of the line
- * @return `OK` on success, `INVALID_ARGUMENT` if the arguments are invalid, else `SPI_TRANSMIT_ERROR`
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
  */
-GC9A01::Error GC9A01::draw_line(u16 x0, u16 y0, u16 x1, u16 y1, const Color color) const {
-    if (x0 >= GC9A01_WIDTH || y0 >= GC9A01_HEIGHT || x1 >= GC9A01_WIDTH || y1 >= GC9A01_HEIGHT) {
-        return INVALID_ARGUMENT;
-    }
-    // TODO: Implement
-    // Error err;
-    return OK;
+GC9A01::Error GC9A01::draw_vline(const i16 x, const i16 y, const u16 h, const Color color) const {
+    PRIMITIVE(PRIM_VLINE);
+    return finish(clip_fill(x, y, 1, h, color.to_16bit()));
 }
 
 /**
@@ -626,26 +1640,31 @@ GC9A01::Error GC9A01::draw_line(u16 x0, u16 y0, u16 x1, u16 y1, const Color colo
  * @param w width of the rectangle
  * @param h height of the rectangle
  * @param color Color of the rectangle
- * @return `OK` on success, `INVALID_ARGUMENT` if the arguments are invalid, else `SPI_TRANSMIT_ERROR`
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
  */
-GC9A01::Error GC9A01::draw_rect(u16 x, u16 y, u16 w, u16 h, const Color color) const {
-    if (x >= GC9A01_WIDTH || y >= GC9A01_HEIGHT) {
-        return INVALID_ARGUMENT;
-    }
-    if (x + w > GC9A01_WIDTH || y + h > GC9A01_HEIGHT) {
-        w = std::min(w, static_cast<u16>(GC9A01_WIDTH - x));
-        h = std::min(h, static_cast<u16>(GC9A01_HEIGHT - y));
+GC9A01::Error GC9A01::draw_rect(const i16 x, const i16 y, const u16 w, const u16 h, const Color color) const {
+    PRIMITIVE(PRIM_RECT);
+    if (w == 0 || h == 0) {
+        return OK;
     }
+    const u16 color16 = color.to_16bit();
     Error err;
-    err = draw_hline(x, y, w, color);
-    ERROR_CHECK(err);
-    err = draw_hline(x, y + h - 1, w, color);
-    ERROR_CHECK(err);
-    err = draw_vline(x, y, h, color);
+    err = clip_fill(x, y, w, 1, color16);
     ERROR_CHECK(err);
-    err = draw_vline(x + w - 1, y, h, color);
-    ERROR_CHECK(err);
-    return OK;
+    if (h > 1) {
+        err = clip_fill(x, y + h - 1, w, 1, color16);
+        ERROR_CHECK(err);
+    }
+    // The sides without the corners already drawn
+    if (h > 2) {
+        err = clip_fill(x, y + 1, 1, h - 2, color16);
+        ERROR_CHECK(err);
+        if (w > 1) {
+            err = clip_fill(x + w - 1, y + 1, 1, h - 2, color16);
+            ERROR_CHECK(err);
+        }
+    }
+    return finish(OK);
 }
 
 /**
@@ -656,84 +1675,9 @@ GC9A01::Error GC9A01::draw_rect(u16 x, u16 y, u16 w, u16 h, const Color color) c
  * @param w width of the rectangle
  * @param h height of the rectangle
  * @param color Color of the rectangle
- * @return `OK` on success, `INVALID_ARGUMENT` if the arguments are invalid, else `SPI_TRANSMIT_ERROR`
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
  */
-GC9A01::Error GC9A01::fill_rect(u16 x, u16 y, u16 w, u16 h, const Color color) const {
-    if (x >= GC9A01_WIDTH || y >= GC9A01_HEIGHT) {
-        return INVALID_ARGUMENT;
-    }
-    if (x + w > GC9A01_WIDTH || y + h > GC9A01_HEIGHT) {
-        w = std::min(w, static_cast<u16>(GC9A01_WIDTH - x));
-        h = std::min(h, static_cast<u16>(GC9A01_HEIGHT - y));
-    }
-    Error err;
-    u16 color16 = color.to_16bit();
-    u8 buf[2] = {static_cast<u8>(color16 >> 8), static_cast<u8>(color16 & 0xFF)};
-    err = set_write_window(x, y, w, h);
-    for (u32 i = 0; i < h * w; i++) {
-        err = data(buf, 2);
-        ERROR_CHECK(err);
-    }
-    return OK;
-}
-
-
-// // Example (pseudocode for Midpoint Circle Algorithm):
-// void drawCircle(int16_t x0, int16_t y0, int16_t radius, uint16_t color) {
-//     int16_t x = radius;
-//     int16_t y = 0;
-//     int16_t err = 0;
-// 
-//     while (x >= y) {
-//         set_pixel(x0 + x, y0 + y, color);
-//         set_pixel(x0 + y, y0 + x, color);
-//         set_pixel(x0 - y, y0 + x, color);
-//         set_pixel(x0 - x, y0 + y, color);
-//         set_pixel(x0 - x, y0 - y, color);
-//         set_pixel(x0 - y, y0 - x, color);
-//         set_pixel(x0 + y, y0 - x, color);
-//         set_pixel(x0 + x, y0 - y, color);
-// 
-//         if (err <= 0) {
-//             y += 1;
-//             err += 2 * y + 1;
-//         }
-// 
-//         if (err > 0) {
-//             x -= 1;
-//             err -= 2 * x + 1;
-//         }
-//     }
-// }
-
-GC9A01::Error GC9A01::draw_circle(u16 x0, u16 y0, u16 r, const Color color) const {
-    // NOTE: Proof of concept, not optimized
-    // TODO: Optimize
-    if (x0 >= GC9A01_WIDTH || y0 >= GC9A01_HEIGHT) {
-        return INVALID_ARGUMENT;
-    }
-    i16 x = r;
-    i16 y = 0;
-    i16 err = 0;
-    while (x >= y) {
-        set_pixel(x0 + x, y0 + y, color);
-        set_pixel(x0 + y, y0 + x, color);
-        set_pixel(x0 - y, y0 + x, color);
-        set_pixel(x0 - x, y0 + y, color);
-        set_pixel(x0 - x, y0 - y, color);
-        set_pixel(x0 - y, y0 - x, color);
-        set_pixel(x0 + y, y0 - x, color);
-        set_pixel(x0 + x, y0 - y, color);
-
-        if (err <= 0) {
-            y += 1;
-            err += 2 * y + 1;
-        }
-        if (err > 0) {
-            x -= 1;
-            err -= 2 * x + 1;
-        }
-    }    
-    return OK;
+GC9A01::Error GC9A01::fill_rect(const i16 x, const i16 y, const u16 w, const u16 h, const Color color) const {
+    PRIMITIVE(PRIM_FILL_RECT);
+    return finish(clip_fill(x, y, w, h, color.to_16bit()));
 }
-
@@ -0,0 +1,310 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_animation.cpp
+ * @brief Player of delta-coded animations, paced by `present()`
+ */
+
+#include <algorithm>
+
+#include "gc9a01_animation.h"
+
+static inline u16 read16(const u8* p) {
+    return static_cast<u16>((p[0] << 8) | p[1]);
+}
+
+static inline u32 read32(const u8* p) {
+    return (static_cast<u32>(p[0]) << 24) | (static_cast<u32>(p[1]) << 16) | (static_cast<u32>(p[2]) << 8) | p[3];
+}
+
+GC9A01Animation::GC9A01Animation(GC9A01& display) : display_(display) {}
+
+GC9A01Animation::~GC9A01Animation() {
+    close();
+}
+
+/**
+ * @brief Open an animation in memory
+ *
+ * Sets the frame rate of the display to the one of the animation.
+ *
+ * @param data Animation written by `tools/gc9a01_animconv.py`, e.g. in flash or a memory-mapped partition
+ * @param size Size of `data` in bytes
+ * @return `OK` on success, `INVALID_ARGUMENT` if `data` has no valid header
+ */
+GC9A01Animation::Error GC9A01Animation::open(const u8* data, const u32 size) {
+    close();
+    if (data == nullptr) {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    Error err = open_header(data, size);
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    data_ = data;
+    return GC9A01::OK;
+}
+
+/**
+ * @brief Open an animation read through `read`
+ *
+ * Sets the frame rate of the display to the one of the animation.
+ *
+ * @param read Called for the header and for each frame
+ * @param arg Passed to `read`
+ * @param size Size of the animation in bytes
+ * @return `OK` on success, `INVALID_ARGUMENT` if the header cannot be read or is not valid,
+ *         `OUT_OF_MEMORY` if the frame buffer could not be allocated
+ */
+GC9A01Animation::Error GC9A01Animation::open(const ReadFunction read, void* arg, const u32 size) {
+    close();
+    u8 header[GC9A01_ANIMATION_HEADER_SIZE];
+    if (read == nullptr || size < sizeof(header) || !read(arg, 0, header, sizeof(header))) {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    Error err = open_header(header, size);
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    buf_ = static_cast<u8*>(heap_caps_malloc(max_frame_, MALLOC_CAP_8BIT));
+    if (buf_ == nullptr) {
+        close();
+        return GC9A01::OUT_OF_MEMORY;
+    }
+    read_ = read;
+    read_arg_ = arg;
+    return GC9A01::OK;
+}
+
+/**
+ * @brief Check the header and start at the first frame
+ * @return `OK` on success, else `INVALID_ARGUMENT`
+ */
+GC9A01Animation::Error GC9A01Animation::open_header(const u8* header, const u32 size) {
+    if (size < GC9A01_ANIMATION_HEADER_SIZE
+        || header[0] != 'G' || header[1] != '5' || header[2] != 'A' || header[3] != 'N') {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    width_ = read16(header + 4);
+    height_ = read16(header + 6);
+    frames_ = read16(header + 8);
+    fps_ = read16(header + 10);
+    max_frame_ = read32(header + 12);
+    if (frames_ == 0 || max_frame_ < GC9A01_ANIMATION_FRAME_HEADER_SIZE - 4) {
+        frames_ = 0;
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    size_ = size;
+    display_.set_frame_rate(fps_);
+    due_us_ = 0;
+    stats_ = {};
+    rewind();
+    return GC9A01::OK;
+}
+
+/**
+ * @brief Close the animation and free the frame buffer
+ */
+void GC9A01Animation::close() {
+    heap_caps_free(buf_);
+    buf_ = nullptr;
+    data_ = nullptr;
+    read_ = nullptr;
+    read_arg_ = nullptr;
+    frames_ = 0;
+    rewind();
+}
+
+/**
+ * @brief Set where the top left corner of the animation is drawn, 0, 0 by default
+ */
+void GC9A01Animation::set_position(const i16 x, const i16 y) {
+    x_ = x;
+    y_ = y;
+}
+
+/**
+ * @brief Read the next frame, straight from memory or into the frame buffer
+ *
+ * @param frame Set to the rectangles of the frame
+ * @param size Set to the size of the rectangles in bytes
+ * @return `OK` on success, else `INVALID_ARGUMENT`
+ */
+GC9A01Animation::Error GC9A01Animation::load_frame(const u8*& frame, u32& size) {
+    u8 field[4];
+    if (size_ - offset_ < sizeof(field)) {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    if (data_ != nullptr) {
+        std::copy_n(data_ + offset_, sizeof(field), field);
+    } else if (!read_(read_arg_, offset_, field, sizeof(field))) {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    size = read32(field);
+    if (size > max_frame_ || size_ - offset_ - sizeof(field) < size) {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    if (data_ != nullptr) {
+        frame = data_ + offset_ + sizeof(field);
+    } else if (read_(read_arg_, offset_ + sizeof(field), buf_, size)) {
+        frame = buf_;
+    } else {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    offset_ += sizeof(field) + size;
+    frame_++;
+    stats_.bytes += sizeof(field) + size;
+    return GC9A01::OK;
+}
+
+/**
+ * @brief Draw the rectangles of a frame
+ * @return `OK` on success, `INVALID_ARGUMENT` if the frame is not valid, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01Animation::Error GC9A01Animation::draw_frame(const u8* frame, const u32 size) const {
+    if (size < 2) {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    const u16 count = read16(frame);
+    const u8* pos = frame + 2;
+    const u8* end = frame + size;
+    for (u16 i = 0; i < count; i++) {
+        if (end - pos < GC9A01_ANIMATION_RECT_HEADER_SIZE) {
+            return GC9A01::INVALID_ARGUMENT;
+        }
+        const i32 x = x_ + read16(pos);
+        const i32 y = y_ + read16(pos + 2);
+        const u32 image_size = read32(pos + 4);
+        pos += GC9A01_ANIMATION_RECT_HEADER_SIZE;
+        if (static_cast<u32>(end - pos) < image_size || x > INT16_MAX || y > INT16_MAX) {
+            return GC9A01::INVALID_ARGUMENT;
+        }
+        Error err = display_.draw_image(x, y, pos, image_size);
+        if (err != GC9A01::OK) {
+            return err;
+        }
+#ifdef CONFIG_GC9A01_BAND_MODE
+        // `flush()` fills the bounding box of the list, the pixels between rectangles have to stay
+        if (i + 1 < count) {
+            err = display_.flush();
+            if (err != GC9A01::OK) {
+                return err;
+            }
+        }
+#endif
+        pos += image_size;
+    }
+    return GC9A01::OK;
+}
+
+/**
+ * @brief Draw the next frame and present it
+ *
+ * Waits for the slot of the frame like `present()` does. In buffer mode a
+ * frame that is drawn more than half a period after its slot is not sent on
+ * its own, it goes out with the next frame. After the last frame nothing
+ * happens until `rewind()`.
+ *
+ * @return `OK` on success, `INVALID_ARGUMENT` if the frame cannot be read or is not valid,
+ *         else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01Animation::Error GC9A01Animation::play_frame() {
+    if (finished()) {
+        return GC9A01::OK;
+    }
+    const i64 start = esp_timer_get_time();
+    const u8* frame;
+    u32 size;
+    Error err = load_frame(frame, size);
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    err = draw_frame(frame, size);
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    const i64 now = esp_timer_get_time();
+    stats_.last_frame_us = static_cast<u32>(now - start);
+    stats_.max_frame_us = std::max(stats_.max_frame_us, stats_.last_frame_us);
+
+    const i64 period = fps_ > 0 ? 1000000 / fps_ : 0;
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    // The framebuffer keeps the frame, the next one is drawn on top and both go out together.
+    // The next slot starts from now, a source that is slow for good still shows every other frame.
+    if (period > 0 && due_us_ != 0 && now > due_us_ + period / 2 && !finished()) {
+        stats_.dropped++;
+        due_us_ = now + period;
+        return GC9A01::OK;
+    }
+#endif
+    err = display_.present();
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    stats_.shown++;
+    // `present()` starts a late frame right away and continues from there
+    due_us_ = std::max(due_us_, now) + period;
+    return GC9A01::OK;
+}
+
+/**
+ * @brief Play the animation from the first frame, `loops` times
+ *
+ * @param loops Times to play the animation, 0 to play it until an error occurs
+ * @return `OK` on success, else the error of `play_frame()`
+ */
+GC9A01Animation::Error GC9A01Animation::play(const u32 loops) {
+    if (frames_ == 0) {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    for (u32 loop = 0; loops == 0 || loop < loops; loop++) {
+        rewind();
+        while (!finished()) {
+            Error err = play_frame();
+            if (err != GC9A01::OK) {
+                return err;
+            }
+        }
+    }
+    return GC9A01::OK;
+}
+
+/**
+ * @brief Continue with the first frame, which redraws the whole animation
+ */
+void GC9A01Animation::rewind() {
+    frame_ = 0;
+    offset_ = GC9A01_ANIMATION_HEADER_SIZE;
+}
+
+/**
+ * @brief `true` once the last frame was played or if no animation is open
+ */
+bool GC9A01Animation::finished() const {
+    return frame_ >= frames_;
+}
+
+u16 GC9A01Animation::width() const {
+    return width_;
+}
+
+u16 GC9A01Animation::height() const {
+    return height_;
+}
+
+u16 GC9A01Animation::frame_count() const {
+    return frames_;
+}
+
+u16 GC9A01Animation::frame_rate() const {
+    return fps_;
+}
+
+const GC9A01Animation::Stats& GC9A01Animation::stats() const {
+    return stats_;
+}
+
+void GC9A01Animation::reset_stats() {
+    stats_ = {};
+}
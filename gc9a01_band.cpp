@@ -0,0 +1,441 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_band.cpp
+ * @brief Band mode: drawing calls are recorded and rendered band by band on `flush()`
+ *
+ * Instead of a framebuffer, drawing calls go into a display list. Circles,
+ * bitmaps, compressed images and sprites, rotated or not, take one entry
+ * each, everything else is recorded as solid areas, where consecutive areas
+ * of one color share an entry. `flush()` renders the bounding box of the
+ * list into the two DMA buffers, a band of rows at a time, and sends each
+ * band while the next one is rendered. The whole frame is composited before
+ * it reaches the display, in `2 * GC9A01_DMA_BUFFER_PIXELS` pixels plus the
+ * list.
+ */
+
+#include <cstring>
+#include <algorithm>
+
+#include "gc9a01.h"
+#include "gc9a01_private.h"
+
+#ifdef CONFIG_GC9A01_BAND_MODE
+
+static_assert(GC9A01_WIDTH <= 255 && GC9A01_HEIGHT <= 255, "Fill areas are stored as 8-bit values");
+
+/**
+ * @brief Set the color of the pixels no recorded drawing call covers
+ *
+ * `flush()` sends the bounding box of everything drawn since the last flush,
+ * the rest of that box is filled with the background.
+ *
+ * @param color Background color, black by default
+ */
+void GC9A01::set_background(const Color color) {
+    const u16 color16 = color.to_16bit();
+    background_ = static_cast<u16>((color16 >> 8) | (color16 << 8));
+}
+
+/**
+ * @brief Append an operation to the display list
+ *
+ * If the list is full, what was recorded so far is rendered first.
+ *
+ * @param op Operation to record
+ * @param area On-screen area the operation draws to
+ * @return `OK` on success, `OUT_OF_MEMORY` if an early render could not allocate
+ *         its pixel map, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::record(const DrawOp& op, const Rect& area) const {
+    if (list_count_ == CONFIG_GC9A01_DISPLAY_LIST_SIZE) {
+        Error err = render_early();
+        ERROR_CHECK(err);
+    }
+    list_[list_count_++] = op;
+    record_area(area);
+    return OK;
+}
+
+/**
+ * @brief Grow the bounding box of the display list by `area`
+ */
+void GC9A01::record_area(const Rect& area) const {
+    list_area_.x0 = std::min(list_area_.x0, area.x0);
+    list_area_.y0 = std::min(list_area_.y0, area.y0);
+    list_area_.x1 = std::max(list_area_.x1, area.x1);
+    list_area_.y1 = std::max(list_area_.y1, area.y1);
+}
+
+/**
+ * @brief Record a solid area, already clipped to the screen
+ *
+ * Continues the last operation if it is a fill of the same color.
+ *
+ * @return `OK` on success, `OUT_OF_MEMORY` if an early render could not allocate
+ *         its pixel map, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::record_fill(const u16 x, const u16 y, const u16 w, const u16 h, const u16 color16) const {
+    bool extend = list_count_ > 0 && list_[list_count_ - 1].type == OP_FILL && list_[list_count_ - 1].value == color16;
+    if (fill_count_ == CONFIG_GC9A01_DISPLAY_LIST_FILLS || (!extend && list_count_ == CONFIG_GC9A01_DISPLAY_LIST_SIZE)) {
+        Error err = render_early();
+        ERROR_CHECK(err);
+        extend = false;
+    }
+    if (!extend) {
+        list_[list_count_++] = {nullptr, 0, 0, fill_count_, 0, color16, OP_FILL, false};
+    }
+    list_[list_count_ - 1].h++;
+    fills_[fill_count_++] = {static_cast<u8>(x), static_cast<u8>(y), static_cast<u8>(w), static_cast<u8>(h)};
+    record_area({x, y, static_cast<u16>(x + w), static_cast<u16>(y + h)});
+    return OK;
+}
+
+/**
+ * @brief Record a circle with center `x0`, `y0` and radius `r`
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::record_circle(const i16 x0, const i16 y0, const u16 r, const bool filled, const u16 color16) const {
+    const i32 x = std::max<i32>(x0 - r, 0);
+    const i32 y = std::max<i32>(y0 - r, 0);
+    const i32 x1 = std::min<i32>(x0 + r + 1, GC9A01_WIDTH);
+    const i32 y1 = std::min<i32>(y0 + r + 1, GC9A01_HEIGHT);
+    if (x >= x1 || y >= y1) {
+        return OK;
+    }
+    return record({nullptr, x0, y0, r, r, color16, filled ? OP_FILLED_CIRCLE : OP_CIRCLE, false},
+                  {static_cast<u16>(x), static_cast<u16>(y), static_cast<u16>(x1), static_cast<u16>(y1)});
+}
+
+/**
+ * @brief Render the display list clipped to an area of the screen
+ *
+ * @param buf Destination, `w * h` big-endian RGB565 pixels without padding
+ * @param x `x` coordinate of the area
+ * @param y `y` coordinate of the area
+ * @param w width of the area
+ * @param h height of the area
+ * @param covered If set, gets a bit for each pixel of `buf` an operation draws to
+ */
+void GC9A01::render_area(u16* buf, const u16 x, const u16 y, const u16 w, const u16 h, u32* covered) const {
+    std::fill_n(buf, static_cast<u32>(w) * h, background_);
+    if (covered != nullptr) {
+        std::fill_n(covered, (static_cast<u32>(w) * h + 31) / 32, 0);
+    }
+    const i32 x1 = x + w;
+    const i32 y1 = y + h;
+    // Mark the columns `from` to `to` (exclusive) of `row` as drawn to
+    const auto cover = [&](const i32 row, const i32 from, const i32 to) {
+        if (covered != nullptr) {
+            set_bits(covered, (row - y) * w + (from - x), to - from);
+        }
+    };
+    // Fill the columns `from` to `to` (exclusive) of `row`, clipped to the area
+    const auto span = [&](const i32 row, i32 from, i32 to, const u16 color) {
+        from = std::max<i32>(from, x);
+        to = std::min(to, x1);
+        if (from < to) {
+            std::fill_n(buf + (row - y) * w + (from - x), to - from, color);
+            cover(row, from, to);
+        }
+    };
+
+    for (u16 i = 0; i < list_count_; i++) {
+        const DrawOp& op = list_[i];
+        const u16 swapped = static_cast<u16>((op.value >> 8) | (op.value << 8));
+        switch (op.type) {
+        case OP_FILL:
+            for (u16 f = op.w; f < op.w + op.h; f++) {
+                const FillArea& fill = fills_[f];
+                const i32 top = std::max<i32>(fill.y, y);
+                const i32 bottom = std::min<i32>(fill.y + fill.h, y1);
+                for (i32 row = top; row < bottom; row++) {
+                    span(row, fill.x, fill.x + fill.w, swapped);
+                }
+            }
+            break;
+        case OP_BITMAP: {
+            const i32 top = std::max<i32>(op.y, y);
+            const i32 bottom = std::min<i32>(op.y + op.h, y1);
+            const i32 left = std::max<i32>(op.x, x);
+            const i32 right = std::min<i32>(op.x + op.w, x1);
+            if (left >= right) {
+                break;
+            }
+            for (i32 row = top; row < bottom; row++) {
+                u16* dst = buf + (row - y) * w + (left - x);
+                const u16* src = op.src + (row - op.y) * op.value + (left - op.x);
+                if (op.swap) {
+                    swap_copy(dst, src, right - left);
+                } else {
+                    std::memcpy(dst, src, (right - left) * 2);
+                }
+                cover(row, left, right);
+            }
+            break;
+        }
+        case OP_IMAGE: {
+            const i32 top = std::max<i32>(op.y, y);
+            const i32 bottom = std::min<i32>(op.y + op.h, y1);
+            const i32 left = std::max<i32>(op.x, x);
+            const i32 right = std::min<i32>(op.x + op.w, x1);
+            if (left >= right || top >= bottom) {
+                break;
+            }
+            ImageDecoder& decoder = images_[op.value];
+            if (decoder.row > top - op.y) {
+                // Rows wider than a band are rendered in parts, start over for the next part
+                decoder.begin(decoder.image, decoder.end - decoder.image);
+            }
+            decoder.skip(static_cast<u32>(top - op.y - decoder.row) * op.w);
+            for (i32 row = top; row < bottom; row++) {
+                decoder.skip(left - op.x);
+                decoder.decode(buf + (row - y) * w + (left - x), right - left);
+                decoder.skip(op.x + op.w - right);
+                cover(row, left, right);
+            }
+            decoder.row = bottom - op.y;
+            break;
+        }
+        case OP_SPRITE: {
+            const i32 top = std::max<i32>(op.y, y);
+            const i32 bottom = std::min<i32>(op.y + op.h, y1);
+            const i32 left = std::max<i32>(op.x, x);
+            const i32 right = std::min<i32>(op.x + op.w, x1);
+            if (left < right && top < bottom) {
+                blend_sprite(buf + (top - y) * w + (left - x), w, sprites_[op.value],
+                             left - op.x, top - op.y, right - left, bottom - top, covered, (top - y) * w + (left - x));
+            }
+            break;
+        }
+        case OP_ROTATED: {
+            const i32 top = std::max<i32>(op.y, y);
+            const i32 bottom = std::min<i32>(op.y + op.h, y1);
+            const i32 left = std::max<i32>(op.x, x);
+            const i32 right = std::min<i32>(op.x + op.w, x1);
+            if (left < right && top < bottom) {
+                blend_affine(buf + (top - y) * w + (left - x), w, affines_[op.value], sprites_[op.value],
+                             left, top, right, bottom, covered, (top - y) * w + (left - x));
+            }
+            break;
+        }
+        case OP_CIRCLE:
+        case OP_FILLED_CIRCLE: {
+            const i32 top = std::max<i32>(op.y - op.w, y);
+            const i32 bottom = std::min<i32>(op.y + op.w + 1, y1);
+            i32 runs[2][2];
+            for (i32 row = top; row < bottom; row++) {
+                const u8 count = circle_runs(op.w, row - op.y, op.type == OP_FILLED_CIRCLE, runs);
+                for (u8 run = 0; run < count; run++) {
+                    span(row, op.x + runs[run][0], op.x + runs[run][1] + 1, swapped);
+                }
+            }
+            break;
+        }
+        case OP_ARC: {
+            const Arc& arc = arcs_[op.value];
+            const u16 color = static_cast<u16>((arc.color16 >> 8) | (arc.color16 << 8));
+            const i32 top = std::max<i32>(op.y - op.w, y);
+            const i32 bottom = std::min<i32>(op.y + op.w + 1, y1);
+            i32 runs[4][2];
+            for (i32 row = top; row < bottom; row++) {
+                const u8 count = arc_runs(arc, row - op.y, runs);
+                for (u8 run = 0; run < count; run++) {
+                    span(row, op.x + runs[run][0], op.x + runs[run][1] + 1, color);
+                }
+            }
+            break;
+        }
+        }
+    }
+}
+
+/**
+ * @brief Render the display list and send it to the display in the format `Format`
+ *
+ * The bounding box of the list is cut into bands that fit a DMA buffer. Each
+ * band is rendered, converted in place and queued, then the next band is
+ * rendered into the other buffer while the first one is on the wire.
+ *
+ * After an early render, a band may hold pixels already sent this frame.
+ * Of those, only the ones an operation of this list draws to are sent, row
+ * by row in runs staged in the other buffer, the rest keeps what the
+ * display shows.
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+template <class Format>
+GC9A01::Error GC9A01::render_list_as() const {
+    // Runs are staged across the whole buffer, bands are cut to the bus limit
+    constexpr u32 buffer_bytes = GC9A01_DMA_BUFFER_PIXELS * 2;
+    const u32 capacity = Format::staged_capacity(burst_bytes());
+    // Both buffers get overwritten
+    dma_buf_filled_ = 0;
+    u8 current = 0;
+
+    // Whether any pixel of a band was sent earlier this frame
+    const auto painted = [&](const u16 x, const u16 y, const u16 w, const u16 h) {
+        for (u32 row = y; rendered_early_ && row < static_cast<u32>(y) + h; row++) {
+            for (u32 col = x; col < static_cast<u32>(x) + w; col++) {
+                if (test_bit(painted_, row * GC9A01_WIDTH + col)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    // Send the pixels of a rendered band that are drawn to or were not sent earlier this frame
+    const auto send_runs = [&](const u16* buf, const u16 x, const u16 y, const u16 w, const u16 h) {
+        const u8 stage = current ^ 1;
+        Error err = wait(dma_buf_fence_[stage]);
+        ERROR_CHECK(err);
+        u8* out = reinterpret_cast<u8*>(dma_buf_[stage]);
+        u32 used = 0;
+        const auto keep = [&](const u32 row, const u32 col) {
+            return test_bit(covered_, row * w + col) || !test_bit(painted_, (y + row) * GC9A01_WIDTH + x + col);
+        };
+        for (u32 row = 0; row < h; row++) {
+            for (u32 col = 0; col < w;) {
+                if (!keep(row, col)) {
+                    col++;
+                    continue;
+                }
+                const u32 from = col;
+                while (col < w && keep(row, col)) {
+                    col++;
+                }
+                const u32 n = col - from;
+                const u32 staged = (std::max<u32>(n * 2, Format::bytes(n)) + 3) & ~3u;
+                if (used + staged > buffer_bytes) {
+                    dma_buf_fence_[stage] = fence();
+                    err = wait(dma_buf_fence_[stage]);
+                    ERROR_CHECK(err);
+                    used = 0;
+                }
+                std::memcpy(out + used, buf + row * w + from, n * 2);
+                Format::pack(out + used, n);
+                err = set_write_window(x + from, y + row, n, 1);
+                ERROR_CHECK(err);
+                err = data(out + used, Format::bytes(n));
+                ERROR_CHECK(err);
+                used += staged;
+            }
+        }
+        dma_buf_fence_[stage] = fence();
+        return OK;
+    };
+
+    // Send an area as bands of as many rows as fit, rows wider than a buffer are split
+    const auto send_area = [&](const u16 x, const u16 y, const u16 w, const u16 h) {
+        const u16 cols = std::min<u32>(w, capacity);
+        const u16 rows = std::max<u32>(capacity / w, 1);
+        Error err;
+        for (u32 row = y; row < static_cast<u32>(y) + h; row += rows) {
+            const u16 band_h = std::min<u32>(rows, y + h - row);
+            for (u32 col = x; col < static_cast<u32>(x) + w; col += cols) {
+                const u16 band_w = std::min<u32>(cols, x + w - col);
+                const u32 pixels = static_cast<u32>(band_w) * band_h;
+                err = wait(dma_buf_fence_[current]);
+                ERROR_CHECK(err);
+                u16* buf = dma_buf_[current];
+                if (painted(col, row, band_w, band_h)) {
+                    render_area(buf, col, row, band_w, band_h, covered_);
+                    err = send_runs(buf, col, row, band_w, band_h);
+                    ERROR_CHECK(err);
+                    current ^= 1;
+                    continue;
+                }
+                render_area(buf, col, row, band_w, band_h);
+                Format::pack(reinterpret_cast<u8*>(buf), pixels);
+                err = set_write_window(col, row, band_w, band_h);
+                ERROR_CHECK(err);
+                err = data(reinterpret_cast<const u8*>(buf), Format::bytes(pixels));
+                ERROR_CHECK(err);
+                dma_buf_fence_[current] = fence();
+                current ^= 1;
+            }
+        }
+        return OK;
+    };
+
+    const Rect& area = list_area_;
+    Error err;
+#ifdef CONFIG_GC9A01_ROUND_MASK
+    if (round_mask_) {
+        Band band;
+        u16 row = area.y0;
+        while (next_visible_band(area.x0, area.x1 - area.x0, row, area.y1, band)) {
+            err = send_area(band.x, band.y, band.w, band.h);
+            ERROR_CHECK(err);
+        }
+        return OK;
+    }
+#endif
+    err = send_area(area.x0, area.y0, area.x1 - area.x0, area.y1 - area.y0);
+    ERROR_CHECK(err);
+    return OK;
+}
+
+/**
+ * @brief Render the display list to the display and clear it
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::render_list() const {
+    if (list_count_ == 0) {
+        return OK;
+    }
+    Error err;
+    switch (colmod_) {
+    case COLOR_MODE_MCU_12BIT:
+        err = render_list_as<PixelFormat<COLOR_MODE_MCU_12BIT>>();
+        break;
+    case COLOR_MODE_MCU_18BIT:
+        err = render_list_as<PixelFormat<COLOR_MODE_MCU_18BIT>>();
+        break;
+    default:
+        err = render_list_as<PixelFormat<COLOR_MODE_MCU_16BIT>>();
+        break;
+    }
+    list_count_ = 0;
+    fill_count_ = 0;
+    image_count_ = 0;
+    sprite_count_ = 0;
+    arc_count_ = 0;
+    list_generation_++;
+    list_area_ = {GC9A01_WIDTH, GC9A01_HEIGHT, 0, 0};
+    return err;
+}
+
+/**
+ * @brief Render the display list before `flush()` because it is full
+ *
+ * The pixels sent are remembered until `flush()`, so that later renders of
+ * the frame do not paint the background over them. The map of these pixels
+ * (one bit per pixel) is allocated on the first early render.
+ *
+ * @return `OK` on success, `OUT_OF_MEMORY` if the map could not be allocated,
+ *         else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::render_early() const {
+    if (painted_ == nullptr) {
+        painted_ = static_cast<u32*>(heap_caps_malloc((GC9A01_PIXELS + 31) / 32 * sizeof(u32), MALLOC_CAP_8BIT));
+        if (painted_ == nullptr) {
+            return OUT_OF_MEMORY;
+        }
+    }
+    if (!rendered_early_) {
+        std::fill_n(painted_, (GC9A01_PIXELS + 31) / 32, 0);
+    }
+    const Rect area = list_area_;
+    Error err = render_list();
+    ERROR_CHECK(err);
+    rendered_early_ = true;
+    for (u32 row = area.y0; row < area.y1; row++) {
+        set_bits(painted_, row * GC9A01_WIDTH + area.x0, area.x1 - area.x0);
+    }
+    return OK;
+}
+
+#endif
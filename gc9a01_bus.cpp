@@ -0,0 +1,229 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_bus.cpp
+ * @brief Fair sharing of one bus between several displays
+ */
+
+#include "gc9a01_bus.h"
+#include "gc9a01_private.h"
+
+using Error = GC9A01::Error;
+
+/**
+ * @param quantum Largest transfer in bytes, a smaller quantum alternates more
+ * finely at the cost of more transactions
+ */
+GC9A01BusScheduler::GC9A01BusScheduler(const u32 quantum) :
+    quantum_(quantum), lock_(xSemaphoreCreateMutex())
+{
+}
+
+GC9A01BusScheduler::~GC9A01BusScheduler() {
+    if (lock_ != nullptr) {
+        vSemaphoreDelete(lock_);
+    }
+}
+
+u32 GC9A01BusScheduler::quantum() const {
+    return quantum_;
+}
+
+u32 GC9A01BusScheduler::yields() const {
+    return yields_;
+}
+
+/**
+ * @brief Add `device` to the displays taking turns
+ * @return `OK` on success, `OUT_OF_MEMORY` if `GC9A01_BUS_MAX_DEVICES` are attached already
+ */
+Error GC9A01BusScheduler::attach(GC9A01SharedTransport* device) {
+    if (lock_ == nullptr) {
+        return GC9A01::OUT_OF_MEMORY;
+    }
+    Error err = GC9A01::OUT_OF_MEMORY;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    for (auto& slot : devices_) {
+        if (slot == device) {
+            err = GC9A01::OK;
+            break;
+        }
+        if (slot == nullptr) {
+            slot = device;
+            err = GC9A01::OK;
+            break;
+        }
+    }
+    xSemaphoreGive(lock_);
+    return err;
+}
+
+void GC9A01BusScheduler::detach(GC9A01SharedTransport* device) {
+    if (lock_ == nullptr) {
+        return;
+    }
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    for (auto& slot : devices_) {
+        if (slot == device) {
+            slot = nullptr;
+        }
+    }
+    xSemaphoreGive(lock_);
+}
+
+/**
+ * @brief Whether a display other than `device` is waiting for its transfers
+ *
+ * Counts a yield of `device` if so.
+ */
+bool GC9A01BusScheduler::contended(const GC9A01SharedTransport* device) {
+    bool blocked = false;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    for (const GC9A01SharedTransport* other : devices_) {
+        if (other != nullptr && other != device && other->blocked_) {
+            blocked = true;
+            yields_++;
+            break;
+        }
+    }
+    xSemaphoreGive(lock_);
+    return blocked;
+}
+
+void GC9A01BusScheduler::set_blocked(GC9A01SharedTransport* device, const bool blocked) {
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    device->blocked_ = blocked;
+    xSemaphoreGive(lock_);
+}
+
+
+/**
+ * @param scheduler Scheduler shared by all displays on the bus
+ * @param bus Transport of this display
+ */
+GC9A01SharedTransport::GC9A01SharedTransport(GC9A01BusScheduler& scheduler, GC9A01::Transport& bus) :
+    scheduler_(scheduler), bus_(bus)
+{
+    bus_.set_completion_callback(forward_completion, this);
+}
+
+GC9A01SharedTransport::~GC9A01SharedTransport() {
+    scheduler_.detach(this);
+    bus_.set_completion_callback(nullptr, nullptr);
+}
+
+void GC9A01SharedTransport::forward_completion(const u32 sequence, void* arg) {
+    static_cast<const GC9A01SharedTransport*>(arg)->completed(sequence);
+}
+
+/**
+ * @brief Set up the bus of this display and join the scheduler
+ * @return `OK` on success, `OUT_OF_MEMORY` if the scheduler is full, else the error of the bus
+ */
+Error GC9A01SharedTransport::begin() {
+    const Error err = scheduler_.attach(this);
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    return bus_.begin();
+}
+
+/**
+ * @brief Make way for other displays before queueing a transfer
+ *
+ * While another display waits for its transfers, whatever is still queued
+ * here would go out first, so it is collected before the next transfer is
+ * queued. The driver gets those from the next `collect()` calls.
+ *
+ * @return `OK` on success, else the error of the bus
+ */
+Error GC9A01SharedTransport::turn() {
+    if (in_flight_ == 0 || !scheduler_.contended(this)) {
+        return GC9A01::OK;
+    }
+    scheduler_.set_blocked(this, true);
+    Error err = GC9A01::OK;
+    while (in_flight_ > 0 && err == GC9A01::OK) {
+        err = bus_.collect(portMAX_DELAY);
+        if (err == GC9A01::OK) {
+            in_flight_--;
+            collected_++;
+        }
+    }
+    scheduler_.set_blocked(this, false);
+    return err;
+}
+
+/**
+ * @brief Count a transfer as in flight if it was queued
+ */
+Error GC9A01SharedTransport::queued(const Error err) {
+    if (err == GC9A01::OK) {
+        in_flight_++;
+    }
+    return err;
+}
+
+Error GC9A01SharedTransport::cmd(const u8 command) {
+    const Error err = turn();
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    return queued(bus_.cmd(command));
+}
+
+Error GC9A01SharedTransport::data(const u8* data, const u32 size) {
+    const Error err = turn();
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    return queued(bus_.data(data, size));
+}
+
+Error GC9A01SharedTransport::queue_data(const u8* data, const u32 size) {
+    const Error err = turn();
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    return queued(bus_.queue_data(data, size));
+}
+
+Error GC9A01SharedTransport::collect(const TickType_t timeout) {
+    if (collected_ > 0) {
+        collected_--;
+        return GC9A01::OK;
+    }
+    scheduler_.set_blocked(this, true);
+    const Error err = bus_.collect(timeout);
+    scheduler_.set_blocked(this, false);
+    if (err == GC9A01::OK) {
+        in_flight_--;
+    }
+    return err;
+}
+
+void GC9A01SharedTransport::set_reset(const bool level) {
+    bus_.set_reset(level);
+}
+
+bool GC9A01SharedTransport::has_reset() const {
+    return bus_.has_reset();
+}
+
+bool GC9A01SharedTransport::can_send_from(const void* data) const {
+    return bus_.can_send_from(data);
+}
+
+// A transfer is never interrupted, the quantum bounds how long others wait for it
+u32 GC9A01SharedTransport::max_transfer() const {
+    return std::min(bus_.max_transfer(), scheduler_.quantum());
+}
+
+bool GC9A01SharedTransport::has_tear() const {
+    return bus_.has_tear();
+}
+
+Error GC9A01SharedTransport::wait_tear(const TickType_t timeout) {
+    return bus_.wait_tear(timeout);
+}
@@ -0,0 +1,220 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_console.cpp
+ * @brief Scrolling text console on top of the hardware vertical scrolling
+ */
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+
+#include "gc9a01_console.h"
+
+#define FONT_FIRST_CHAR ' '
+#define FONT_LAST_CHAR  '~'
+
+// 5x7 font for ' ' to '~', one byte per column, bit 0 is the top row
+static const u8 font5x7[][5] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00}, // ' ' ! "
+    {0x14, 0x7F, 0x14, 0x7F, 0x14}, {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62}, // # $ %
+    {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00}, {0x00, 0x1C, 0x22, 0x41, 0x00}, // & ' (
+    {0x00, 0x41, 0x22, 0x1C, 0x00}, {0x08, 0x2A, 0x1C, 0x2A, 0x08}, {0x08, 0x08, 0x3E, 0x08, 0x08}, // ) * +
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x60, 0x60, 0x00, 0x00}, // , - .
+    {0x20, 0x10, 0x08, 0x04, 0x02}, {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00}, // / 0 1
+    {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31}, {0x18, 0x14, 0x12, 0x7F, 0x10}, // 2 3 4
+    {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03}, // 5 6 7
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E}, {0x00, 0x36, 0x36, 0x00, 0x00}, // 8 9 :
+    {0x00, 0x56, 0x36, 0x00, 0x00}, {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14}, // ; < =
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06}, {0x32, 0x49, 0x79, 0x41, 0x3E}, // > ? @
+    {0x7E, 0x11, 0x11, 0x11, 0x7E}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22}, // A B C
+    {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x09, 0x01}, // D E F
+    {0x3E, 0x41, 0x49, 0x49, 0x7A}, {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00}, // G H I
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, {0x7F, 0x40, 0x40, 0x40, 0x40}, // J K L
+    {0x7F, 0x02, 0x0C, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E}, // M N O
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46}, // P Q R
+    {0x46, 0x49, 0x49, 0x49, 0x31}, {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F}, // S T U
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, {0x63, 0x14, 0x08, 0x14, 0x63}, // V W X
+    {0x07, 0x08, 0x70, 0x08, 0x07}, {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00}, // Y Z [
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00}, {0x04, 0x02, 0x01, 0x02, 0x04}, // \ ] ^
+    {0x40, 0x40, 0x40, 0x40, 0x40}, {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78}, // _ ` a
+    {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20}, {0x38, 0x44, 0x44, 0x48, 0x7F}, // b c d
+    {0x38, 0x54, 0x54, 0x54, 0x18}, {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x0C, 0x52, 0x52, 0x52, 0x3E}, // e f g
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, {0x20, 0x40, 0x44, 0x3D, 0x00}, // h i j
+    {0x7F, 0x10, 0x28, 0x44, 0x00}, {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78}, // k l m
+    {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, {0x7C, 0x14, 0x14, 0x14, 0x08}, // n o p
+    {0x08, 0x14, 0x14, 0x18, 0x7C}, {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20}, // q r s
+    {0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, {0x1C, 0x20, 0x40, 0x20, 0x1C}, // t u v
+    {0x3C, 0x40, 0x30, 0x40, 0x3C}, {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C}, // w x y
+    {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, {0x00, 0x00, 0x7F, 0x00, 0x00}, // z { |
+    {0x00, 0x41, 0x36, 0x08, 0x00}, {0x02, 0x01, 0x02, 0x04, 0x02}                                  // } ~
+};
+static_assert(sizeof(font5x7) / sizeof(font5x7[0]) == FONT_LAST_CHAR - FONT_FIRST_CHAR + 1);
+
+/**
+ * @brief Byte-swap an RGB565 color, the line buffer holds the wire order
+ */
+static u16 big_endian(const Color color) {
+    const u16 color16 = color.to_16bit();
+    return static_cast<u16>((color16 >> 8) | (color16 << 8));
+}
+
+GC9A01Console::GC9A01Console(GC9A01& display, const Color foreground, const Color background) :
+    display_(display), foreground_(foreground), background_(background)
+{
+}
+
+/**
+ * @brief Set up the scroll area and clear it
+ *
+ * Only whole lines are used, leftover rows at the bottom stay fixed.
+ *
+ * @param top_fixed Rows above the console that do not scroll
+ * @param height Rows available for the console
+ * @return `OK` on success, `INVALID_ARGUMENT` if not even one line fits, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01Console::Error GC9A01Console::begin(const u16 top_fixed, const u16 height) {
+    if (static_cast<u32>(top_fixed) + height > GC9A01_HEIGHT || height < GC9A01_CONSOLE_CHAR_H) {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    top_ = top_fixed;
+    lines_ = height / GC9A01_CONSOLE_CHAR_H;
+    Error err = display_.set_scroll_area(top_, lines_ * GC9A01_CONSOLE_CHAR_H);
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    return clear();
+}
+
+/**
+ * @brief Fill the console with the background color and start again at the top
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01Console::Error GC9A01Console::clear() {
+    Error err = display_.fill_rect(0, top_, GC9A01_WIDTH, lines_ * GC9A01_CONSOLE_CHAR_H, background_);
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    err = display_.flush();
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    count_ = 0;
+    return display_.scroll_to(0);
+}
+
+/**
+ * @brief Set the colors of the lines printed from now on
+ */
+void GC9A01Console::set_colors(const Color foreground, const Color background) {
+    foreground_ = foreground;
+    background_ = background;
+}
+
+/**
+ * @brief Print `text`, every `\n` ends a line
+ *
+ * Each call starts on a new line, a trailing `\n` does not add an empty one.
+ *
+ * @param text Zero terminated text, characters outside of ASCII print as `?`
+ * @return `OK` on success, `INVALID_ARGUMENT` before `begin()`, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01Console::Error GC9A01Console::print(const char* text) {
+    Error err;
+    while (true) {
+        const char* end = text;
+        while (*end != '\0' && *end != '\n') {
+            end++;
+        }
+        // Wrap long lines, an empty line still takes one
+        u32 length = end - text;
+        do {
+            const u16 chunk = std::min<u32>(length, GC9A01_CONSOLE_COLUMNS);
+            err = new_line(text, chunk);
+            if (err != GC9A01::OK) {
+                return err;
+            }
+            text += chunk;
+            length -= chunk;
+        } while (length > 0);
+
+        if (*end == '\0' || end[1] == '\0') {
+            return GC9A01::OK;
+        }
+        text = end + 1;
+    }
+}
+
+/**
+ * @brief Print formatted text, see `print()`
+ * @return `OK` on success, `INVALID_ARGUMENT` before `begin()`, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01Console::Error GC9A01Console::printf(const char* format, ...) {
+    char text[GC9A01_CONSOLE_COLUMNS * 4 + 1];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    return print(text);
+}
+
+/**
+ * @brief Render one line and show it below the others
+ *
+ * The line replaces the oldest one in GRAM. Once the console is full the
+ * scroll area moves by one line, so the new line appears at the bottom.
+ *
+ * @param text Characters of the line, at most `GC9A01_CONSOLE_COLUMNS`
+ * @param length Number of characters
+ * @return `OK` on success, `INVALID_ARGUMENT` before `begin()`, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01Console::Error GC9A01Console::new_line(const char* text, const u16 length) {
+    // No scroll area before `begin()`
+    if (lines_ == 0) {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    // The previous line may still be sent from the buffer
+    Error err = display_.wait(fence_);
+    if (err != GC9A01::OK) {
+        return err;
+    }
+
+    const u16 foreground = big_endian(foreground_);
+    std::fill_n(buf_, GC9A01_WIDTH * GC9A01_CONSOLE_CHAR_H, big_endian(background_));
+    for (u16 col = 0; col < length; col++) {
+        char c = text[col];
+        if (c < FONT_FIRST_CHAR || c > FONT_LAST_CHAR) {
+            c = '?';
+        }
+        const u8* glyph = font5x7[c - FONT_FIRST_CHAR];
+        u16* cell = buf_ + col * GC9A01_CONSOLE_CHAR_W;
+        for (u8 x = 0; x < 5; x++) {
+            for (u8 y = 0; y < 7; y++) {
+                if (glyph[x] & (1 << y)) {
+                    cell[y * GC9A01_WIDTH + x] = foreground;
+                }
+            }
+        }
+    }
+
+    const u16 slot = count_ % lines_;
+    err = display_.draw_bitmap_be(0, top_ + slot * GC9A01_CONSOLE_CHAR_H, GC9A01_WIDTH, GC9A01_CONSOLE_CHAR_H, buf_);
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    err = display_.flush();
+    if (err != GC9A01::OK) {
+        return err;
+    }
+    fence_ = display_.fence();
+    if (count_ >= lines_) {
+        // The line after this one is the oldest, it goes to the top
+        err = display_.scroll_to((slot + 1) % lines_ * GC9A01_CONSOLE_CHAR_H);
+        if (err != GC9A01::OK) {
+            return err;
+        }
+    }
+    count_++;
+    return GC9A01::OK;
+}
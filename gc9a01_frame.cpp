@@ -0,0 +1,117 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_frame.cpp
+ * @brief Frame pacing: `present()` sends frames at a steady rate, locked to the TE pulse
+ *
+ * The panel refreshes from GRAM at its own rate (about 60 Hz) and pulses its
+ * TE output when a refresh starts. A frame written while the refresh is
+ * running shows the top of the new and the bottom of the old frame. Starting
+ * the write on the TE pulse keeps the refresh ahead of the write for the
+ * first refresh and behind it for the next one, as long as the write takes
+ * less than two refresh periods (a full 16-bit frame at 40 MHz takes about
+ * 1.4), so every refresh shows one whole frame.
+ */
+
+#include "gc9a01.h"
+#include "gc9a01_private.h"
+
+/**
+ * @brief Move the TE pulse to the refresh reaching row `line`
+ *
+ * By default the pulse marks the start of a refresh. A later line lets an
+ * update that only touches the lower part of the screen start while the
+ * refresh is still above it, just behind the scan.
+ *
+ * @param line GRAM row, 0 for the start of the refresh
+ * @return `OK` on success, `INVALID_ARGUMENT` if `line` is off-screen, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::set_tear_scanline(const u16 line) const {
+    if (line >= GC9A01_HEIGHT) {
+        return INVALID_ARGUMENT;
+    }
+    const u8 params[] = {
+        static_cast<u8>(line >> 8),
+        static_cast<u8>(line & 0xFF)
+    };
+    Error err = cmd(CMD_SET_TEAR_SCANLINE);
+    ERROR_CHECK(err);
+    err = data(params, 2);
+    return finish(err);
+}
+
+/**
+ * @brief Set the rate `present()` sends frames at
+ *
+ * With a TE pulse the rate should divide the refresh rate of the panel
+ * (e.g. 60, 30 or 20 fps at 60 Hz), else frames alternate between two
+ * lengths.
+ *
+ * @param fps Frames per second, 0 to send on every TE pulse (or right away without one)
+ */
+void GC9A01::set_frame_rate(const u16 fps) {
+    frame_period_us_ = fps > 0 ? 1000000 / fps : 0;
+    next_frame_us_ = 0;
+}
+
+/**
+ * @brief Wait for the next frame slot, then `flush()`
+ *
+ * With a TE pulse the frame starts on the first pulse no earlier than a
+ * quarter period before its slot, so pulse jitter does not cost a refresh.
+ * Without one, the slot is kept by the timer alone. A frame that comes late
+ * counts the slots it missed, and the next slot is a full period after it.
+ *
+ * In direct mode nothing is buffered, call it before drawing the frame.
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::present() const {
+    const bool tear = transport_->has_tear();
+    const i64 slot = next_frame_us_;
+    i64 now;
+    if (tear) {
+        const i64 earliest = slot - frame_period_us_ / 4;
+        do {
+            if (transport_->wait_tear(pdMS_TO_TICKS(GC9A01_TEAR_TIMEOUT_MS)) != OK) {
+                frame_stats_.tear_timeouts++;
+                now = esp_timer_get_time();
+                break;
+            }
+            now = esp_timer_get_time();
+        } while (now < earliest);
+    } else {
+        delay_until(slot);
+        now = esp_timer_get_time();
+    }
+
+    bool late = false;
+    if (frame_stats_.presented > 0) {
+        const u32 interval = static_cast<u32>(now - last_frame_us_);
+        frame_stats_.last_interval_us = interval;
+        frame_stats_.max_interval_us = std::max(frame_stats_.max_interval_us, interval);
+        if (frame_period_us_ > 0 && slot != 0 && now > slot) {
+            // Rounded, so a slot counts as missed once the frame is half a period late
+            const u32 missed = (now - slot + frame_period_us_ / 2) / frame_period_us_;
+            frame_stats_.missed += missed;
+            late = missed > 0;
+        }
+    }
+    frame_stats_.presented++;
+    last_frame_us_ = now;
+    // TE pulses already line up, the timer keeps its own grid unless it fell behind
+    next_frame_us_ = (tear || late || slot == 0 ? now : slot) + frame_period_us_;
+    return flush();
+}
+
+/**
+ * @brief Statistics of `present()` since the start or `reset_frame_stats()`
+ */
+const GC9A01::FrameStats& GC9A01::frame_stats() const {
+    return frame_stats_;
+}
+
+void GC9A01::reset_frame_stats() {
+    frame_stats_ = {};
+}
@@ -0,0 +1,138 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_host.cpp
+ * @brief In-memory GC9A01 transport for host builds
+ */
+
+#include <cstring>
+
+#include "gc9a01_host.h"
+
+using Error = GC9A01::Error;
+
+Error GC9A01MemoryTransport::begin() {
+    return GC9A01::OK;
+}
+
+/**
+ * @brief Queue `size` bytes, copying them if `copy` is set
+ * @return `OK`, `SPI_TRANSMIT_ERROR` if `GC9A01_QUEUE_SIZE` transfers are in flight already
+ *         or `size` is over the transfer limit
+ */
+Error GC9A01MemoryTransport::queue(const u8* data, const u32 size, const bool dc, const bool copy) {
+    if (in_flight() == GC9A01_QUEUE_SIZE || size > max_transfer_) {
+        return GC9A01::SPI_TRANSMIT_ERROR;
+    }
+    Pending& slot = pending_[queued_ % GC9A01_QUEUE_SIZE];
+    slot.size = size;
+    slot.dc = dc;
+    if (copy) {
+        std::memcpy(slot.copy, data, size);
+        slot.data = slot.copy;
+    } else {
+        slot.data = data;
+    }
+    queued_++;
+    return GC9A01::OK;
+}
+
+Error GC9A01MemoryTransport::cmd(const u8 command) {
+    return queue(&command, 1, false, true);
+}
+
+Error GC9A01MemoryTransport::data(const u8* data, const u32 size) {
+    return queue(data, size, true, true);
+}
+
+Error GC9A01MemoryTransport::queue_data(const u8* data, const u32 size) {
+    return queue(data, size, true, size <= GC9A01_INLINE_DATA);
+}
+
+/**
+ * @brief "Send" the oldest queued transfer
+ * @return `OK`, `SPI_TRANSMIT_ERROR` if nothing is in flight
+ */
+Error GC9A01MemoryTransport::collect(const TickType_t) {
+    if (in_flight() == 0) {
+        return GC9A01::SPI_TRANSMIT_ERROR;
+    }
+    const Pending& slot = pending_[collected_ % GC9A01_QUEUE_SIZE];
+    transfer(slot.dc, slot.data, slot.size);
+    collected_++;
+    completed(collected_);
+    return GC9A01::OK;
+}
+
+void GC9A01MemoryTransport::transfer(const bool dc, const u8* data, const u32 size) {
+    transactions_++;
+    bytes_ += size;
+    if (!dc) {
+        commands_++;
+    }
+    if (recording_) {
+        records_.push_back({dc, static_cast<u32>(log_.size()), size});
+        log_.insert(log_.end(), data, data + size);
+    }
+}
+
+void GC9A01MemoryTransport::set_reset(const bool level) {
+    reset_level_ = level;
+}
+
+bool GC9A01MemoryTransport::has_reset() const {
+    return true;
+}
+
+bool GC9A01MemoryTransport::can_send_from(const void*) const {
+    return true;
+}
+
+u32 GC9A01MemoryTransport::max_transfer() const {
+    return max_transfer_;
+}
+
+void GC9A01MemoryTransport::set_max_transfer(const u32 bytes) {
+    max_transfer_ = bytes;
+}
+
+void GC9A01MemoryTransport::set_recording(const bool recording) {
+    recording_ = recording;
+}
+
+const std::vector<GC9A01MemoryTransport::Record>& GC9A01MemoryTransport::records() const {
+    return records_;
+}
+
+const std::vector<u8>& GC9A01MemoryTransport::log() const {
+    return log_;
+}
+
+void GC9A01MemoryTransport::clear() {
+    records_.clear();
+    log_.clear();
+    transactions_ = 0;
+    commands_ = 0;
+    bytes_ = 0;
+}
+
+u32 GC9A01MemoryTransport::transactions() const {
+    return transactions_;
+}
+
+u32 GC9A01MemoryTransport::commands() const {
+    return commands_;
+}
+
+u64 GC9A01MemoryTransport::bytes() const {
+    return bytes_;
+}
+
+u32 GC9A01MemoryTransport::in_flight() const {
+    return queued_ - collected_;
+}
+
+bool GC9A01MemoryTransport::reset_level() const {
+    return reset_level_;
+}
@@ -0,0 +1,257 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_image.cpp
+ * @brief Compressed images, decoded chunk by chunk into the DMA buffers while they are sent
+ *
+ * The decoder keeps its state between calls, so an image is decoded exactly
+ * once, in order, into whatever the current destination is: the DMA buffer
+ * being filled in direct mode, the framebuffer in buffer mode or the band
+ * being rendered in band mode. Pixels outside the screen or behind the
+ * round mask are decoded and dropped.
+ */
+
+#include <cstring>
+#include <algorithm>
+
+#include "gc9a01.h"
+#include "gc9a01_private.h"
+
+static inline u8 image_hash(const u16 px) {
+    return ((px >> 11) * 3 + ((px >> 5) & 0x3F) * 5 + (px & 0x1F) * 7) & 0x3F;
+}
+
+// Add to each channel of an RGB565 pixel, channels wrap around
+static inline u16 image_add(const u16 px, const i32 dr, const i32 dg, const i32 db) {
+    const u32 r = ((px >> 11) + dr) & 0x1F;
+    const u32 g = (((px >> 5) & 0x3F) + dg) & 0x3F;
+    const u32 b = ((px & 0x1F) + db) & 0x1F;
+    return static_cast<u16>((r << 11) | (g << 5) | b);
+}
+
+/**
+ * @brief Start decoding an image whose header was checked already
+ */
+void GC9A01::ImageDecoder::begin(const u8* data, const u32 size) {
+    image = data;
+    pos = data + GC9A01_IMAGE_HEADER_SIZE;
+    end = data + size;
+    run = 0;
+    prev = 0;
+    row = 0;
+    truncated = false;
+    std::fill_n(index, 64, 0);
+}
+
+void GC9A01::ImageDecoder::decode(u16* dst, u32 n) {
+    while (n > 0) {
+        if (run > 0) {
+            const u32 k = std::min(run, n);
+            if (dst != nullptr) {
+                std::fill_n(dst, k, static_cast<u16>((prev >> 8) | (prev << 8)));
+                dst += k;
+            }
+            run -= k;
+            n -= k;
+            continue;
+        }
+        if (pos >= end) {
+            truncated = true;
+            run = n;
+            continue;
+        }
+        const u8 op = *pos++;
+        u16 px;
+        if (op < 0x40) {
+            px = index[op];
+        } else if (op < 0x80) {
+            px = image_add(prev, ((op >> 4) & 3) - 2, ((op >> 2) & 3) - 2, (op & 3) - 2);
+        } else if (op < 0xC0) {
+            if (pos >= end) {
+                continue;
+            }
+            const i32 dg = (op & 0x3F) - 32;
+            const u8 rb = *pos++;
+            px = image_add(prev, dg + (rb >> 4) - 8, dg, dg + (rb & 0x0F) - 8);
+        } else if (op < 0xFE) {
+            run = (op & 0x3F) + 1;
+            continue;
+        } else {
+            if (end - pos < 2) {
+                pos = end;
+                continue;
+            }
+            const u16 value = static_cast<u16>((pos[0] << 8) | pos[1]);
+            pos += 2;
+            if (op == 0xFF) {
+                run = 63 + value;
+                continue;
+            }
+            px = value;
+        }
+        index[image_hash(px)] = px;
+        prev = px;
+        if (dst != nullptr) {
+            *dst++ = static_cast<u16>((px >> 8) | (px << 8));
+        }
+        n--;
+    }
+}
+
+/**
+ * @brief Decode the visible part of an image into the current write windows
+ *
+ * Works like `write_pixels_as()`: chunks are decoded into the two DMA buffers
+ * in turns, so the next chunk is decoded while the previous one is on the
+ * wire. With the round mask enabled only the visible bands are sent.
+ *
+ * @param x `x` coordinate of the image
+ * @param y `y` coordinate of the image
+ * @param w width of the image
+ * @param x0 first visible column, `x1` and `y1` are exclusive
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+template <class Format>
+GC9A01::Error GC9A01::write_image_as(ImageDecoder& decoder, const i16 x, const i16 y, const u16 w,
+                                     const u16 x0, const u16 y0, const u16 x1, const u16 y1) const {
+    const u32 capacity = Format::staged_capacity(burst_bytes());
+    // Both buffers get overwritten
+    dma_buf_filled_ = 0;
+    u8 current = 0;
+
+    const auto send_band = [&](const u16 bx, const u16 by, const u16 bw, const u16 bh) {
+        // Bands come top to bottom, drop the rows in between
+        decoder.skip(static_cast<u32>(by - y - decoder.row) * w);
+        decoder.row = by - y;
+        Error err = set_write_window(bx, by, bw, bh);
+        ERROR_CHECK(err);
+        const u32 total = static_cast<u32>(bw) * bh;
+        u32 col = 0;
+        for (u32 sent = 0; sent < total;) {
+            err = wait(dma_buf_fence_[current]);
+            ERROR_CHECK(err);
+            u16* buf = dma_buf_[current];
+            const u32 chunk = std::min(capacity, total - sent);
+            for (u32 filled = 0; filled < chunk;) {
+                if (col == 0) {
+                    decoder.skip(bx - x);
+                }
+                const u32 n = std::min<u32>(chunk - filled, bw - col);
+                decoder.decode(buf + filled, n);
+                filled += n;
+                col += n;
+                if (col == bw) {
+                    decoder.skip(x + w - (bx + bw));
+                    decoder.row++;
+                    col = 0;
+                }
+            }
+            Format::pack(reinterpret_cast<u8*>(buf), chunk);
+            err = data(reinterpret_cast<const u8*>(buf), Format::bytes(chunk));
+            ERROR_CHECK(err);
+            dma_buf_fence_[current] = fence();
+            sent += chunk;
+            current ^= 1;
+        }
+        return OK;
+    };
+
+    Error err;
+#ifdef CONFIG_GC9A01_ROUND_MASK
+    if (round_mask_) {
+        Band band;
+        u16 row = y0;
+        while (next_visible_band(x0, x1 - x0, row, y1, band)) {
+            err = send_band(band.x, band.y, band.w, band.h);
+            ERROR_CHECK(err);
+        }
+        return OK;
+    }
+#endif
+    err = send_band(x0, y0, x1 - x0, y1 - y0);
+    ERROR_CHECK(err);
+    return OK;
+}
+
+/**
+ * @brief Decode and send the visible part of an image in the active color mode
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::write_image(ImageDecoder& decoder, const i16 x, const i16 y, const u16 w,
+                                  const u16 x0, const u16 y0, const u16 x1, const u16 y1) const {
+    switch (colmod_) {
+    case COLOR_MODE_MCU_12BIT:
+        return write_image_as<PixelFormat<COLOR_MODE_MCU_12BIT>>(decoder, x, y, w, x0, y0, x1, y1);
+    case COLOR_MODE_MCU_18BIT:
+        return write_image_as<PixelFormat<COLOR_MODE_MCU_18BIT>>(decoder, x, y, w, x0, y0, x1, y1);
+    default:
+        return write_image_as<PixelFormat<COLOR_MODE_MCU_16BIT>>(decoder, x, y, w, x0, y0, x1, y1);
+    }
+}
+
+/**
+ * @brief Draw a compressed image with its top left corner at `x`, `y`
+ *
+ * The image is never decoded as a whole: in direct mode it is decoded in
+ * chunks into the DMA buffers while the previous chunk is sent, in buffer
+ * mode straight into the framebuffer. In band mode it is decoded band by
+ * band on `flush()`, `image` has to stay valid until then.
+ *
+ * @param x `x` coordinate
+ * @param y `y` coordinate
+ * @param image Image written by `tools/gc9a01_imgconv.py`, e.g. in flash or a memory-mapped partition
+ * @param size Size of `image` in bytes
+ * @return `OK` on success, `INVALID_ARGUMENT` if `image` has no valid header or ends early
+ *         (the missing pixels repeat the last one, band mode only checks the header),
+ *         else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::draw_image(const i16 x, const i16 y, const u8* image, const u32 size) const {
+    PRIMITIVE(PRIM_BITMAP);
+    u16 w;
+    u16 h;
+    if (!gc9a01_image_size(image, size, w, h)) {
+        return INVALID_ARGUMENT;
+    }
+    const i32 x0 = std::max<i32>(x, 0);
+    const i32 y0 = std::max<i32>(y, 0);
+    const i32 x1 = std::min<i32>(x + w, GC9A01_WIDTH);
+    const i32 y1 = std::min<i32>(y + h, GC9A01_HEIGHT);
+    if (x0 >= x1 || y0 >= y1) {
+        return OK;
+    }
+
+    Error err;
+    bool truncated = false;
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    err = wait(fb_fence_);
+    ERROR_CHECK(err);
+    ImageDecoder decoder;
+    decoder.begin(image, size);
+    decoder.skip(static_cast<u32>(y0 - y) * w);
+    for (i32 row = y0; row < y1; row++) {
+        decoder.skip(x0 - x);
+        decoder.decode(fb_ + row * GC9A01_WIDTH + x0, x1 - x0);
+        decoder.skip(x + w - x1);
+    }
+    mark_dirty(x0, y0, x1 - x0, y1 - y0);
+    truncated = decoder.truncated;
+#elif defined(CONFIG_GC9A01_BAND_MODE)
+    // Make room first, rendering the list early frees all decoders
+    if (image_count_ == GC9A01_DISPLAY_LIST_IMAGES || list_count_ == CONFIG_GC9A01_DISPLAY_LIST_SIZE) {
+        err = render_early();
+        ERROR_CHECK(err);
+    }
+    images_[image_count_].begin(image, size);
+    err = record({nullptr, x, y, w, h, image_count_, OP_IMAGE, false},
+                 {static_cast<u16>(x0), static_cast<u16>(y0), static_cast<u16>(x1), static_cast<u16>(y1)});
+    image_count_++;
+#else
+    ImageDecoder decoder;
+    decoder.begin(image, size);
+    err = write_image(decoder, x, y, w, x0, y0, x1, y1);
+    truncated = decoder.truncated;
+#endif
+    err = finish(err);
+    return err == OK && truncated ? INVALID_ARGUMENT : err;
+}
@@ -0,0 +1,358 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_mock.cpp
+ * @brief Host-side GC9A01 panel emulator with a bus timing model
+ */
+
+#include <utility>
+
+#include "gc9a01_mock.h"
+#include "gc9a01_private.h"
+
+/**
+ * @param sck_hz SPI clock used for the per-byte cost
+ * @param transaction_overhead_ns Fixed cost of every transaction (queueing, interrupt, CS toggling)
+ */
+GC9A01MockPanel::GC9A01MockPanel(const u32 sck_hz, const u32 transaction_overhead_ns) :
+    sck_hz_(sck_hz), overhead_ns_(transaction_overhead_ns)
+{
+}
+
+/**
+ * @brief Back to the power-on defaults, GRAM keeps its content
+ */
+void GC9A01MockPanel::reset_state() {
+    command_ = 0;
+    param_count_ = 0;
+    partial_count_ = 0;
+    col_start_ = 0;
+    col_end_ = GC9A01_WIDTH - 1;
+    row_start_ = 0;
+    row_end_ = GC9A01_HEIGHT - 1;
+    col_ = 0;
+    row_ = 0;
+    madctl_ = 0;
+    colmod_ = COLOR_MODE_MCU_18BIT;
+    sleeping_ = true;
+    display_on_ = false;
+    inverted_ = false;
+    top_fixed_ = 0;
+    scroll_height_ = GC9A01_HEIGHT;
+    scroll_start_ = 0;
+    tear_on_ = false;
+    tear_scanline_ = 0;
+    tear_mode_ = 0;
+}
+
+void GC9A01MockPanel::set_reset(const bool level) {
+    // The panel resets on the rising edge of RESX
+    if (level && !reset_level()) {
+        reset_state();
+    }
+    GC9A01MemoryTransport::set_reset(level);
+}
+
+void GC9A01MockPanel::transfer(const bool dc, const u8* data, const u32 size) {
+    GC9A01MemoryTransport::transfer(dc, data, size);
+    bus_time_ns_ += overhead_ns_ + static_cast<u64>(size) * 8 * 1000000000ULL / sck_hz_;
+    if (!reset_level()) {
+        protocol_errors_++;
+        return;
+    }
+    for (u32 i = 0; i < size; i++) {
+        if (!dc) {
+            command(data[i]);
+        } else if (command_ == CMD_MEMORY_WRITE || command_ == CMD_WRITE_MEM_CONTINUE) {
+            pixel_byte(data[i]);
+        } else {
+            parameter(data[i]);
+        }
+    }
+}
+
+void GC9A01MockPanel::command(const u8 command) {
+    command_ = command;
+    param_count_ = 0;
+    partial_count_ = 0;
+    switch (command) {
+        case CMD_SWRESET:
+            reset_state();
+            break;
+        case CMD_SLEEP_ON:
+            sleeping_ = true;
+            break;
+        case CMD_SLEEP_OFF:
+            sleeping_ = false;
+            break;
+        case CMD_INVERT_OFF:
+            inverted_ = false;
+            break;
+        case CMD_INVERT_ON:
+            inverted_ = true;
+            break;
+        case CMD_DISPLAY_OFF:
+            display_on_ = false;
+            break;
+        case CMD_DISPLAY_ON:
+            display_on_ = true;
+            break;
+        case CMD_TEARING_OFF:
+            tear_on_ = false;
+            break;
+        case CMD_TEARING_ON:
+            tear_on_ = true;
+            break;
+        case CMD_MEMORY_WRITE:
+            col_ = col_start_;
+            row_ = row_start_;
+            memory_writes_++;
+            break;
+        case CMD_WRITE_MEM_CONTINUE:
+            memory_writes_++;
+            break;
+        default:
+            break;
+    }
+}
+
+void GC9A01MockPanel::parameter(const u8 value) {
+    switch (command_) {
+        // Commands without parameters
+        case 0:
+        case CMD_SWRESET:
+        case CMD_SLEEP_ON:
+        case CMD_SLEEP_OFF:
+        case CMD_INVERT_OFF:
+        case CMD_INVERT_ON:
+        case CMD_DISPLAY_OFF:
+        case CMD_DISPLAY_ON:
+        case CMD_TEARING_OFF:
+            protocol_errors_++;
+            return;
+        default:
+            break;
+    }
+    if (param_count_ == sizeof(params_)) {
+        return;
+    }
+    params_[param_count_++] = value;
+    const auto word = [this](const u8 i) {
+        return static_cast<u16>((params_[i] << 8) | params_[i + 1]);
+    };
+    switch (command_) {
+        case CMD_COLADDRSET:
+            if (param_count_ == 4) {
+                col_start_ = word(0);
+                col_end_ = word(2);
+            }
+            break;
+        case CMD_ROWADDRSET:
+            if (param_count_ == 4) {
+                row_start_ = word(0);
+                row_end_ = word(2);
+            }
+            break;
+        case CMD_MEM_ACCESS_CTL:
+            madctl_ = value;
+            break;
+        case CMD_COLMOD:
+            colmod_ = value & 0x07;
+            break;
+        case CMD_VERTICAL_SCROLL:
+            if (param_count_ == 6) {
+                top_fixed_ = word(0);
+                scroll_height_ = word(2);
+            }
+            break;
+        case CMD_VERTICAL_SCROLL_START_ADDR:
+            if (param_count_ == 2) {
+                scroll_start_ = word(0);
+            }
+            break;
+        case CMD_TEARING_ON:
+            tear_mode_ = value & 0x01;
+            break;
+        case CMD_SET_TEAR_SCANLINE:
+            if (param_count_ == 2) {
+                tear_scanline_ = word(0);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void GC9A01MockPanel::pixel_byte(const u8 value) {
+    partial_[partial_count_++] = value;
+    // RGB444 to RGB565 by repeating the top bits
+    const auto expand444 = [](const u32 r, const u32 g, const u32 b) {
+        return static_cast<u16>((((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3)));
+    };
+    switch (colmod_) {
+        case COLOR_MODE_MCU_12BIT:
+            // Two pixels in 3 bytes, the first one is complete after 12 bits
+            if (partial_count_ == 2) {
+                put(expand444(partial_[0] >> 4, partial_[0] & 0x0F, partial_[1] >> 4));
+            } else if (partial_count_ == 3) {
+                put(expand444(partial_[1] & 0x0F, partial_[2] >> 4, partial_[2] & 0x0F));
+                partial_count_ = 0;
+            }
+            break;
+        case COLOR_MODE_MCU_16BIT:
+            if (partial_count_ == 2) {
+                put(static_cast<u16>((partial_[0] << 8) | partial_[1]));
+                partial_count_ = 0;
+            }
+            break;
+        default:
+            // RGB666 in the upper bits of each byte
+            if (partial_count_ == 3) {
+                put(static_cast<u16>(((partial_[0] >> 3) << 11) | ((partial_[1] >> 2) << 5) | (partial_[2] >> 3)));
+                partial_count_ = 0;
+            }
+            break;
+    }
+}
+
+/**
+ * @brief Store a pixel at the address counter and advance it
+ *
+ * MX and MY mirror the column and row address, MV then exchanges them.
+ */
+void GC9A01MockPanel::put(const u16 color565) {
+    u32 x = (madctl_ & MADCTL_MX) ? GC9A01_WIDTH - 1 - col_ : col_;
+    u32 y = (madctl_ & MADCTL_MY) ? GC9A01_HEIGHT - 1 - row_ : row_;
+    if (madctl_ & MADCTL_MV) {
+        std::swap(x, y);
+    }
+    if (x < GC9A01_WIDTH && y < GC9A01_HEIGHT) {
+        gram_[y * GC9A01_WIDTH + x] = color565;
+    }
+    pixels_written_++;
+    if (++col_ > col_end_) {
+        col_ = col_start_;
+        if (++row_ > row_end_) {
+            row_ = row_start_;
+        }
+    }
+}
+
+u16 GC9A01MockPanel::pixel(const u16 x, const u16 y) const {
+    return gram_[y * GC9A01_WIDTH + x];
+}
+
+const u16* GC9A01MockPanel::gram() const {
+    return gram_;
+}
+
+u16 GC9A01MockPanel::shown_pixel(const u16 x, const u16 y) const {
+    u32 row = y;
+    if (scroll_height_ > 0 && y >= top_fixed_ && y < top_fixed_ + scroll_height_) {
+        row = top_fixed_ + (y - top_fixed_ + scroll_start_ - top_fixed_ + scroll_height_) % scroll_height_;
+    }
+    return row < GC9A01_HEIGHT ? gram_[row * GC9A01_WIDTH + x] : 0;
+}
+
+u8 GC9A01MockPanel::madctl() const {
+    return madctl_;
+}
+
+u8 GC9A01MockPanel::colmod() const {
+    return colmod_;
+}
+
+bool GC9A01MockPanel::sleeping() const {
+    return sleeping_;
+}
+
+bool GC9A01MockPanel::display_on() const {
+    return display_on_;
+}
+
+bool GC9A01MockPanel::inverted() const {
+    return inverted_;
+}
+
+u16 GC9A01MockPanel::scroll_start() const {
+    return scroll_start_;
+}
+
+bool GC9A01MockPanel::tear_on() const {
+    return tear_on_;
+}
+
+u8 GC9A01MockPanel::tear_mode() const {
+    return tear_mode_;
+}
+
+u16 GC9A01MockPanel::tear_scanline() const {
+    return tear_scanline_;
+}
+
+void GC9A01MockPanel::tear() {
+    if (!tear_on_) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(tear_mutex_);
+        tears_++;
+    }
+    tear_pulse_.notify_all();
+}
+
+u32 GC9A01MockPanel::tears() const {
+    std::lock_guard<std::mutex> lock(tear_mutex_);
+    return tears_;
+}
+
+bool GC9A01MockPanel::has_tear() const {
+    return true;
+}
+
+/**
+ * @brief Wait for the next `tear()`
+ * @return `OK` on a pulse, `TIMEOUT` if none came in time
+ */
+GC9A01::Error GC9A01MockPanel::wait_tear(const TickType_t timeout) {
+    std::unique_lock<std::mutex> lock(tear_mutex_);
+    const u32 seen = tears_;
+    if (!tear_pulse_.wait_for(lock, std::chrono::milliseconds(static_cast<u64>(timeout) * portTICK_PERIOD_MS),
+                              [this, seen] { return tears_ != seen; })) {
+        return GC9A01::TIMEOUT;
+    }
+    return GC9A01::OK;
+}
+
+u64 GC9A01MockPanel::bus_time_ns() const {
+    return bus_time_ns_;
+}
+
+u32 GC9A01MockPanel::pixels_written() const {
+    return pixels_written_;
+}
+
+u32 GC9A01MockPanel::memory_writes() const {
+    return memory_writes_;
+}
+
+u32 GC9A01MockPanel::protocol_errors() const {
+    return protocol_errors_;
+}
+
+void GC9A01MockPanel::set_sck(const u32 sck_hz) {
+    sck_hz_ = sck_hz;
+}
+
+void GC9A01MockPanel::set_transaction_overhead(const u32 ns) {
+    overhead_ns_ = ns;
+}
+
+void GC9A01MockPanel::clear() {
+    GC9A01MemoryTransport::clear();
+    bus_time_ns_ = 0;
+    pixels_written_ = 0;
+    memory_writes_ = 0;
+    protocol_errors_ = 0;
+}
@@ -0,0 +1,456 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_private.h
+ * @brief Definitions shared by the driver sources, not part of the public API
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+
+#include "gc9a01.h"
+
+#ifdef ESP_PLATFORM
+// The project log level decides, debug messages are compiled out below `CONFIG_LOG_MAXIMUM_LEVEL`
+#include "esp_log.h"
+#endif
+
+
+#define CMD_SWRESET 0x01
+#define CMD_ID 0x04
+#define CMD_DISPLAY_STATUS 0x09
+#define CMD_SLEEP_ON 0x10
+#define CMD_SLEEP_OFF 0x11
+#define CMD_PARTIAL_MODE_ON 0x12
+#define CMD_NORMAL_MODE_ON 0x13
+#define CMD_INVERT_OFF 0x20
+#define CMD_INVERT_ON 0x21
+#define CMD_DISPLAY_OFF 0x28
+#define CMD_DISPLAY_ON 0x29
+#define CMD_COLADDRSET 0x2A
+#define CMD_ROWADDRSET 0x2B
+#define CMD_MEMORY_WRITE 0x2C
+#define CMD_PARTIAL_AREA 0x30
+#define CMD_VERTICAL_SCROLL 0x33
+#define CMD_TEARING_OFF 0x34
+#define CMD_TEARING_ON 0x35
+#define CMD_MEM_ACCESS_CTL 0x36
+#define CMD_VERTICAL_SCROLL_START_ADDR 0x37
+#define CMD_IDLE_OFF 0x38
+#define CMD_IDLE_ON 0x39
+#define CMD_COLMOD 0x3A
+#define CMD_WRITE_MEM_CONTINUE 0x3C
+#define CMD_SET_TEAR_SCANLINE 0x44
+#define CMD_GET_SCANLINE 0x45
+#define CMD_BRIGHTNESS 0x51
+#define CMD_CTRL_DISPLAY 0x53
+#define CMD_READ_ID1 0xDA
+#define CMD_READ_ID2 0xDB
+#define CMD_READ_ID3 0xDC
+
+// Extended command set as found in the datasheet
+#define CMD_RGB_INTERFACE_SIGNAL_CTRL 0xB0
+#define CMD_BLANKING_PORCH_CTRL 0xB5
+#define CMD_DISPLAY_FUNCTION_CTRL 0xB6
+#define CMD_TE_CTRL 0xBA
+#define CMD_INTERFACE_CTRL 0xF6
+#define CMD_POWER_CRITERION_CTRL 0xC1
+#define CMD_VCORE_VOLTAGE_CTRL 0xA7
+#define CMD_VREG1A_VOLTAGE_CTRL 0xC3
+#define CMD_VREG1B_VOLTAGE_CTRL 0xC4
+#define CMD_VREG2A_VOLTAGE_CTRL 0xC9
+#define CMD_FRAMERATE 0xE8
+#define CMD_SPI_2_DATA_CTRL 0xE9
+#define CMD_CHARGE_PUMP_FREQENT_CTRL 0xEC
+#define CMD_INTER_REG_EN_1 0xFE
+#define CMD_INTER_REG_EN_2 0xEF
+#define CMD_SET_GAMMA_1 0xF0
+#define CMD_SET_GAMMA_2 0xF1
+#define CMD_SET_GAMMA_3 0xF2
+#define CMD_SET_GAMMA_4 0xF3
+
+
+#define MADCTL_MY   0x80
+#define MADCTL_MX   0x40
+#define MADCTL_MV   0x20
+#define MADCTL_BGR  0x08
+
+#define ERROR_CHECK(error)\
+if ((error) != OK) {      \
+    return error;         \
+}
+
+// Transactions of a full write window setup: CASET + data, RASET + data, RAMWR
+#define WINDOW_SETUP_TRANSACTIONS 5
+
+// `present()` stops waiting for a TE pulse after this long, the panel sends one every ~16 ms
+#define GC9A01_TEAR_TIMEOUT_MS 100
+
+// Pixels that take about as long on the wire as setting up a new write window,
+// used to decide when sending some extra pixels beats another window
+#define WINDOW_COST_PIXELS 32
+
+/**
+ * Layout of the pixel data on the wire for a COLMOD setting.
+ *
+ * The driver works with RGB565 pixels everywhere, they are only converted to
+ * the wire format right before sending. A group is the smallest number of
+ * pixels ending on a byte boundary, a period the smallest number ending on a
+ * 32-bit boundary (used to repeat solid colors word by word).
+ */
+template <u32 GroupPixels, u32 GroupBytes, u32 PeriodPixels>
+struct PixelLayout {
+    static constexpr u32 group_pixels = GroupPixels;
+    static constexpr u32 group_bytes = GroupBytes;
+    static constexpr u32 period_pixels = PeriodPixels;
+    static constexpr u32 period_bytes = PeriodPixels / GroupPixels * GroupBytes;
+
+    // Bytes on the wire for `pixels` pixels, an incomplete group is padded
+    static constexpr u32 bytes(const u32 pixels) {
+        return (pixels * group_bytes + group_pixels - 1) / group_pixels;
+    }
+    // Complete pixels in `bytes` bytes
+    static constexpr u32 pixels(const u32 bytes) {
+        return bytes * group_pixels / group_bytes;
+    }
+    // Most pixels, in whole periods, that fit into `bytes` bytes
+    static constexpr u32 capacity(const u32 bytes) {
+        return pixels(bytes) / period_pixels * period_pixels;
+    }
+    // Like `capacity()`, but the RGB565 source has to fit as well for an in place `pack()`
+    static constexpr u32 staged_capacity(const u32 bytes) {
+        return capacity(bytes) < bytes / 2 / period_pixels * period_pixels
+            ? capacity(bytes) : bytes / 2 / period_pixels * period_pixels;
+    }
+};
+
+template <u8 ColorMode>
+struct PixelFormat;
+
+/**
+ * RGB565, 2 bytes per pixel. Big-endian RGB565 is already the wire format.
+ */
+template <>
+struct PixelFormat<COLOR_MODE_MCU_16BIT> : PixelLayout<1, 2, 2> {
+    static constexpr u8 colmod = COLOR_MODE_MCU_16BIT;
+    static constexpr bool identity = true;
+
+    // Convert `n` big-endian RGB565 pixels at the start of `buf` in place
+    static void pack(u8*, u32) {}
+};
+
+/**
+ * RGB666, 3 bytes per pixel with each channel in the upper 6 bits of a byte
+ */
+template <>
+struct PixelFormat<COLOR_MODE_MCU_18BIT> : PixelLayout<1, 3, 4> {
+    static constexpr u8 colmod = COLOR_MODE_MCU_18BIT;
+    static constexpr bool identity = false;
+
+    // Convert `n` big-endian RGB565 pixels at the start of `buf` in place,
+    // `buf` has to hold `bytes(n)` bytes. Runs backwards since the data grows.
+    static void pack(u8* buf, u32 n) {
+        while (n-- > 0) {
+            const u32 p = (static_cast<u32>(buf[2 * n]) << 8) | buf[2 * n + 1];
+            const u32 r = p >> 11;
+            const u32 g = (p >> 5) & 0x3F;
+            const u32 b = p & 0x1F;
+            buf[3 * n] = static_cast<u8>((r << 3) | (r >> 2));
+            buf[3 * n + 1] = static_cast<u8>((g << 2) | (g >> 4));
+            buf[3 * n + 2] = static_cast<u8>((b << 3) | (b >> 2));
+        }
+    }
+};
+
+/**
+ * RGB444, two pixels packed into 3 bytes. Costs a conversion but sends
+ * 25% fewer bytes than RGB565.
+ */
+template <>
+struct PixelFormat<COLOR_MODE_MCU_12BIT> : PixelLayout<2, 3, 8> {
+    static constexpr u8 colmod = COLOR_MODE_MCU_12BIT;
+    static constexpr bool identity = false;
+
+    // Convert `n` big-endian RGB565 pixels at the start of `buf` in place,
+    // an odd last pixel is padded to 2 bytes
+    static void pack(u8* buf, u32 n) {
+        convert(buf, buf, n);
+    }
+
+    // Convert `n` big-endian RGB565 pixels from `src` to `dst`, which may be the same buffer.
+    // Each 4 bytes in give 3 bytes out, so writing never overtakes reading.
+    static void convert(u8* dst, const u8* src, u32 n) {
+        for (; n >= 2; n -= 2, src += 4, dst += 3) {
+            // R4 G4 B4 of both pixels are the top bits of the RGB565 channels
+            const u32 p0 = (static_cast<u32>(src[0]) << 8) | src[1];
+            const u32 p1 = (static_cast<u32>(src[2]) << 8) | src[3];
+            const u32 c0 = ((p0 >> 4) & 0xF00) | ((p0 >> 3) & 0x0F0) | ((p0 >> 1) & 0x00F);
+            const u32 c1 = ((p1 >> 4) & 0xF00) | ((p1 >> 3) & 0x0F0) | ((p1 >> 1) & 0x00F);
+            dst[0] = static_cast<u8>(c0 >> 4);
+            dst[1] = static_cast<u8>((c0 << 4) | (c1 >> 8));
+            dst[2] = static_cast<u8>(c1);
+        }
+        if (n == 1) {
+            const u32 p0 = (static_cast<u32>(src[0]) << 8) | src[1];
+            const u32 c0 = ((p0 >> 4) & 0xF00) | ((p0 >> 3) & 0x0F0) | ((p0 >> 1) & 0x00F);
+            dst[0] = static_cast<u8>(c0 >> 4);
+            dst[1] = static_cast<u8>(c0 << 4);
+        }
+    }
+};
+
+/**
+ * @brief Complete pixels in `bytes` bytes of pixel data in color mode `colmod`
+ */
+constexpr u32 wire_pixels(const u8 colmod, const u32 bytes) {
+    switch (colmod) {
+    case COLOR_MODE_MCU_12BIT:
+        return PixelFormat<COLOR_MODE_MCU_12BIT>::pixels(bytes);
+    case COLOR_MODE_MCU_18BIT:
+        return PixelFormat<COLOR_MODE_MCU_18BIT>::pixels(bytes);
+    default:
+        return PixelFormat<COLOR_MODE_MCU_16BIT>::pixels(bytes);
+    }
+}
+
+// sin(0..90 degrees) in Q15
+inline constexpr i16 sin_table[91] = {
+    0, 572, 1144, 1715, 2286, 2856, 3425, 3993, 4560, 5126,
+    5690, 6252, 6813, 7371, 7927, 8481, 9032, 9580, 10126, 10668,
+    11207, 11743, 12275, 12803, 13328, 13848, 14364, 14876, 15383, 15886,
+    16383, 16876, 17364, 17846, 18323, 18794, 19260, 19720, 20173, 20621,
+    21062, 21497, 21925, 22347, 22762, 23170, 23571, 23964, 24351, 24730,
+    25101, 25465, 25821, 26169, 26509, 26841, 27165, 27481, 27788, 28087,
+    28377, 28659, 28932, 29196, 29451, 29697, 29934, 30162, 30381, 30591,
+    30791, 30982, 31163, 31335, 31498, 31650, 31794, 31927, 32051, 32165,
+    32269, 32364, 32448, 32523, 32587, 32642, 32687, 32722, 32747, 32762,
+    32767
+};
+
+/**
+ * @brief Sine of `deg` degrees in Q15
+ */
+inline i32 sin_q15(i32 deg) {
+    deg %= 360;
+    if (deg < 0) {
+        deg += 360;
+    }
+    if (deg <= 90) {
+        return sin_table[deg];
+    }
+    if (deg <= 180) {
+        return sin_table[180 - deg];
+    }
+    if (deg <= 270) {
+        return -sin_table[deg - 180];
+    }
+    return -sin_table[360 - deg];
+}
+
+/**
+ * @brief Cosine of `deg` degrees in Q15
+ */
+inline i32 cos_q15(const i32 deg) {
+    return sin_q15(deg + 90);
+}
+
+/**
+ * @brief Sine of `decideg` tenths of a degree in Q15, interpolated between whole degrees
+ */
+inline i32 sin_q15_fine(i32 decideg) {
+    decideg %= 3600;
+    if (decideg < 0) {
+        decideg += 3600;
+    }
+    const i32 deg = decideg / 10;
+    const i32 low = sin_q15(deg);
+    return low + (sin_q15(deg + 1) - low) * (decideg % 10) / 10;
+}
+
+/**
+ * @brief Cosine of `decideg` tenths of a degree in Q15
+ */
+inline i32 cos_q15_fine(const i32 decideg) {
+    return sin_q15_fine(decideg + 900);
+}
+
+#ifdef CONFIG_GC9A01_ROUND_MASK
+// Visible columns of a row, `x1` is exclusive and equal to `x0` for invisible rows
+struct RowSpan {
+    u16 x0;
+    u16 x1;
+};
+
+/**
+ * Visible columns of every row on the round panel. A pixel is visible if
+ * its center lies inside the circle inscribed into the panel.
+ */
+constexpr std::array<RowSpan, GC9A01_HEIGHT> make_round_mask() {
+    constexpr i32 diameter = GC9A01_WIDTH < GC9A01_HEIGHT ? GC9A01_WIDTH : GC9A01_HEIGHT;
+    std::array<RowSpan, GC9A01_HEIGHT> mask = {};
+    for (i32 y = 0; y < GC9A01_HEIGHT; y++) {
+        // Work with doubled coordinates to stay on integers
+        const i32 dy = 2 * y + 1 - GC9A01_HEIGHT;
+        const i32 rest = diameter * diameter - dy * dy;
+        if (rest < 0) {
+            mask[y] = {0, 0};
+            continue;
+        }
+        i32 s = 0;
+        while ((s + 1) * (s + 1) <= rest) {
+            s++;
+        }
+        // |2x + 1 - width| <= s
+        i32 x0 = (GC9A01_WIDTH - 1 - s + 1) / 2;
+        i32 x1 = (GC9A01_WIDTH - 1 + s) / 2 + 1;
+        x0 = x0 < 0 ? 0 : x0;
+        x1 = x1 > GC9A01_WIDTH ? GC9A01_WIDTH : x1;
+        mask[y] = {static_cast<u16>(x0), static_cast<u16>(x1)};
+    }
+    return mask;
+}
+
+inline constexpr std::array<RowSpan, GC9A01_HEIGHT> round_mask = make_round_mask();
+
+constexpr u32 count_visible_pixels() {
+    u32 count = 0;
+    for (const RowSpan& span : round_mask) {
+        count += span.x1 - span.x0;
+    }
+    return count;
+}
+
+// Number of pixels behind the glass
+inline constexpr u32 visible_pixels = count_visible_pixels();
+
+// Area of the screen sent with one write window
+struct Band {
+    u16 x;
+    u16 y;
+    u16 w;
+    u16 h;
+};
+
+/**
+ * @brief Find the next band of visible pixels in the columns `x` to `x + w`
+ *
+ * Consecutive rows share a band as long as the extra invisible pixels this
+ * costs stay below the cost of a new write window.
+ *
+ * @param x first column
+ * @param w number of columns
+ * @param row first row to look at, advanced past the band
+ * @param end_row row to stop at (exclusive)
+ * @param band the band found
+ * @return `false` if no visible row is left
+ */
+inline bool next_visible_band(const u16 x, const u16 w, u16& row, const u16 end_row, Band& band) {
+    const auto visible = [&](const u16 r, u16& from, u16& to) {
+        from = std::max<u16>(x, round_mask[r].x0);
+        to = std::min<u16>(x + w, round_mask[r].x1);
+        return from < to;
+    };
+    u16 from = 0;
+    u16 to = 0;
+    while (row < end_row && !visible(row, from, to)) {
+        row++;
+    }
+    if (row >= end_row) {
+        return false;
+    }
+    band = {from, row, static_cast<u16>(to - from), 1};
+    u32 pixels = to - from;
+    for (row++; row < end_row && visible(row, from, to); row++) {
+        const u16 x0 = std::min(band.x, from);
+        const u16 x1 = std::max<u16>(band.x + band.w, to);
+        const u32 waste = static_cast<u32>(band.w) * band.h - pixels;
+        const u32 grown = static_cast<u32>(x1 - x0) * (band.h + 1) - (pixels + to - from);
+        if (grown - waste > WINDOW_COST_PIXELS) {
+            break;
+        }
+        band.x = x0;
+        band.w = x1 - x0;
+        band.h++;
+        pixels += to - from;
+    }
+    return true;
+}
+#endif
+
+/**
+ * @brief Set the bits `first` to `first + n` (exclusive) of a bit array
+ */
+inline void set_bits(u32* bits, u32 first, u32 n) {
+    for (; n > 0 && (first & 31) != 0; first++, n--) {
+        bits[first >> 5] |= 1u << (first & 31);
+    }
+    for (; n >= 32; first += 32, n -= 32) {
+        bits[first >> 5] = UINT32_MAX;
+    }
+    for (; n > 0; first++, n--) {
+        bits[first >> 5] |= 1u << (first & 31);
+    }
+}
+
+inline bool test_bit(const u32* bits, const u32 index) {
+    return (bits[index >> 5] >> (index & 31)) & 1;
+}
+
+/**
+ * @brief Copy `n` pixels from `src` to `dst`, swapping the bytes of each pixel
+ *
+ * Two pixels are swapped at once with 32-bit operations when both pointers allow it.
+ */
+inline void swap_copy(u16* dst, const u16* src, u32 n) {
+    if (((reinterpret_cast<uintptr_t>(src) | reinterpret_cast<uintptr_t>(dst)) & 3) == 0) {
+        const u32* s32 = reinterpret_cast<const u32*>(src);
+        u32* d32 = reinterpret_cast<u32*>(dst);
+        for (u32 i = 0; i < n / 2; i++) {
+            const u32 w = s32[i];
+            d32[i] = ((w & 0x00FF00FF) << 8) | ((w >> 8) & 0x00FF00FF);
+        }
+        if (n & 1) {
+            dst[n - 1] = static_cast<u16>((src[n - 1] >> 8) | (src[n - 1] << 8));
+        }
+        return;
+    }
+    for (u32 i = 0; i < n; i++) {
+        dst[i] = static_cast<u16>((src[i] >> 8) | (src[i] << 8));
+    }
+}
+
+/**
+ * @brief Wait until `esp_timer_get_time()` reaches `deadline`
+ *
+ * Whole ticks are slept, only the remainder below one tick is busy-waited.
+ *
+ * @param deadline Time in microseconds since boot
+ */
+inline void delay_until(const i64 deadline) {
+    constexpr i64 tick_us = portTICK_PERIOD_MS * 1000;
+    i64 remaining;
+    while ((remaining = deadline - esp_timer_get_time()) > 0) {
+        if (remaining >= tick_us) {
+            vTaskDelay(remaining / tick_us);
+        } else {
+            esp_rom_delay_us(remaining);
+        }
+    }
+}
+
+// Attribute statistics and trace entries to `primitive` until the end of the scope
+#if defined(CONFIG_GC9A01_STATS) || defined(CONFIG_GC9A01_TRACE)
+#define PRIMITIVE(primitive) const PrimitiveScope primitive_scope(this, primitive)
+#else
+#define PRIMITIVE(primitive)
+#endif
+
+#ifdef ESP_PLATFORM
+// Even compiled in, ESP_LOGD costs a level check per call: keep it out of
+// per-transaction paths, the trace covers those
+#define LOG(msg, args...) ESP_LOGD("gc9a01", msg, ##args)
+#else
+#define LOG(msg, args...)
+#endif
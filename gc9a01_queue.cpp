@@ -0,0 +1,388 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_queue.cpp
+ * @brief Drawing from any task through a lock-free command queue and a display task
+ */
+
+#include "gc9a01_queue.h"
+#include "gc9a01_private.h"
+
+using Error = GC9A01::Error;
+
+/**
+ * @param display Display the commands are run on, only the display task may use it after `begin()`
+ */
+GC9A01CommandQueue::GC9A01CommandQueue(GC9A01& display) :
+    display_(display),
+    work_(xSemaphoreCreateBinary()),
+    space_(xSemaphoreCreateBinary()),
+    passed_(xSemaphoreCreateBinary()),
+    stopped_(xSemaphoreCreateBinary())
+{
+    for (u32 i = 0; i < CONFIG_GC9A01_COMMAND_QUEUE_SIZE; i++) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+GC9A01CommandQueue::~GC9A01CommandQueue() {
+    end();
+    for (SemaphoreHandle_t sem : {work_, space_, passed_, stopped_}) {
+        if (sem != nullptr) {
+            vSemaphoreDelete(sem);
+        }
+    }
+}
+
+/**
+ * @brief Start the display task
+ *
+ * @param core Core the task is pinned to, `tskNO_AFFINITY` for any
+ * @param priority FreeRTOS priority of the task
+ * @return `OK` on success, `OUT_OF_MEMORY` if the task could not be created
+ */
+Error GC9A01CommandQueue::begin(const BaseType_t core, const UBaseType_t priority) {
+    if (running_) {
+        return GC9A01::OK;
+    }
+    if (work_ == nullptr || space_ == nullptr || passed_ == nullptr || stopped_ == nullptr) {
+        return GC9A01::OUT_OF_MEMORY;
+    }
+    if (xTaskCreatePinnedToCore(task, "gc9a01", 4096, this, priority, nullptr, core) != pdPASS) {
+        return GC9A01::OUT_OF_MEMORY;
+    }
+    running_ = true;
+    return GC9A01::OK;
+}
+
+/**
+ * @brief Run everything submitted so far, then stop the display task
+ *
+ * The display may be used directly again afterwards.
+ */
+void GC9A01CommandQueue::end() {
+    if (!running_) {
+        return;
+    }
+    Command command = {};
+    command.op = OP_STOP;
+    submit(command);
+    xSemaphoreTake(stopped_, portMAX_DELAY);
+    running_ = false;
+}
+
+/**
+ * @brief Append a command to the ring, fails if it is full
+ *
+ * Each cell carries a sequence number: a producer may write the cell at
+ * position `pos` once its sequence is `pos`, and publishes it by setting it
+ * to `pos + 1`. The display task hands the cell back for the next round by
+ * setting it to `pos + size`. Producers only race for `head_`.
+ *
+ * @param ticket Position of the command
+ * @return `true` if the command was queued
+ */
+bool GC9A01CommandQueue::push(const Command& command, u32& ticket) {
+    u32 pos = head_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells_[pos & (CONFIG_GC9A01_COMMAND_QUEUE_SIZE - 1)];
+        const i32 diff = static_cast<i32>(cell->sequence.load(std::memory_order_acquire) - pos);
+        if (diff == 0) {
+            if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The display task did not take the command of the last round yet
+            return false;
+        } else {
+            pos = head_.load(std::memory_order_relaxed);
+        }
+    }
+    cell->command = command;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    ticket = pos;
+    return true;
+}
+
+/**
+ * @brief Take the next command, only called by the display task
+ * @return `false` if the queue is empty
+ */
+bool GC9A01CommandQueue::pop(Command& command) {
+    Cell& cell = cells_[tail_ & (CONFIG_GC9A01_COMMAND_QUEUE_SIZE - 1)];
+    if (static_cast<i32>(cell.sequence.load(std::memory_order_acquire) - (tail_ + 1)) < 0) {
+        return false;
+    }
+    command = cell.command;
+    cell.sequence.store(tail_ + CONFIG_GC9A01_COMMAND_QUEUE_SIZE, std::memory_order_release);
+    tail_++;
+    return true;
+}
+
+/**
+ * @brief Queue a command, waiting while the queue is full
+ * @param ticket Set to the position of the command if not `nullptr`
+ * @return `OK`
+ */
+Error GC9A01CommandQueue::submit(const Command& command, u32* ticket) {
+    u32 pos;
+    if (!push(command, pos)) {
+        full_waiters_.fetch_add(1);
+        // Checked again after announcing the wait, the display task might have missed it
+        while (!push(command, pos)) {
+            xSemaphoreTake(space_, 1);
+        }
+        full_waiters_.fetch_sub(1);
+    }
+    if (ticket != nullptr) {
+        *ticket = pos;
+    }
+    // Pairs with the fence in `task()`: either it sees the command or we see it idle
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idle_.exchange(false)) {
+        xSemaphoreGive(work_);
+    }
+    return GC9A01::OK;
+}
+
+void GC9A01CommandQueue::task(void* arg) {
+    GC9A01CommandQueue* self = static_cast<GC9A01CommandQueue*>(arg);
+    Command command;
+    for (;;) {
+        if (!self->pop(command)) {
+            self->idle_.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!self->pop(command)) {
+                xSemaphoreTake(self->work_, portMAX_DELAY);
+                continue;
+            }
+            self->idle_.store(false);
+        }
+        if (self->full_waiters_.load() > 0) {
+            xSemaphoreGive(self->space_);
+        }
+        if (command.op == OP_STOP) {
+            self->done_.fetch_add(1, std::memory_order_release);
+            break;
+        }
+        const Error err = self->run(command);
+        if (err != GC9A01::OK) {
+            Error none = GC9A01::OK;
+            self->error_.compare_exchange_strong(none, err);
+        }
+        self->done_.fetch_add(1, std::memory_order_release);
+        if (self->sync_waiters_.load() > 0) {
+            xSemaphoreGive(self->passed_);
+        }
+    }
+    xSemaphoreGive(self->stopped_);
+    vTaskDelete(nullptr);
+}
+
+/**
+ * @brief Run a command on the display
+ * @return The result of the drawing call
+ */
+Error GC9A01CommandQueue::run(const Command& command) {
+    const i16* a = command.args;
+    const Color color = command.color;
+    const u16* pixels = static_cast<const u16*>(command.ptr);
+    const GC9A01Sprite& sprite = *static_cast<const GC9A01Sprite*>(command.ptr);
+    switch (command.op) {
+    case OP_SET_PIXEL:
+        return display_.set_pixel(a[0], a[1], color);
+    case OP_BITMAP:
+        return display_.draw_bitmap(a[0], a[1], a[2], a[3], pixels);
+    case OP_BITMAP_BE:
+        return display_.draw_bitmap_be(a[0], a[1], a[2], a[3], pixels);
+    case OP_IMAGE:
+        return display_.draw_image(a[0], a[1], static_cast<const u8*>(command.ptr),
+                                   static_cast<u16>(a[2]) | static_cast<u32>(static_cast<u16>(a[3])) << 16);
+    case OP_SPRITE:
+        return display_.draw_sprite(a[0], a[1], sprite, color);
+    case OP_ROTATED:
+        return display_.draw_rotated(a[0], a[1], sprite, a[2], a[3], a[4], a[5], color);
+    case OP_TEXT:
+        return display_.draw_text(a[0], a[1], static_cast<const char*>(command.ptr),
+                                  *static_cast<const GC9A01Font*>(command.aux), color, command.background);
+    case OP_HLINE:
+        return display_.draw_hline(a[0], a[1], a[2], color);
+    case OP_VLINE:
+        return display_.draw_vline(a[0], a[1], a[2], color);
+    case OP_LINE:
+        return display_.draw_line(a[0], a[1], a[2], a[3], color);
+    case OP_RECT:
+        return display_.draw_rect(a[0], a[1], a[2], a[3], color);
+    case OP_ROUND_RECT:
+        return display_.draw_round_rect(a[0], a[1], a[2], a[3], a[4], color);
+    case OP_CIRCLE:
+        return display_.draw_circle(a[0], a[1], a[2], color);
+    case OP_ARC:
+        return display_.draw_arc(a[0], a[1], a[2], a[3], a[4], a[5], color);
+    case OP_TRIANGLE:
+        return display_.draw_triangle(a[0], a[1], a[2], a[3], a[4], a[5], color);
+    case OP_FILL_RECT:
+        return display_.fill_rect(a[0], a[1], a[2], a[3], color);
+    case OP_FILL_ROUND_RECT:
+        return display_.fill_round_rect(a[0], a[1], a[2], a[3], a[4], color);
+    case OP_FILL_CIRCLE:
+        return display_.fill_circle(a[0], a[1], a[2], color);
+    case OP_FILL_TRIANGLE:
+        return display_.fill_triangle(a[0], a[1], a[2], a[3], a[4], a[5], color);
+    case OP_FILL:
+        return display_.fill(color);
+    case OP_ROTATION:
+        return display_.set_rotation(a[0]);
+    case OP_FLUSH:
+        return display_.flush();
+    case OP_PRESENT:
+        return display_.present();
+    case OP_CALL:
+        return command.function(display_, const_cast<void*>(command.ptr));
+    case OP_SYNC:
+        return display_.sync();
+    default:
+        return GC9A01::INVALID_ARGUMENT;
+    }
+}
+
+Error GC9A01CommandQueue::set_pixel(const i16 x, const i16 y, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x, y}, color, {}, OP_SET_PIXEL});
+}
+
+Error GC9A01CommandQueue::draw_bitmap(const i16 x, const i16 y, const u16 w, const u16 h, const u16* data) {
+    return submit({nullptr, data, nullptr, {x, y, static_cast<i16>(w), static_cast<i16>(h)}, {}, {}, OP_BITMAP});
+}
+
+Error GC9A01CommandQueue::draw_bitmap_be(const i16 x, const i16 y, const u16 w, const u16 h, const u16* data) {
+    return submit({nullptr, data, nullptr, {x, y, static_cast<i16>(w), static_cast<i16>(h)}, {}, {}, OP_BITMAP_BE});
+}
+
+// The size is split over two arguments
+Error GC9A01CommandQueue::draw_image(const i16 x, const i16 y, const u8* image, const u32 size) {
+    return submit({nullptr, image, nullptr, {x, y, static_cast<i16>(size & 0xFFFF), static_cast<i16>(size >> 16)}, {}, {}, OP_IMAGE});
+}
+
+Error GC9A01CommandQueue::draw_sprite(const i16 x, const i16 y, const GC9A01Sprite& sprite, const Color background) {
+    return submit({nullptr, &sprite, nullptr, {x, y}, background, {}, OP_SPRITE});
+}
+
+Error GC9A01CommandQueue::draw_rotated(const i16 x, const i16 y, const GC9A01Sprite& sprite, const i16 pivot_x, const i16 pivot_y,
+                                       const i16 angle, const u16 scale, const Color background) {
+    return submit({nullptr, &sprite, nullptr, {x, y, pivot_x, pivot_y, angle, static_cast<i16>(scale)}, background, {}, OP_ROTATED});
+}
+
+Error GC9A01CommandQueue::draw_text(const i16 x, const i16 y, const char* text, const GC9A01Font& font, const Color color,
+                                    const Color background) {
+    return submit({nullptr, text, &font, {x, y}, color, background, OP_TEXT});
+}
+
+Error GC9A01CommandQueue::draw_hline(const i16 x, const i16 y, const u16 w, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x, y, static_cast<i16>(w)}, color, {}, OP_HLINE});
+}
+
+Error GC9A01CommandQueue::draw_vline(const i16 x, const i16 y, const u16 h, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x, y, static_cast<i16>(h)}, color, {}, OP_VLINE});
+}
+
+Error GC9A01CommandQueue::draw_line(const i16 x0, const i16 y0, const i16 x1, const i16 y1, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x0, y0, x1, y1}, color, {}, OP_LINE});
+}
+
+Error GC9A01CommandQueue::draw_rect(const i16 x, const i16 y, const u16 w, const u16 h, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x, y, static_cast<i16>(w), static_cast<i16>(h)}, color, {}, OP_RECT});
+}
+
+Error GC9A01CommandQueue::draw_round_rect(const i16 x, const i16 y, const u16 w, const u16 h, const u16 r, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x, y, static_cast<i16>(w), static_cast<i16>(h), static_cast<i16>(r)}, color, {}, OP_ROUND_RECT});
+}
+
+Error GC9A01CommandQueue::draw_circle(const i16 x, const i16 y, const u16 r, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x, y, static_cast<i16>(r)}, color, {}, OP_CIRCLE});
+}
+
+Error GC9A01CommandQueue::draw_arc(const i16 x, const i16 y, const u16 r_outer, const u16 r_inner, const i16 start, const i16 end, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x, y, static_cast<i16>(r_outer), static_cast<i16>(r_inner), start, end}, color, {}, OP_ARC});
+}
+
+Error GC9A01CommandQueue::draw_triangle(const i16 x0, const i16 y0, const i16 x1, const i16 y1, const i16 x2, const i16 y2, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x0, y0, x1, y1, x2, y2}, color, {}, OP_TRIANGLE});
+}
+
+Error GC9A01CommandQueue::fill_rect(const i16 x, const i16 y, const u16 w, const u16 h, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x, y, static_cast<i16>(w), static_cast<i16>(h)}, color, {}, OP_FILL_RECT});
+}
+
+Error GC9A01CommandQueue::fill_round_rect(const i16 x, const i16 y, const u16 w, const u16 h, const u16 r, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x, y, static_cast<i16>(w), static_cast<i16>(h), static_cast<i16>(r)}, color, {}, OP_FILL_ROUND_RECT});
+}
+
+Error GC9A01CommandQueue::fill_circle(const i16 x, const i16 y, const u16 r, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x, y, static_cast<i16>(r)}, color, {}, OP_FILL_CIRCLE});
+}
+
+Error GC9A01CommandQueue::fill_triangle(const i16 x0, const i16 y0, const i16 x1, const i16 y1, const i16 x2, const i16 y2, const Color color) {
+    return submit({nullptr, nullptr, nullptr, {x0, y0, x1, y1, x2, y2}, color, {}, OP_FILL_TRIANGLE});
+}
+
+Error GC9A01CommandQueue::fill(const Color color) {
+    return submit({nullptr, nullptr, nullptr, {}, color, {}, OP_FILL});
+}
+
+Error GC9A01CommandQueue::set_rotation(const u8 rotation) {
+    return submit({nullptr, nullptr, nullptr, {rotation}, {}, {}, OP_ROTATION});
+}
+
+Error GC9A01CommandQueue::flush() {
+    return submit({nullptr, nullptr, nullptr, {}, {}, {}, OP_FLUSH});
+}
+
+Error GC9A01CommandQueue::present() {
+    return submit({nullptr, nullptr, nullptr, {}, {}, {}, OP_PRESENT});
+}
+
+/**
+ * @brief Run `function(display, arg)` on the display task, for methods without a command
+ *
+ * `arg` is passed on when the command runs, whatever it points to has to stay
+ * valid until then, i.e. until `sync()` returned.
+ */
+Error GC9A01CommandQueue::call(const Function function, void* arg) {
+    return submit({function, arg, nullptr, {}, {}, {}, OP_CALL});
+}
+
+/**
+ * @brief Wait until every command submitted before was run and sent
+ *
+ * @param timeout Ticks to wait
+ * @return `OK`, `TIMEOUT` if the commands did not finish in time
+ */
+Error GC9A01CommandQueue::sync(const TickType_t timeout) {
+    u32 ticket;
+    submit({nullptr, nullptr, nullptr, {}, {}, {}, OP_SYNC}, &ticket);
+    const i64 deadline = esp_timer_get_time() + static_cast<i64>(timeout) * portTICK_PERIOD_MS * 1000;
+    const auto passed = [this, ticket] {
+        return static_cast<i32>(done_.load(std::memory_order_acquire) - ticket) > 0;
+    };
+    if (passed()) {
+        return GC9A01::OK;
+    }
+    sync_waiters_.fetch_add(1);
+    Error err = GC9A01::OK;
+    // Other tasks may take the signal, so check again at least every tick
+    while (!passed()) {
+        if (timeout != portMAX_DELAY && esp_timer_get_time() >= deadline) {
+            err = GC9A01::TIMEOUT;
+            break;
+        }
+        xSemaphoreTake(passed_, 1);
+    }
+    sync_waiters_.fetch_sub(1);
+    return err;
+}
+
+Error GC9A01CommandQueue::error() {
+    return error_.exchange(GC9A01::OK);
+}
@@ -0,0 +1,562 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_shapes.cpp
+ * @brief Span based rasterizer for lines, circles, arcs, rounded rectangles and triangles
+ *
+ * Every shape is broken into horizontal or vertical runs of pixels. Each run
+ * costs one write window and one burst, instead of one window per pixel.
+ * Runs are clipped against the screen by `clip_fill()`.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "gc9a01.h"
+#include "gc9a01_private.h"
+
+/**
+ * @brief Integer square root, rounded down
+ */
+static u32 isqrt(u32 value) {
+    u32 result = 0;
+    u32 bit = 1u << 30;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+/**
+ * @brief Half width of the row `dy` rows away from the center of a circle with radius `r`
+ *
+ * Uses `r * r + r` as the squared radius, which gives the same shape as the
+ * midpoint circle algorithm.
+ *
+ * @return Half width, `-1` if the row is outside the circle
+ */
+static i32 half_width(const i32 r, i32 dy) {
+    dy = std::abs(dy);
+    if (r < 0 || dy > r) {
+        return -1;
+    }
+    return isqrt(static_cast<u32>(r * r + r - dy * dy));
+}
+
+/**
+ * @brief Runs of pixels of row `dy` of a circle with radius `r`
+ *
+ * The outline is the one of the midpoint circle algorithm, the same in all
+ * eight octants. Where it is flat, a row has the pixels up to where the row
+ * one step further out starts. Where it is steep, only the outermost pixel.
+ * An outline row has one run per side, except for the flat top and bottom
+ * rows which are a single run.
+ *
+ * @param runs first and last column (inclusive) of each run, relative to the center
+ * @return Number of runs, 0 if the row is outside the circle
+ */
+u8 GC9A01::circle_runs(const i32 r, const i32 dy, const bool filled, i32 runs[2][2]) {
+    const i32 outer = half_width(r, dy);
+    if (outer < 0) {
+        return 0;
+    }
+    i32 from = 0;
+    if (!filled) {
+        const i32 b = std::abs(dy);
+        // Flat octants end at the diagonal, the steep ones add the outermost pixel
+        const i32 flat_from = half_width(r, b + 1) + 1;
+        from = flat_from <= std::min(outer, b) ? flat_from : outer;
+    }
+    if (from == 0) {
+        runs[0][0] = -outer;
+        runs[0][1] = outer;
+        return 1;
+    }
+    runs[0][0] = -outer;
+    runs[0][1] = -from;
+    runs[1][0] = from;
+    runs[1][1] = outer;
+    return 2;
+}
+
+/**
+ * @brief Interval of `dx` for which `a * dx >= b`
+ */
+static void half_plane(const i64 a, const i64 b, i32& lo, i32& hi) {
+    // Far outside of any circle
+    constexpr i32 unbounded = 1 << 20;
+    // Division rounding towards negative infinity
+    const auto floor_div = [](const i64 n, const i64 d) {
+        return n / d - ((n % d != 0) && ((n < 0) != (d < 0)) ? 1 : 0);
+    };
+    if (a > 0) {
+        lo = -floor_div(-b, a);
+        hi = unbounded;
+    } else if (a < 0) {
+        lo = -unbounded;
+        hi = floor_div(b, a);
+    } else if (b <= 0) {
+        lo = -unbounded;
+        hi = unbounded;
+    } else {
+        lo = unbounded;
+        hi = -unbounded;
+    }
+}
+
+/**
+ * @brief Draw a line from `x0`, `y0` to `x1`, `y1` with a `color`
+ *
+ * Bresenham's algorithm, with consecutive pixels on the same row (or column
+ * for steep lines) sent as one run.
+ *
+ * @param x0 `x0` coordinate
+ * @param y0 `y0` coordinate
+ * @param x1 `x1` coordinate
+ * @param y1 `y1` coordinate
+ * @param color Color of the line
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::draw_line(const i16 x0, const i16 y0, const i16 x1, const i16 y1, const Color color) const {
+    PRIMITIVE(PRIM_LINE);
+    const u16 color16 = color.to_16bit();
+    if (y0 == y1) {
+        return finish(clip_fill(std::min(x0, x1), y0, std::abs(x1 - x0) + 1, 1, color16));
+    }
+    if (x0 == x1) {
+        return finish(clip_fill(x0, std::min(y0, y1), 1, std::abs(y1 - y0) + 1, color16));
+    }
+
+    const i32 dx = std::abs(x1 - x0);
+    const i32 dy = -std::abs(y1 - y0);
+    const i32 sx = x0 < x1 ? 1 : -1;
+    const i32 sy = y0 < y1 ? 1 : -1;
+    // Runs are horizontal for flat lines and vertical for steep ones
+    const bool flat = dx >= -dy;
+    i32 err = dx + dy;
+    i32 x = x0;
+    i32 y = y0;
+    i32 run_x = x0;
+    i32 run_y = y0;
+    Error result;
+
+    const auto emit_run = [&](const i32 end_x, const i32 end_y) {
+        if (flat) {
+            return clip_fill(std::min(run_x, end_x), run_y, std::abs(end_x - run_x) + 1, 1, color16);
+        }
+        return clip_fill(run_x, std::min(run_y, end_y), 1, std::abs(end_y - run_y) + 1, color16);
+    };
+
+    while (x != x1 || y != y1) {
+        const i32 e2 = 2 * err;
+        i32 next_x = x;
+        i32 next_y = y;
+        if (e2 >= dy) {
+            err += dy;
+            next_x += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            next_y += sy;
+        }
+        // The run ends when the minor coordinate changes
+        if (flat ? next_y != y : next_x != x) {
+            result = emit_run(x, y);
+            ERROR_CHECK(result);
+            run_x = next_x;
+            run_y = next_y;
+        }
+        x = next_x;
+        y = next_y;
+    }
+    return finish(emit_run(x, y));
+}
+
+/**
+ * @brief Draw a circle with center `x0`, `y0` and radius `r` with a `color`
+ *
+ * One octant is walked from the top down to the diagonal. Each of its rows is
+ * sent mirrored as horizontal runs above and below the center, and as
+ * vertical runs left and right of it for the steep octants. The top and
+ * bottom rows and the leftmost and rightmost columns are a single run.
+ *
+ * @param x0 `x` coordinate of the center
+ * @param y0 `y` coordinate of the center
+ * @param r radius
+ * @param color Color of the circle
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::draw_circle(const i16 x0, const i16 y0, const u16 r, const Color color) const {
+    PRIMITIVE(PRIM_CIRCLE);
+    const u16 color16 = color.to_16bit();
+#ifdef CONFIG_GC9A01_BAND_MODE
+    // One display list entry instead of a run per row
+    return finish(record_circle(x0, y0, r, false, color16));
+#else
+    Error err;
+    // Run from `from` to `to` (inclusive) of the octant row `b`, mirrored into all eight octants
+    const auto emit = [&](const i32 b, const i32 from, const i32 to) {
+        Error result;
+        const i32 n = to - from + 1;
+        for (const i32 side : {-b, b}) {
+            if (from == 0) {
+                result = clip_fill(x0 - to, y0 + side, 2 * to + 1, 1, color16);
+                ERROR_CHECK(result);
+                result = clip_fill(x0 + side, y0 - to, 1, 2 * to + 1, color16);
+                ERROR_CHECK(result);
+            } else {
+                result = clip_fill(x0 - to, y0 + side, n, 1, color16);
+                ERROR_CHECK(result);
+                result = clip_fill(x0 + from, y0 + side, n, 1, color16);
+                ERROR_CHECK(result);
+                result = clip_fill(x0 + side, y0 - to, 1, n, color16);
+                ERROR_CHECK(result);
+                result = clip_fill(x0 + side, y0 + from, 1, n, color16);
+                ERROR_CHECK(result);
+            }
+            if (b == 0) {
+                break;
+            }
+        }
+        return OK;
+    };
+    for (i32 b = r; b >= 0; b--) {
+        const i32 from = half_width(r, b + 1) + 1;
+        if (from > b) {
+            break;
+        }
+        const i32 to = std::min(half_width(r, b), b);
+        if (from <= to) {
+            err = emit(b, from, to);
+            ERROR_CHECK(err);
+        }
+    }
+    return finish(OK);
+#endif
+}
+
+/**
+ * @brief Draw a filled circle with center `x0`, `y0` and radius `r` with a `color`
+ *
+ * @param x0 `x` coordinate of the center
+ * @param y0 `y` coordinate of the center
+ * @param r radius
+ * @param color Color of the circle
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::fill_circle(const i16 x0, const i16 y0, const u16 r, const Color color) const {
+    PRIMITIVE(PRIM_FILL_CIRCLE);
+    const u16 color16 = color.to_16bit();
+#ifdef CONFIG_GC9A01_BAND_MODE
+    return finish(record_circle(x0, y0, r, true, color16));
+#else
+    const i32 first = std::max<i32>(-r, -y0);
+    const i32 last = std::min<i32>(r, GC9A01_HEIGHT - 1 - y0);
+    Error err;
+    for (i32 dy = first; dy <= last; dy++) {
+        const i32 hw = half_width(r, dy);
+        err = clip_fill(x0 - hw, y0 + dy, 2 * hw + 1, 1, color16);
+        ERROR_CHECK(err);
+    }
+    return finish(OK);
+#endif
+}
+
+/**
+ * @brief Draw a ring segment around `x0`, `y0` with a `color`
+ *
+ * Covers every pixel between `r_inner` and `r_outer` (both inclusive) from the
+ * angle `start` to `end`. Angles are in degrees, 0 is at 12 o'clock and they
+ * increase clockwise. A range of 360 degrees or more draws the full ring,
+ * `r_inner` of 0 draws a pie slice.
+ *
+ * @param x0 `x` coordinate of the center
+ * @param y0 `y` coordinate of the center
+ * @param r_outer outer radius
+ * @param r_inner inner radius
+ * @param start start angle in degrees
+ * @param end end angle in degrees
+ * @param color Color of the arc
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::draw_arc(const i16 x0, const i16 y0, u16 r_outer, u16 r_inner, const i16 start, const i16 end, const Color color) const {
+    PRIMITIVE(PRIM_ARC);
+    if (r_inner > r_outer) {
+        std::swap(r_inner, r_outer);
+    }
+    const i32 range = end - start;
+    const bool full = range >= 360 || range <= -360;
+    const i32 sweep = ((range % 360) + 360) % 360;
+    if (!full && sweep == 0) {
+        return OK;
+    }
+    const Arc arc = {sin_q15(start), -cos_q15(start), sin_q15(start + sweep), -cos_q15(start + sweep),
+                     r_outer, r_inner, static_cast<u16>(full ? 0 : sweep), color.to_16bit()};
+    Error err;
+#ifdef CONFIG_GC9A01_BAND_MODE
+    const i32 x = std::max<i32>(x0 - r_outer, 0);
+    const i32 y = std::max<i32>(y0 - r_outer, 0);
+    const i32 x1 = std::min<i32>(x0 + r_outer + 1, GC9A01_WIDTH);
+    const i32 y1 = std::min<i32>(y0 + r_outer + 1, GC9A01_HEIGHT);
+    if (x >= x1 || y >= y1) {
+        return OK;
+    }
+    // Make room first, rendering the list early frees all arcs
+    if (arc_count_ == GC9A01_DISPLAY_LIST_ARCS || list_count_ == CONFIG_GC9A01_DISPLAY_LIST_SIZE) {
+        err = render_early();
+        ERROR_CHECK(err);
+    }
+    arcs_[arc_count_] = arc;
+    err = record({nullptr, x0, y0, r_outer, r_inner, arc_count_, OP_ARC, false},
+                 {static_cast<u16>(x), static_cast<u16>(y), static_cast<u16>(x1), static_cast<u16>(y1)});
+    arc_count_++;
+    return finish(err);
+#else
+    const i32 first = std::max<i32>(-r_outer, -y0);
+    const i32 last = std::min<i32>(r_outer, GC9A01_HEIGHT - 1 - y0);
+    i32 runs[4][2];
+    for (i32 dy = first; dy <= last; dy++) {
+        const u8 count = arc_runs(arc, dy, runs);
+        for (u8 i = 0; i < count; i++) {
+            err = clip_fill(x0 + runs[i][0], y0 + dy, runs[i][1] - runs[i][0] + 1, 1, arc.color16);
+            ERROR_CHECK(err);
+        }
+    }
+    return finish(OK);
+#endif
+}
+
+/**
+ * @brief Runs of pixels of row `dy` of a ring segment
+ *
+ * The row is cut into the parts left and right of the hole. The start and
+ * end rays bound the columns inside the angle range from one side each, so
+ * the edges of each run are solved for instead of testing every pixel.
+ *
+ * @param runs first and last column (inclusive) of each run, relative to the center
+ * @return Number of runs, 0 if the row misses the segment
+ */
+u8 GC9A01::arc_runs(const Arc& arc, const i32 dy, i32 runs[4][2]) const {
+    const i32 outer = half_width(arc.r_outer, dy);
+    if (outer < 0) {
+        return 0;
+    }
+    const i32 hole = arc.r_inner > 0 ? half_width(arc.r_inner - 1, dy) : -1;
+    // At most two segments per row, left and right of the hole
+    i32 segments[2][2];
+    u8 segment_count = 0;
+    if (hole < 0) {
+        segments[segment_count][0] = -outer;
+        segments[segment_count++][1] = outer;
+    } else if (hole < outer) {
+        segments[segment_count][0] = -outer;
+        segments[segment_count++][1] = -hole - 1;
+        segments[segment_count][0] = hole + 1;
+        segments[segment_count++][1] = outer;
+    }
+
+    // Columns inside the angle range, an intersection of the two sides up to
+    // 180 degrees, else their union
+    i32 ranges[2][2];
+    u8 range_count = 1;
+    half_plane(-static_cast<i64>(arc.sy), -static_cast<i64>(arc.sx) * dy, ranges[0][0], ranges[0][1]);
+    half_plane(arc.ey, static_cast<i64>(arc.ex) * dy, ranges[1][0], ranges[1][1]);
+    if (arc.sweep == 0) {
+        ranges[0][0] = -outer;
+        ranges[0][1] = outer;
+    } else if (arc.sweep <= 180) {
+        ranges[0][0] = std::max(ranges[0][0], ranges[1][0]);
+        ranges[0][1] = std::min(ranges[0][1], ranges[1][1]);
+    } else {
+        if (ranges[1][0] < ranges[0][0]) {
+            std::swap(ranges[0], ranges[1]);
+        }
+        if (ranges[1][0] <= ranges[0][1] + 1) {
+            ranges[0][1] = std::max(ranges[0][1], ranges[1][1]);
+        } else {
+            range_count = 2;
+        }
+    }
+
+    u8 count = 0;
+    for (u8 i = 0; i < segment_count; i++) {
+        for (u8 j = 0; j < range_count; j++) {
+            const i32 from = std::max(segments[i][0], ranges[j][0]);
+            const i32 to = std::min(segments[i][1], ranges[j][1]);
+            if (from <= to) {
+                runs[count][0] = from;
+                runs[count++][1] = to;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Send the spans of a rounded rectangle, outline or filled
+ *
+ * The straight middle part is a single window when filled,
+ * or two vertical runs for the outline.
+ */
+GC9A01::Error GC9A01::round_rect_spans(const i16 x, const i16 y, const u16 w, const u16 h, u16 r, const bool filled, const u16 color16) const {
+    r = std::min<u16>(r, std::min(w, h) / 2);
+    Error err;
+    if (r == 0) {
+        if (filled) {
+            return clip_fill(x, y, w, h, color16);
+        }
+        // Degenerate to a plain rectangle
+        const i32 right = x + w - 1;
+        const i32 bottom = y + h - 1;
+        err = clip_fill(x, y, w, 1, color16);
+        ERROR_CHECK(err);
+        err = clip_fill(x, bottom, w, 1, color16);
+        ERROR_CHECK(err);
+        err = clip_fill(x, y + 1, 1, h - 2, color16);
+        ERROR_CHECK(err);
+        return clip_fill(right, y + 1, 1, h - 2, color16);
+    }
+
+    // Corner centers
+    const i32 left = x + r;
+    const i32 right = x + w - 1 - r;
+    const i32 top = y + r;
+    const i32 bottom = y + h - 1 - r;
+    for (i32 dy = r; dy > 0; dy--) {
+        const i32 outer = half_width(r, dy);
+        const i32 from = filled ? 0 : std::min(half_width(r, dy + 1) + 1, outer);
+        for (const i32 row : {top - dy, bottom + dy}) {
+            if (from == 0) {
+                err = clip_fill(left - outer, row, right - left + 2 * outer + 1, 1, color16);
+                ERROR_CHECK(err);
+                continue;
+            }
+            err = clip_fill(left - outer, row, outer - from + 1, 1, color16);
+            ERROR_CHECK(err);
+            err = clip_fill(right + from, row, outer - from + 1, 1, color16);
+            ERROR_CHECK(err);
+        }
+    }
+    if (filled) {
+        return clip_fill(x, top, w, bottom - top + 1, color16);
+    }
+    err = clip_fill(x, top, 1, bottom - top + 1, color16);
+    ERROR_CHECK(err);
+    return clip_fill(x + w - 1, top, 1, bottom - top + 1, color16);
+}
+
+/**
+ * @brief Draw a rectangle with rounded corners of radius `r`
+ *
+ * @param x `x` coordinate
+ * @param y `y` coordinate
+ * @param w width of the rectangle
+ * @param h height of the rectangle
+ * @param r corner radius, limited to half of the shorter side
+ * @param color Color of the rectangle
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::draw_round_rect(const i16 x, const i16 y, const u16 w, const u16 h, const u16 r, const Color color) const {
+    PRIMITIVE(PRIM_ROUND_RECT);
+    if (w == 0 || h == 0) {
+        return OK;
+    }
+    return finish(round_rect_spans(x, y, w, h, r, false, color.to_16bit()));
+}
+
+/**
+ * @brief Draw a filled rectangle with rounded corners of radius `r`
+ *
+ * @param x `x` coordinate
+ * @param y `y` coordinate
+ * @param w width of the rectangle
+ * @param h height of the rectangle
+ * @param r corner radius, limited to half of the shorter side
+ * @param color Color of the rectangle
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::fill_round_rect(const i16 x, const i16 y, const u16 w, const u16 h, const u16 r, const Color color) const {
+    PRIMITIVE(PRIM_ROUND_RECT);
+    if (w == 0 || h == 0) {
+        return OK;
+    }
+    return finish(round_rect_spans(x, y, w, h, r, true, color.to_16bit()));
+}
+
+/**
+ * @brief Draw the outline of a triangle with a `color`
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::draw_triangle(const i16 x0, const i16 y0, const i16 x1, const i16 y1, const i16 x2, const i16 y2, const Color color) const {
+    PRIMITIVE(PRIM_TRIANGLE);
+    Error err;
+    err = draw_line(x0, y0, x1, y1, color);
+    ERROR_CHECK(err);
+    err = draw_line(x1, y1, x2, y2, color);
+    ERROR_CHECK(err);
+    return draw_line(x2, y2, x0, y0, color);
+}
+
+/**
+ * @brief Draw a filled triangle with a `color`
+ *
+ * Scanline fill, one run per row.
+ *
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::fill_triangle(i16 x0, i16 y0, i16 x1, i16 y1, i16 x2, i16 y2, const Color color) const {
+    PRIMITIVE(PRIM_TRIANGLE);
+    // Sort by y so that y0 <= y1 <= y2
+    if (y0 > y1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+    if (y1 > y2) {
+        std::swap(x1, x2);
+        std::swap(y1, y2);
+    }
+    if (y0 > y1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+
+    const u16 color16 = color.to_16bit();
+    if (y0 == y2) {
+        const i16 min_x = std::min({x0, x1, x2});
+        const i16 max_x = std::max({x0, x1, x2});
+        return finish(clip_fill(min_x, y0, max_x - min_x + 1, 1, color16));
+    }
+
+    const auto edge = [](const i32 ax, const i32 ay, const i32 bx, const i32 by, const i32 row) {
+        return ax + (bx - ax) * (row - ay) / (by - ay);
+    };
+    const i32 first = std::max<i32>(y0, 0);
+    const i32 last = std::min<i32>(y2, GC9A01_HEIGHT - 1);
+    Error err;
+    for (i32 row = first; row <= last; row++) {
+        // Long edge from 0 to 2 on one side, edges 0-1 and 1-2 on the other
+        const i32 a = edge(x0, y0, x2, y2, row);
+        i32 b;
+        if (row < y1) {
+            b = edge(x0, y0, x1, y1, row);
+        } else if (y1 != y2) {
+            b = edge(x1, y1, x2, y2, row);
+        } else {
+            b = x1;
+        }
+        err = clip_fill(std::min(a, b), row, std::abs(b - a) + 1, 1, color16);
+        ERROR_CHECK(err);
+    }
+    return finish(OK);
+}
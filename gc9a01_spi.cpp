@@ -0,0 +1,238 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_spi.cpp
+ * @brief GC9A01 transport over the ESP-IDF SPI master driver
+ */
+
+#include <cstring>
+
+#include "esp_attr.h"
+#include "esp_memory_utils.h"
+
+#include "gc9a01_spi.h"
+#include "gc9a01_private.h"
+
+using Error = GC9A01::Error;
+
+u32 GC9A01SpiTransport::bus_max_transfer_[SPI_HOST_MAX] = {};
+
+GC9A01SpiTransport::GC9A01SpiTransport(spi_host_device_t host, gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs,
+                                       gpio_num_t dc, gpio_num_t rst, gpio_num_t te, int clock_hz, u32 max_transfer) :
+    host_(host), mosi_(mosi), clk_(clk), cs_(cs), dc_(dc), rst_(rst), te_(te), clock_hz_(clock_hz),
+    max_transfer_(max_transfer)
+{
+    // Descriptors are set up once, `queue()` only touches what changes
+    std::memset(pool_, 0, sizeof(pool_));
+    for (auto& slot : pool_) {
+        slot.trans.user = &slot;
+        slot.owner = this;
+    }
+}
+
+GC9A01SpiTransport::~GC9A01SpiTransport() {
+    if (spi_ != nullptr) {
+        spi_bus_remove_device(spi_);
+    }
+    if (tear_ != nullptr) {
+        gpio_isr_handler_remove(te_);
+        vSemaphoreDelete(tear_);
+    }
+}
+
+void GC9A01SpiTransport::pre_transfer_callback(spi_transaction_t *t)
+{
+    const Transaction* trans = static_cast<const Transaction*>(t->user);
+    gpio_set_level(trans->owner->dc_, trans->dc);
+}
+
+void GC9A01SpiTransport::post_transfer_callback(spi_transaction_t *t)
+{
+    const Transaction* trans = static_cast<const Transaction*>(t->user);
+    trans->owner->completed(trans->sequence);
+}
+
+void IRAM_ATTR GC9A01SpiTransport::tear_isr(void* arg)
+{
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(static_cast<SemaphoreHandle_t>(arg), &woken);
+    if (woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+/**
+ * @brief Configure the D/C and reset pins and add the display to the SPI bus
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+Error GC9A01SpiTransport::begin() {
+    if (spi_ != nullptr) {
+        return GC9A01::OK;
+    }
+    LOG("SPI Host: %d", host_);
+    gpio_config_t io_conf = {
+        .pin_bit_mask = (1ULL << dc_),
+        .mode = GPIO_MODE_OUTPUT,
+        .pull_up_en = GPIO_PULLUP_ENABLE,
+    };
+    if (rst_ != GPIO_NUM_NC) {
+        io_conf.pin_bit_mask |= (1ULL << rst_);
+    }
+    if (gpio_config(&io_conf) != ESP_OK) {
+        return GC9A01::SPI_TRANSMIT_ERROR;
+    }
+
+    spi_bus_config_t buscfg = {
+        .mosi_io_num = mosi_,
+        .miso_io_num = GPIO_NUM_NC,
+        .sclk_io_num = clk_,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = static_cast<int>(max_transfer_)
+    };
+    spi_device_interface_config_t devcfg = {
+        .mode = 0,
+        .clock_speed_hz = clock_hz_,
+        .spics_io_num = cs_,
+        .flags = SPI_DEVICE_HALFDUPLEX,
+        .queue_size = GC9A01_QUEUE_SIZE,
+        .pre_cb = pre_transfer_callback,
+        .post_cb = post_transfer_callback,
+    };
+    // Another display (or the application) may have set up the bus already,
+    // its pins and transfer size are kept then
+    const esp_err_t ret = spi_bus_initialize(host_, &buscfg, SPI_DMA_CH_AUTO);
+    if (ret == ESP_OK) {
+        bus_max_transfer_[host_] = max_transfer_;
+    } else if (ret == ESP_ERR_INVALID_STATE) {
+        if (bus_max_transfer_[host_] != 0) {
+            max_transfer_ = bus_max_transfer_[host_];
+        }
+    } else {
+        return GC9A01::SPI_TRANSMIT_ERROR;
+    }
+    if (spi_bus_add_device(host_, &devcfg, &spi_) != ESP_OK) {
+        return GC9A01::SPI_TRANSMIT_ERROR;
+    }
+    return begin_tear();
+}
+
+/**
+ * @brief Configure the TE pin to give `tear_` on its rising edge
+ * @return `OK` on success or without a TE pin, else `SPI_TRANSMIT_ERROR`
+ */
+Error GC9A01SpiTransport::begin_tear() {
+    if (te_ == GPIO_NUM_NC) {
+        return GC9A01::OK;
+    }
+    const gpio_config_t te_conf = {
+        .pin_bit_mask = (1ULL << te_),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_ENABLE,
+        .intr_type = GPIO_INTR_POSEDGE,
+    };
+    if (gpio_config(&te_conf) != ESP_OK) {
+        return GC9A01::SPI_TRANSMIT_ERROR;
+    }
+    tear_ = xSemaphoreCreateBinary();
+    if (tear_ == nullptr) {
+        return GC9A01::OUT_OF_MEMORY;
+    }
+    // The service may already be installed by the application
+    const esp_err_t ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        return GC9A01::SPI_TRANSMIT_ERROR;
+    }
+    if (gpio_isr_handler_add(te_, tear_isr, tear_) != ESP_OK) {
+        return GC9A01::SPI_TRANSMIT_ERROR;
+    }
+    return GC9A01::OK;
+}
+
+/**
+ * @brief Queue `size` bytes with D/C at `dc`
+ *
+ * The caller makes sure a descriptor is free. Small payloads are copied into
+ * the descriptor, else `data` is sent from where it is.
+ *
+ * @return `OK` if the data was queued successfully, else `SPI_TRANSMIT_ERROR`
+ */
+Error GC9A01SpiTransport::queue(const u8* data, const u32 size, const u8 dc, const bool copy) {
+    Transaction& slot = pool_[queued_ % GC9A01_QUEUE_SIZE];
+    spi_transaction_t& t = slot.trans;
+    t.length = 8 * size;
+    if (copy) {
+        t.flags = SPI_TRANS_USE_TXDATA;
+        std::memcpy(t.tx_data, data, size);
+    } else {
+        t.flags = 0;
+        t.tx_buffer = data;
+    }
+    slot.dc = dc;
+    slot.sequence = queued_ + 1;
+    if (spi_device_queue_trans(spi_, &t, portMAX_DELAY) != ESP_OK) {
+        return GC9A01::SPI_TRANSMIT_ERROR;
+    }
+    queued_++;
+    return GC9A01::OK;
+}
+
+Error GC9A01SpiTransport::cmd(const u8 command) {
+    return queue(&command, 1, 0, true);
+}
+
+Error GC9A01SpiTransport::data(const u8* data, const u32 size) {
+    return queue(data, size, 1, true);
+}
+
+Error GC9A01SpiTransport::queue_data(const u8* data, const u32 size) {
+    return queue(data, size, 1, size <= GC9A01_INLINE_DATA);
+}
+
+Error GC9A01SpiTransport::collect(const TickType_t timeout) {
+    spi_transaction_t* t;
+    if (spi_device_get_trans_result(spi_, &t, timeout) != ESP_OK) {
+        return GC9A01::SPI_TRANSMIT_ERROR;
+    }
+    return GC9A01::OK;
+}
+
+void GC9A01SpiTransport::set_reset(const bool level) {
+    if (rst_ != GPIO_NUM_NC) {
+        gpio_set_level(rst_, level);
+    }
+}
+
+bool GC9A01SpiTransport::has_reset() const {
+    return rst_ != GPIO_NUM_NC;
+}
+
+bool GC9A01SpiTransport::can_send_from(const void* data) const {
+    return esp_ptr_dma_capable(data);
+}
+
+u32 GC9A01SpiTransport::max_transfer() const {
+    return max_transfer_;
+}
+
+bool GC9A01SpiTransport::has_tear() const {
+    return te_ != GPIO_NUM_NC;
+}
+
+/**
+ * @brief Wait for the next rising edge of TE
+ * @return `OK` on a pulse, `TIMEOUT` if none came in time, `INVALID_ARGUMENT` before `begin()`
+ */
+Error GC9A01SpiTransport::wait_tear(const TickType_t timeout) {
+    if (tear_ == nullptr) {
+        return GC9A01::INVALID_ARGUMENT;
+    }
+    // A pulse given before the call is stale
+    xSemaphoreTake(tear_, 0);
+    if (xSemaphoreTake(tear_, timeout) != pdTRUE) {
+        return GC9A01::TIMEOUT;
+    }
+    return GC9A01::OK;
+}
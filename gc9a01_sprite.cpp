@@ -0,0 +1,589 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_sprite.cpp
+ * @brief Sprites with a transparent color or an alpha channel, clipped to the screen,
+ *        drawn as they are or turned and scaled around a pivot
+ *
+ * In buffer mode sprites are blended into the framebuffer, in band mode into
+ * the band being rendered, on top of whatever was drawn before them. Direct
+ * mode cannot read the display back, sprites are blended against a constant
+ * background there, and only the rows and columns of pixels that are not
+ * fully transparent are sent. Rows with the same spans of such pixels share
+ * a write window.
+ */
+
+#include <cstring>
+#include <algorithm>
+
+#include "gc9a01.h"
+#include "gc9a01_private.h"
+
+// Weights (0 to 32) of the 4-bit alpha values
+static constexpr u8 alpha4_weights[16] = {0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32};
+
+/**
+ * @brief Blend RGB565 `fg` over `bg` with the weight `a` from 0 (`bg`) to 32 (`fg`)
+ *
+ * Green moves to the upper half of a 32-bit word, which leaves each channel
+ * enough room for the product, so one multiply blends all three channels.
+ */
+static inline u16 blend565(const u16 fg, const u16 bg, const u32 a) {
+    const u32 f = (fg | (static_cast<u32>(fg) << 16)) & 0x07E0F81F;
+    const u32 b = (bg | (static_cast<u32>(bg) << 16)) & 0x07E0F81F;
+    const u32 r = ((((f - b) * a) >> 5) + b) & 0x07E0F81F;
+    return static_cast<u16>(r | (r >> 16));
+}
+
+/**
+ * @brief Weight of the sprite pixel at `col`, `row`, 0 if it is transparent, 32 if it is opaque
+ */
+static inline u32 sprite_weight(const GC9A01Sprite& sprite, const u32 col, const u32 row) {
+    switch (sprite.mode) {
+    case GC9A01_SPRITE_KEY:
+        return sprite.pixels[row * sprite.width + col] == sprite.key ? 0 : 32;
+    case GC9A01_SPRITE_ALPHA8:
+        return (sprite.alpha[row * sprite.width + col] + 4) >> 3;
+    case GC9A01_SPRITE_ALPHA4: {
+        const u8 pair = sprite.alpha[row * ((sprite.width + 1) / 2) + col / 2];
+        return alpha4_weights[col & 1 ? pair & 0x0F : pair >> 4];
+    }
+    default:
+        return 32;
+    }
+}
+
+static inline u16 big_endian(const u16 color16) {
+    return static_cast<u16>((color16 >> 8) | (color16 << 8));
+}
+
+/**
+ * @brief Blend a block of a sprite onto big-endian RGB565 pixels
+ *
+ * @param dst First destination pixel, rows are `stride` pixels apart
+ * @param sx first column of the sprite
+ * @param sy first row of the sprite
+ * @param w width of the block
+ * @param h height of the block
+ * @param covered If set, the bits of the pixels drawn to are set, rows are `stride` bits apart
+ * @param bit Bit of `covered` for `dst`
+ */
+void GC9A01::blend_sprite(u16* dst, const u32 stride, const GC9A01Sprite& sprite,
+                          const u16 sx, const u16 sy, const u16 w, const u16 h, u32* covered, const u32 bit) const {
+    for (u32 row = 0; row < h; row++) {
+        const u16* src = sprite.pixels + (sy + row) * sprite.width + sx;
+        u16* out = dst + row * stride;
+        for (u32 col = 0; col < w; col++) {
+            const u32 a = sprite_weight(sprite, sx + col, sy + row);
+            if (a == 32) {
+                out[col] = big_endian(src[col]);
+            } else if (a > 0) {
+                out[col] = big_endian(blend565(src[col], big_endian(out[col]), a));
+            }
+            if (covered != nullptr && a > 0) {
+                set_bits(covered, bit + row * stride + col, 1);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Send the pixels of a sprite that are not fully transparent
+ *
+ * Each row is cut into spans of such pixels. Rows with the same spans (at
+ * most `GC9A01_SPRITE_SPANS`) are collected, then each span is sent as one
+ * block, so a soft-edged icon costs a few write windows instead of one per
+ * row. Rows with more spans are sent span by span. The blocks are blended
+ * in chunks into the two DMA buffers in turns, like `write_pixels_as()`.
+ *
+ * @param x `x` coordinate of the sprite
+ * @param y `y` coordinate of the sprite
+ * @param x0 first visible column, `x1` and `y1` are exclusive
+ * @param background RGB565 color the sprite is blended against
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+template <class Format>
+GC9A01::Error GC9A01::write_sprite_as(const GC9A01Sprite& sprite, const i16 x, const i16 y,
+                                      const u16 x0, const u16 y0, const u16 x1, const u16 y1, const u16 background) const {
+    const u32 capacity = Format::staged_capacity(burst_bytes());
+    // Both buffers get overwritten
+    dma_buf_filled_ = 0;
+    u8 current = 0;
+
+    // Columns `from` to `to` of the `h` rows starting at `top`, all of them not transparent
+    const auto send_block = [&](const u16 from, const u16 to, const u16 top, const u16 h) {
+        Error err = set_write_window(from, top, to - from, h);
+        ERROR_CHECK(err);
+        const u16 w = to - from;
+        const u32 total = static_cast<u32>(w) * h;
+        u32 row = top - y;
+        u32 col = 0;
+        for (u32 sent = 0; sent < total;) {
+            err = wait(dma_buf_fence_[current]);
+            ERROR_CHECK(err);
+            u16* buf = dma_buf_[current];
+            const u32 chunk = std::min(capacity, total - sent);
+            for (u32 i = 0; i < chunk; i++) {
+                const u32 sx = from - x + col;
+                const u16 fg = sprite.pixels[row * sprite.width + sx];
+                const u32 a = sprite_weight(sprite, sx, row);
+                buf[i] = big_endian(a == 32 ? fg : blend565(fg, background, a));
+                if (++col == w) {
+                    col = 0;
+                    row++;
+                }
+            }
+            Format::pack(reinterpret_cast<u8*>(buf), chunk);
+            err = data(reinterpret_cast<const u8*>(buf), Format::bytes(chunk));
+            ERROR_CHECK(err);
+            dma_buf_fence_[current] = fence();
+            sent += chunk;
+            current ^= 1;
+        }
+        return OK;
+    };
+
+    // Call `emit` for each span of pixels that are not transparent in the visible columns of `row`
+    const auto scan = [&](const u16 row, const auto& emit) {
+        u16 left = x0;
+        u16 right = x1;
+#ifdef CONFIG_GC9A01_ROUND_MASK
+        if (round_mask_) {
+            left = std::max(left, round_mask[row].x0);
+            right = std::min(right, round_mask[row].x1);
+        }
+#endif
+        u16 col = left;
+        while (col < right) {
+            while (col < right && sprite_weight(sprite, col - x, row - y) == 0) {
+                col++;
+            }
+            const u16 from = col;
+            while (col < right && sprite_weight(sprite, col - x, row - y) != 0) {
+                col++;
+            }
+            if (from < col) {
+                Error err = emit(from, col);
+                ERROR_CHECK(err);
+            }
+        }
+        return OK;
+    };
+
+    struct Span {
+        u16 from;
+        u16 to;
+    };
+    // Rows collected so far, they all have the spans in `group`
+    Span group[GC9A01_SPRITE_SPANS];
+    u8 group_count = 0;
+    u16 group_top = y0;
+    u16 group_h = 0;
+    const auto send_group = [&]() {
+        for (u8 i = 0; i < group_count && group_h > 0; i++) {
+            Error err = send_block(group[i].from, group[i].to, group_top, group_h);
+            ERROR_CHECK(err);
+        }
+        group_h = 0;
+        return OK;
+    };
+
+    Error err;
+    for (u16 row = y0; row < y1; row++) {
+        Span spans[GC9A01_SPRITE_SPANS];
+        u8 count = 0;
+        bool overflow = false;
+        scan(row, [&](const u16 from, const u16 to) {
+            if (count == GC9A01_SPRITE_SPANS) {
+                overflow = true;
+            } else {
+                spans[count++] = {from, to};
+            }
+            return OK;
+        });
+        bool same = !overflow && group_h > 0 && count == group_count;
+        for (u8 i = 0; same && i < count; i++) {
+            same = spans[i].from == group[i].from && spans[i].to == group[i].to;
+        }
+        if (same) {
+            group_h++;
+            continue;
+        }
+        err = send_group();
+        ERROR_CHECK(err);
+        if (overflow) {
+            err = scan(row, [&](const u16 from, const u16 to) {
+                return send_block(from, to, row, 1);
+            });
+            ERROR_CHECK(err);
+            continue;
+        }
+        std::copy_n(spans, count, group);
+        group_count = count;
+        group_top = row;
+        group_h = 1;
+    }
+    return send_group();
+}
+
+/**
+ * @brief Draw a sprite with its top left corner at `x`, `y`
+ *
+ * The sprite may be partly or fully off-screen. Transparent pixels leave
+ * what lies beneath, pixels with alpha are blended with it: the framebuffer
+ * in buffer mode, everything drawn before in band mode (`sprite.pixels` and
+ * `sprite.alpha` have to stay valid until `flush()`). In direct mode they
+ * are blended with `background` and fully transparent pixels are not sent.
+ *
+ * @param x `x` coordinate
+ * @param y `y` coordinate
+ * @param sprite Sprite to draw
+ * @param background Color pixels with alpha are blended with in direct mode
+ * @return `OK` on success, `INVALID_ARGUMENT` if `sprite` misses its pixels or alpha channel,
+ *         else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::draw_sprite(const i16 x, const i16 y, const GC9A01Sprite& sprite, const Color background) const {
+    PRIMITIVE(PRIM_SPRITE);
+    const bool alpha = sprite.mode == GC9A01_SPRITE_ALPHA8 || sprite.mode == GC9A01_SPRITE_ALPHA4;
+    if (sprite.pixels == nullptr || (alpha && sprite.alpha == nullptr) || sprite.mode > GC9A01_SPRITE_ALPHA4) {
+        return INVALID_ARGUMENT;
+    }
+    if (sprite.mode == GC9A01_SPRITE_OPAQUE) {
+        return finish(clip_blit(x, y, sprite.width, sprite.height, sprite.pixels, true));
+    }
+    const i32 x0 = std::max<i32>(x, 0);
+    const i32 y0 = std::max<i32>(y, 0);
+    const i32 x1 = std::min<i32>(x + sprite.width, GC9A01_WIDTH);
+    const i32 y1 = std::min<i32>(y + sprite.height, GC9A01_HEIGHT);
+    if (x0 >= x1 || y0 >= y1) {
+        return OK;
+    }
+
+    Error err;
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    (void) background;
+    err = wait(fb_fence_);
+    ERROR_CHECK(err);
+    blend_sprite(fb_ + y0 * GC9A01_WIDTH + x0, GC9A01_WIDTH, sprite, x0 - x, y0 - y, x1 - x0, y1 - y0);
+    mark_dirty(x0, y0, x1 - x0, y1 - y0);
+    err = OK;
+#elif defined(CONFIG_GC9A01_BAND_MODE)
+    (void) background;
+    if (sprite_count_ == GC9A01_DISPLAY_LIST_SPRITES || list_count_ == CONFIG_GC9A01_DISPLAY_LIST_SIZE) {
+        err = render_early();
+        ERROR_CHECK(err);
+    }
+    sprites_[sprite_count_] = sprite;
+    err = record({nullptr, x, y, sprite.width, sprite.height, sprite_count_, OP_SPRITE, false},
+                 {static_cast<u16>(x0), static_cast<u16>(y0), static_cast<u16>(x1), static_cast<u16>(y1)});
+    sprite_count_++;
+#else
+    const u16 background16 = background.to_16bit();
+    switch (colmod_) {
+    case COLOR_MODE_MCU_12BIT:
+        err = write_sprite_as<PixelFormat<COLOR_MODE_MCU_12BIT>>(sprite, x, y, x0, y0, x1, y1, background16);
+        break;
+    case COLOR_MODE_MCU_18BIT:
+        err = write_sprite_as<PixelFormat<COLOR_MODE_MCU_18BIT>>(sprite, x, y, x0, y0, x1, y1, background16);
+        break;
+    default:
+        err = write_sprite_as<PixelFormat<COLOR_MODE_MCU_16BIT>>(sprite, x, y, x0, y0, x1, y1, background16);
+        break;
+    }
+#endif
+    return finish(err);
+}
+
+/**
+ * @brief `a / b` rounded down, `b` has to be positive
+ */
+static inline i64 floor_div(const i64 a, const i64 b) {
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+/**
+ * @brief Narrow the columns `from` to `to` (exclusive) to those where `0 <= a + col * d < limit`
+ */
+static void clip_axis(const i64 a, const i64 d, const i64 limit, i32& from, i32& to) {
+    if (d == 0) {
+        if (a < 0 || a >= limit) {
+            to = from;
+        }
+        return;
+    }
+    const i64 first = d > 0 ? -floor_div(a, d) : -floor_div(limit - 1 - a, -d);
+    const i64 last = d > 0 ? floor_div(limit - 1 - a, d) : floor_div(a, -d);
+    from = static_cast<i32>(std::max<i64>(from, first));
+    to = static_cast<i32>(std::min<i64>(to, last + 1));
+}
+
+/**
+ * @brief Columns of `row` whose centers map into the sprite
+ *
+ * The bounds are solved from the same fixed-point values the pixels are
+ * stepped with, so stepping `u` and `v` by `du_dx` and `dv_dx` from `from` to
+ * `to` never leaves the sprite.
+ *
+ * @param from first column to look at, set to the first column inside
+ * @param to column to stop at (exclusive), set past the last column inside
+ * @param u set to the sprite position of `from` in Q16
+ * @param v set to the sprite position of `from` in Q16
+ * @return `false` if no column of the row maps into the sprite
+ */
+bool GC9A01::affine_span(const Affine& t, const GC9A01Sprite& sprite, const i32 row,
+                         i32& from, i32& to, u32& u, u32& v) const {
+    const i64 u_row = t.u0 + static_cast<i64>(row) * t.du_dy;
+    const i64 v_row = t.v0 + static_cast<i64>(row) * t.dv_dy;
+    clip_axis(u_row, t.du_dx, static_cast<i64>(sprite.width) << 16, from, to);
+    clip_axis(v_row, t.dv_dx, static_cast<i64>(sprite.height) << 16, from, to);
+    if (from >= to) {
+        return false;
+    }
+    u = static_cast<u32>(u_row + static_cast<i64>(from) * t.du_dx);
+    v = static_cast<u32>(v_row + static_cast<i64>(from) * t.dv_dx);
+    return true;
+}
+
+/**
+ * @brief Blend a rotated sprite onto big-endian RGB565 pixels
+ *
+ * @param dst Pixel `x0`, `y0` of the screen, rows are `stride` pixels apart
+ * @param x0 first column to draw, `x1` and `y1` are exclusive
+ * @param covered If set, the bits of the pixels drawn to are set, rows are `stride` bits apart
+ * @param bit Bit of `covered` for `dst`
+ */
+void GC9A01::blend_affine(u16* dst, const u32 stride, const Affine& t, const GC9A01Sprite& sprite,
+                          const u16 x0, const u16 y0, const u16 x1, const u16 y1, u32* covered, const u32 bit) const {
+    for (i32 row = y0; row < y1; row++) {
+        i32 from = x0;
+        i32 to = x1;
+        u32 u;
+        u32 v;
+        if (!affine_span(t, sprite, row, from, to, u, v)) {
+            continue;
+        }
+        u16* out = dst + (row - y0) * stride + (from - x0);
+        for (i32 col = from; col < to; col++, out++, u += t.du_dx, v += t.dv_dx) {
+            const u32 sx = u >> 16;
+            const u32 sy = v >> 16;
+            const u32 a = sprite_weight(sprite, sx, sy);
+            const u16 fg = sprite.pixels[sy * sprite.width + sx];
+            if (a == 32) {
+                *out = big_endian(fg);
+            } else if (a > 0) {
+                *out = big_endian(blend565(fg, big_endian(*out), a));
+            }
+            if (covered != nullptr && a > 0) {
+                set_bits(covered, bit + (row - y0) * stride + (col - x0), 1);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Send the pixels a rotated sprite covers and that are not transparent
+ *
+ * Each run of such pixels in a row is one write window. The runs are staged
+ * one after the other in a DMA buffer, each starting on a 32-bit boundary,
+ * and the buffers are used in turns once one is full.
+ *
+ * @param x0 first column to draw, `x1` and `y1` are exclusive
+ * @param background RGB565 color the sprite is blended against
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+template <class Format>
+GC9A01::Error GC9A01::write_affine_as(const Affine& t, const GC9A01Sprite& sprite,
+                                      const u16 x0, const u16 y0, const u16 x1, const u16 y1, const u16 background) const {
+    // Runs are staged across the whole buffer, each is cut to the bus limit
+    constexpr u32 buffer_bytes = GC9A01_DMA_BUFFER_PIXELS * 2;
+    const u32 capacity = Format::staged_capacity(burst_bytes());
+    // Bytes a run of `n` pixels takes in the buffer, before and after `pack()`
+    const auto staged_bytes = [](const u32 n) {
+        return (std::max<u32>(n * 2, Format::bytes(n)) + 3) & ~3u;
+    };
+    // Both buffers get overwritten
+    dma_buf_filled_ = 0;
+    u8 current = 0;
+    u32 used = 0;
+    Error err = wait(dma_buf_fence_[current]);
+    ERROR_CHECK(err);
+
+    // Send the `n` pixels staged at `used` as the columns from `col` of `row`
+    const auto send_run = [&](const u16 col, const u16 row, const u32 n) {
+        u8* run = reinterpret_cast<u8*>(dma_buf_[current]) + used;
+        Error err = set_write_window(col, row, n, 1);
+        ERROR_CHECK(err);
+        Format::pack(run, n);
+        err = data(run, Format::bytes(n));
+        ERROR_CHECK(err);
+        used += staged_bytes(n);
+        return OK;
+    };
+
+    for (i32 row = y0; row < y1; row++) {
+        i32 from = x0;
+        i32 to = x1;
+#ifdef CONFIG_GC9A01_ROUND_MASK
+        if (round_mask_) {
+            from = std::max<i32>(from, round_mask[row].x0);
+            to = std::min<i32>(to, round_mask[row].x1);
+        }
+#endif
+        u32 u;
+        u32 v;
+        if (from >= to || !affine_span(t, sprite, row, from, to, u, v)) {
+            continue;
+        }
+        u32 n = 0;
+        u16 start = 0;
+        for (i32 col = from; col < to; col++, u += t.du_dx, v += t.dv_dx) {
+            const u32 sx = u >> 16;
+            const u32 sy = v >> 16;
+            const u32 a = sprite_weight(sprite, sx, sy);
+            if (a == 0) {
+                if (n > 0) {
+                    err = send_run(start, row, n);
+                    ERROR_CHECK(err);
+                    n = 0;
+                }
+                continue;
+            }
+            if (n == 0) {
+                // Make room for the rest of the row
+                if (used + staged_bytes(std::min<u32>(to - col, capacity)) > buffer_bytes) {
+                    dma_buf_fence_[current] = fence();
+                    current ^= 1;
+                    used = 0;
+                    err = wait(dma_buf_fence_[current]);
+                    ERROR_CHECK(err);
+                }
+                start = col;
+            }
+            const u16 fg = sprite.pixels[sy * sprite.width + sx];
+            u16* staged = reinterpret_cast<u16*>(reinterpret_cast<u8*>(dma_buf_[current]) + used);
+            staged[n++] = big_endian(a == 32 ? fg : blend565(fg, background, a));
+            if (n == capacity) {
+                err = send_run(start, row, n);
+                ERROR_CHECK(err);
+                n = 0;
+            }
+        }
+        if (n > 0) {
+            err = send_run(start, row, n);
+            ERROR_CHECK(err);
+        }
+    }
+    if (used > 0) {
+        dma_buf_fence_[current] = fence();
+    }
+    return OK;
+}
+
+/**
+ * @brief Draw a sprite turned and scaled around a pivot
+ *
+ * The center of the pivot pixel lands on the center of screen pixel `x`,
+ * `y`, the sprite is turned clockwise around it and scaled. Every screen
+ * pixel the sprite covers is mapped back into the sprite with fixed-point
+ * steps and takes the nearest pixel, rows are solved for the exact columns
+ * the sprite covers, so no pixel outside of it is sampled or sent. Turning
+ * a hand every frame needs no bitmaps per angle:
+ *
+ *     display.draw_rotated(120, 120, hand, 3, 100, seconds * 60 + millis * 60 / 1000);
+ *
+ * Transparent pixels and alpha behave like in `draw_sprite()`.
+ *
+ * @param x `x` coordinate of the pivot on screen
+ * @param y `y` coordinate of the pivot on screen
+ * @param sprite Sprite to draw
+ * @param pivot_x `x` coordinate of the pivot in the sprite
+ * @param pivot_y `y` coordinate of the pivot in the sprite
+ * @param angle Clockwise angle in tenths of a degree
+ * @param scale Scale in 1/256, 256 keeps the size, 0 draws nothing
+ * @param background Color pixels with alpha are blended with in direct mode
+ * @return `OK` on success, `INVALID_ARGUMENT` if `sprite` misses its pixels or alpha channel,
+ *         else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::draw_rotated(const i16 x, const i16 y, const GC9A01Sprite& sprite, const i16 pivot_x, const i16 pivot_y,
+                                   const i16 angle, const u16 scale, const Color background) const {
+    PRIMITIVE(PRIM_ROTATED);
+    const bool alpha = sprite.mode == GC9A01_SPRITE_ALPHA8 || sprite.mode == GC9A01_SPRITE_ALPHA4;
+    if (sprite.pixels == nullptr || (alpha && sprite.alpha == nullptr) || sprite.mode > GC9A01_SPRITE_ALPHA4) {
+        return INVALID_ARGUMENT;
+    }
+    if (scale == 0 || sprite.width == 0 || sprite.height == 0) {
+        return OK;
+    }
+    const i32 c = cos_q15_fine(angle);
+    const i32 s = sin_q15_fine(angle);
+
+    // Screen area of the corners, in Q24 relative to the center of `x`, `y`.
+    // Corners in half pixels relative to the center of the pivot.
+    i64 left = INT64_MAX;
+    i64 right = INT64_MIN;
+    i64 top = INT64_MAX;
+    i64 bottom = INT64_MIN;
+    for (const i32 cu : {-2 * pivot_x - 1, 2 * (sprite.width - pivot_x) - 1}) {
+        for (const i32 cv : {-2 * pivot_y - 1, 2 * (sprite.height - pivot_y) - 1}) {
+            const i64 dx = static_cast<i64>(scale) * (static_cast<i64>(c) * cu - static_cast<i64>(s) * cv);
+            const i64 dy = static_cast<i64>(scale) * (static_cast<i64>(s) * cu + static_cast<i64>(c) * cv);
+            left = std::min(left, dx);
+            right = std::max(right, dx);
+            top = std::min(top, dy);
+            bottom = std::max(bottom, dy);
+        }
+    }
+    // One pixel of margin, the spans are exact
+    const i32 x0 = static_cast<i32>(std::max<i64>(x + (left >> 24) - 1, 0));
+    const i32 y0 = static_cast<i32>(std::max<i64>(y + (top >> 24) - 1, 0));
+    const i32 x1 = static_cast<i32>(std::min<i64>(x + (right >> 24) + 2, GC9A01_WIDTH));
+    const i32 y1 = static_cast<i32>(std::min<i64>(y + (bottom >> 24) + 2, GC9A01_HEIGHT));
+    if (x0 >= x1 || y0 >= y1) {
+        return OK;
+    }
+
+    Affine t;
+    t.du_dx = c * 512 / scale;
+    t.dv_dx = -s * 512 / scale;
+    t.du_dy = s * 512 / scale;
+    t.dv_dy = c * 512 / scale;
+    t.u0 = (static_cast<i64>(pivot_x) << 16) + 0x8000 - static_cast<i64>(x) * t.du_dx - static_cast<i64>(y) * t.du_dy;
+    t.v0 = (static_cast<i64>(pivot_y) << 16) + 0x8000 - static_cast<i64>(x) * t.dv_dx - static_cast<i64>(y) * t.dv_dy;
+
+    Error err;
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    (void) background;
+    err = wait(fb_fence_);
+    ERROR_CHECK(err);
+    blend_affine(fb_ + y0 * GC9A01_WIDTH + x0, GC9A01_WIDTH, t, sprite, x0, y0, x1, y1);
+    mark_dirty(x0, y0, x1 - x0, y1 - y0);
+    err = OK;
+#elif defined(CONFIG_GC9A01_BAND_MODE)
+    (void) background;
+    if (sprite_count_ == GC9A01_DISPLAY_LIST_SPRITES || list_count_ == CONFIG_GC9A01_DISPLAY_LIST_SIZE) {
+        err = render_early();
+        ERROR_CHECK(err);
+    }
+    sprites_[sprite_count_] = sprite;
+    affines_[sprite_count_] = t;
+    err = record({nullptr, static_cast<i16>(x0), static_cast<i16>(y0), static_cast<u16>(x1 - x0), static_cast<u16>(y1 - y0),
+                  sprite_count_, OP_ROTATED, false},
+                 {static_cast<u16>(x0), static_cast<u16>(y0), static_cast<u16>(x1), static_cast<u16>(y1)});
+    sprite_count_++;
+#else
+    const u16 background16 = background.to_16bit();
+    switch (colmod_) {
+    case COLOR_MODE_MCU_12BIT:
+        err = write_affine_as<PixelFormat<COLOR_MODE_MCU_12BIT>>(t, sprite, x0, y0, x1, y1, background16);
+        break;
+    case COLOR_MODE_MCU_18BIT:
+        err = write_affine_as<PixelFormat<COLOR_MODE_MCU_18BIT>>(t, sprite, x0, y0, x1, y1, background16);
+        break;
+    default:
+        err = write_affine_as<PixelFormat<COLOR_MODE_MCU_16BIT>>(t, sprite, x0, y0, x1, y1, background16);
+        break;
+    }
+#endif
+    return finish(err);
+}
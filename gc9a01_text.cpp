@@ -0,0 +1,357 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_text.cpp
+ * @brief Text rendering with run-length encoded fonts and a cache of rendered lines
+ *
+ * A line of text is rendered into the text cache as one block of pixels: the
+ * background first, then the runs of each glyph, where alpha values pick
+ * from 16 colors blended between background and foreground. The block goes
+ * out like a bitmap, one write window and one burst per line, straight from
+ * the cache if it lies in DMA capable memory.
+ *
+ * Lines stay in the cache, keyed by text, font and colors, so a label drawn
+ * every frame is only rendered once. The cache is split into slots, a line
+ * takes as many consecutive slots as it needs and the least recently used
+ * lines make room for new ones.
+ *
+ * Cached lines are big-endian RGB565 whatever the COLMOD. In 16-bit mode
+ * that is the wire format, 12 and 18-bit mode convert a line each time it
+ * is sent, like any other bitmap.
+ */
+
+#include <cstring>
+#include <algorithm>
+
+#include "gc9a01.h"
+#include "gc9a01_private.h"
+
+static_assert(GC9A01_TEXT_CACHE_SLOTS * GC9A01_TEXT_SLOT_PIXELS >= GC9A01_WIDTH, "CONFIG_GC9A01_TEXT_CACHE_SIZE is too small");
+static_assert(GC9A01_TEXT_CACHE_SLOTS <= 255, "Slots are counted in 8 bits");
+
+/**
+ * @brief Glyph for the character `c`, `?` for characters the font does not cover
+ * @return `nullptr` if neither is covered
+ */
+static const GC9A01Glyph* find_glyph(const GC9A01Font& font, const char c) {
+    u8 code = static_cast<u8>(c);
+    if (code < font.first || code > font.last) {
+        code = '?';
+        if (code < font.first || code > font.last) {
+            return nullptr;
+        }
+    }
+    return &font.glyphs[code - font.first];
+}
+
+/**
+ * @brief Columns a line covers, relative to the pen position it starts at
+ *
+ * Glyphs may reach out of their advance, so the box can start left of the
+ * pen and end right of the last advance.
+ */
+static void measure_line(const char* text, const u16 length, const GC9A01Font& font, i32& left, i32& right) {
+    i32 pen = 0;
+    left = 0;
+    right = 0;
+    for (u16 i = 0; i < length; i++) {
+        const GC9A01Glyph* glyph = find_glyph(font, text[i]);
+        if (glyph == nullptr) {
+            continue;
+        }
+        if (glyph->width > 0) {
+            left = std::min<i32>(left, pen + glyph->x_offset);
+            right = std::max<i32>(right, pen + glyph->x_offset + glyph->width);
+        }
+        pen += glyph->advance;
+    }
+    right = std::max(right, pen);
+}
+
+/**
+ * @brief Render the part of a line inside an area of the screen
+ *
+ * @param buf Destination, `w * h` big-endian RGB565 pixels
+ * @param x `x` coordinate of the pen at the start of the line
+ * @param y `y` coordinate of the top of the line
+ * @param area_x `x` coordinate of the area
+ * @param area_y `y` coordinate of the area
+ * @param palette Big-endian RGB565 color of each alpha value
+ */
+static void render_line(u16* buf, const i32 x, const i32 y, const i32 area_x, const i32 area_y, const u16 w, const u16 h,
+                        const char* text, const u16 length, const GC9A01Font& font, const u16 palette[16]) {
+    std::fill_n(buf, static_cast<u32>(w) * h, palette[0]);
+    i32 pen = x;
+    for (u16 i = 0; i < length; i++) {
+        const GC9A01Glyph* glyph = find_glyph(font, text[i]);
+        if (glyph == nullptr) {
+            continue;
+        }
+        const i32 gx = pen + glyph->x_offset;
+        const i32 gy = y + glyph->y_offset;
+        pen += glyph->advance;
+        if (glyph->width == 0 || gx >= area_x + w || gx + glyph->width <= area_x
+            || gy >= area_y + h || gy + glyph->height <= area_y) {
+            continue;
+        }
+        // Columns of the glyph inside the area
+        const i32 col0 = std::max<i32>(area_x - gx, 0);
+        const i32 col1 = std::min<i32>(area_x + w - gx, glyph->width);
+        const u8* run = font.runs + glyph->offset;
+        i32 row = 0;
+        i32 col = 0;
+        while (row < glyph->height) {
+            const u8 alpha = *run >> 4;
+            u32 n = (*run & 0x0F) + 1;
+            run++;
+            // A run may continue on the next rows
+            while (n > 0) {
+                const u32 span = std::min<u32>(n, glyph->width - col);
+                const i32 sy = gy + row - area_y;
+                if (alpha != 0 && sy >= 0 && sy < h) {
+                    const i32 from = std::max<i32>(col, col0);
+                    const i32 to = std::min<i32>(col + span, col1);
+                    if (from < to) {
+                        std::fill_n(buf + sy * w + (gx + from - area_x), to - from, palette[alpha]);
+                    }
+                }
+                n -= span;
+                col += span;
+                if (col == glyph->width) {
+                    col = 0;
+                    row++;
+                }
+            }
+            if (gy + row >= area_y + h) {
+                // Below the area, the remaining runs do not matter
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Find room for a line in the text cache
+ *
+ * Picks the `count` consecutive slots whose lines were used least recently
+ * and drops those lines. Pixels still on the wire are waited for. In band
+ * mode lines the display list still references are kept, if nothing else is
+ * left the list is rendered early.
+ *
+ * @param first Set to the first slot
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::alloc_text_slots(const u8 count, u8& first) const {
+    Error err;
+    for (;;) {
+        i32 best = -1;
+        u32 best_used = UINT32_MAX;
+        for (u32 s = 0; s + count <= GC9A01_TEXT_CACHE_SLOTS; s++) {
+            // Most recent use of the lines overlapping the slots, 0 if they are free
+            u32 used = 0;
+            bool pinned = false;
+            for (u32 i = 0; i < GC9A01_TEXT_CACHE_SLOTS; i++) {
+                const TextLine& line = text_lines_[i];
+                if (line.slots == 0 || i >= s + count || i + line.slots <= s) {
+                    continue;
+                }
+#ifdef CONFIG_GC9A01_BAND_MODE
+                pinned |= list_count_ > 0 && line.generation == list_generation_;
+#endif
+                used = std::max(used, line.used);
+            }
+            if (!pinned && (best < 0 || used < best_used)) {
+                best = s;
+                best_used = used;
+            }
+        }
+        if (best >= 0) {
+            first = best;
+            break;
+        }
+#ifdef CONFIG_GC9A01_BAND_MODE
+        err = render_early();
+        ERROR_CHECK(err);
+#endif
+    }
+
+    for (u32 i = 0; i < GC9A01_TEXT_CACHE_SLOTS; i++) {
+        TextLine& line = text_lines_[i];
+        if (line.slots == 0 || i >= first + count || i + line.slots <= first) {
+            continue;
+        }
+        err = wait(line.fence);
+        ERROR_CHECK(err);
+        line.slots = 0;
+    }
+    return OK;
+}
+
+/**
+ * @brief Draw one line of text, see `draw_text()`
+ * @return `OK` on success, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::draw_text_line(const i16 x, const i16 y, const char* text, const u16 length, const GC9A01Font& font,
+                                     const Color color, const Color background) const {
+    i32 left;
+    i32 right;
+    measure_line(text, length, font, left, right);
+    const i32 box_x0 = x + left;
+    const i32 box_x1 = x + right;
+    const i32 box_y1 = y + font.line_height;
+    const i32 x0 = std::max<i32>(box_x0, 0);
+    const i32 y0 = std::max<i32>(y, 0);
+    const i32 x1 = std::min<i32>(box_x1, GC9A01_WIDTH);
+    const i32 y1 = std::min<i32>(box_y1, GC9A01_HEIGHT);
+    if (x0 >= x1 || y0 >= y1) {
+        return OK;
+    }
+    const u16 w = x1 - x0;
+    const u16 h = y1 - y0;
+    const u16 color16 = color.to_16bit();
+    const u16 background16 = background.to_16bit();
+    // Only lines fully on screen are kept, the key does not cover clipping
+    const bool cacheable = length <= GC9A01_TEXT_CACHE_CHARS
+        && x0 == box_x0 && x1 == box_x1 && y0 == y && y1 == box_y1;
+
+    text_clock_++;
+    Error err;
+    if (cacheable) {
+        for (u32 i = 0; i < GC9A01_TEXT_CACHE_SLOTS; i++) {
+            TextLine& line = text_lines_[i];
+            if (line.slots == 0 || !line.cached || line.font != &font || line.length != length
+                || line.color != color16 || line.background != background16
+                || std::memcmp(line.text, text, length) != 0) {
+                continue;
+            }
+            line.used = text_clock_;
+            err = blit_area(x0, y0, w, h, text_cache_ + i * GC9A01_TEXT_SLOT_PIXELS, w, false);
+            ERROR_CHECK(err);
+            line.fence = fence();
+#ifdef CONFIG_GC9A01_BAND_MODE
+            line.generation = list_generation_;
+#endif
+            return OK;
+        }
+    }
+
+    // Alpha 0 is the background, 15 the foreground
+    u16 palette[16];
+    for (u32 a = 0; a < 16; a++) {
+        const auto mix = [a](const u8 bg, const u8 fg) {
+            return static_cast<u8>((bg * (15 - a) + fg * a + 7) / 15);
+        };
+        const u16 c = Color(mix(background.r, color.r), mix(background.g, color.g), mix(background.b, color.b)).to_16bit();
+        palette[a] = static_cast<u16>((c >> 8) | (c << 8));
+    }
+
+    // A line larger than the whole cache is rendered in strips of rows
+    constexpr u32 capacity = GC9A01_TEXT_CACHE_SLOTS * GC9A01_TEXT_SLOT_PIXELS;
+    const u16 rows = std::min<u32>(h, capacity / w);
+    for (u16 row = 0; row < h; row += rows) {
+        const u16 strip = std::min<u16>(rows, h - row);
+        const u32 pixels = static_cast<u32>(w) * strip;
+        const u8 slots = (pixels + GC9A01_TEXT_SLOT_PIXELS - 1) / GC9A01_TEXT_SLOT_PIXELS;
+        u8 first;
+        err = alloc_text_slots(slots, first);
+        ERROR_CHECK(err);
+        u16* buf = text_cache_ + first * GC9A01_TEXT_SLOT_PIXELS;
+        render_line(buf, x, y, x0, y0 + row, w, strip, text, length, font, palette);
+        err = blit_area(x0, y0 + row, w, strip, buf, w, false);
+        ERROR_CHECK(err);
+
+        TextLine& line = text_lines_[first];
+        line.font = &font;
+        line.color = color16;
+        line.background = background16;
+        line.length = length;
+        line.slots = slots;
+        line.cached = cacheable && strip == h;
+        if (line.cached) {
+            std::memcpy(line.text, text, length);
+        }
+        // Scratch areas go first
+        line.used = line.cached ? text_clock_ : 0;
+        line.fence = fence();
+#ifdef CONFIG_GC9A01_BAND_MODE
+        line.generation = list_generation_;
+#endif
+    }
+    return OK;
+}
+
+/**
+ * @brief Draw `text` with its top left corner at `x`, `y`
+ *
+ * Each line is rendered on the background color, anti-aliased glyphs are
+ * blended against it. The boxes of the lines are `font.line_height` high
+ * and as wide as their glyphs, lines are sent as one block each. Lines of
+ * up to `GC9A01_TEXT_CACHE_CHARS` characters that are fully on screen stay
+ * in the text cache, drawing them again with the same font and colors
+ * skips rendering. Characters the font does not cover are drawn as `?`.
+ *
+ * @param x `x` coordinate of the pen at the start of each line
+ * @param y `y` coordinate of the top of the first line
+ * @param text Zero-terminated text, `\n` starts a new line
+ * @param font Font, has to stay valid as long as the display is used
+ * @param color Color of the text
+ * @param background Color the text is blended against
+ * @return `OK` on success, `INVALID_ARGUMENT` if `text` is `nullptr`,
+ *         `OUT_OF_MEMORY` if the text cache could not be allocated, else `SPI_TRANSMIT_ERROR`
+ */
+GC9A01::Error GC9A01::draw_text(const i16 x, const i16 y, const char* text, const GC9A01Font& font,
+                                const Color color, const Color background) const {
+    PRIMITIVE(PRIM_TEXT);
+    if (text == nullptr) {
+        return INVALID_ARGUMENT;
+    }
+    if (text_cache_ == nullptr) {
+        // Prefer DMA capable memory so cached lines are sent without copying
+        constexpr u32 size = GC9A01_TEXT_CACHE_SLOTS * GC9A01_TEXT_SLOT_PIXELS * sizeof(u16);
+        text_cache_ = static_cast<u16*>(heap_caps_malloc(size, MALLOC_CAP_DMA));
+        if (text_cache_ == nullptr) {
+            text_cache_ = static_cast<u16*>(heap_caps_malloc(size, MALLOC_CAP_8BIT));
+        }
+        if (text_cache_ == nullptr) {
+            return OUT_OF_MEMORY;
+        }
+    }
+
+    i32 line_y = y;
+    while (line_y < GC9A01_HEIGHT) {
+        const char* end = std::strchr(text, '\n');
+        const u16 length = end != nullptr ? end - text : std::strlen(text);
+        Error err = draw_text_line(x, static_cast<i16>(line_y), text, length, font, color, background);
+        ERROR_CHECK(err);
+        if (end == nullptr) {
+            break;
+        }
+        text = end + 1;
+        line_y += font.line_height;
+    }
+    return finish(OK);
+}
+
+/**
+ * @brief Width of `text` drawn with `font`, e.g. to center or right-align it
+ * @return Width of the widest line in pixels
+ */
+u16 GC9A01::text_width(const char* text, const GC9A01Font& font) const {
+    if (text == nullptr) {
+        return 0;
+    }
+    u16 width = 0;
+    for (;;) {
+        const char* end = std::strchr(text, '\n');
+        const u16 length = end != nullptr ? end - text : std::strlen(text);
+        i32 left;
+        i32 right;
+        measure_line(text, length, font, left, right);
+        width = std::max<u16>(width, right - left);
+        if (end == nullptr) {
+            return width;
+        }
+        text = end + 1;
+    }
+}
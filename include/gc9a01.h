@@ -1,16 +1,87 @@
+#pragma once
+
 #include <cstdint>
+#ifdef CONFIG_GC9A01_TRACE
+#include <atomic>
+#endif
+
+#include "gc9a01_port.h"
+#include "gc9a01_font.h"
+#include "gc9a01_image.h"
+#include "gc9a01_sprite.h"
 
+#ifdef ESP_PLATFORM
 #include "driver/spi_master.h"
 #include "esp_system.h"
+#endif
 
 #define COLOR_MODE_MCU_12BIT 0x03
 #define COLOR_MODE_MCU_16BIT 0x05
 #define COLOR_MODE_MCU_18BIT 0x06
 
+#ifndef CONFIG_GC9A01_COLOR_MODE
+#define CONFIG_GC9A01_COLOR_MODE COLOR_MODE_MCU_16BIT
+#endif
+
 #define GC9A01_WIDTH        240
 #define GC9A01_HEIGHT       240
 #define GC9A01_PIXELS       57600
 
+#ifndef CONFIG_GC9A01_DMA_BUFFER_LINES
+#define CONFIG_GC9A01_DMA_BUFFER_LINES 16
+#endif
+// Size of the internal DMA buffer in pixels
+#define GC9A01_DMA_BUFFER_PIXELS (GC9A01_WIDTH * CONFIG_GC9A01_DMA_BUFFER_LINES)
+// Largest single SPI transfer in bytes
+#define GC9A01_MAX_TRANSFER_SZ  (GC9A01_WIDTH * GC9A01_HEIGHT * 2)
+// Smallest transfer limit of a bus the driver works with, a row of 18-bit pixels
+#define GC9A01_MIN_TRANSFER_SZ  (GC9A01_WIDTH * 3)
+// Number of dirty rectangles tracked in buffer mode before they get merged
+#define GC9A01_MAX_DIRTY_RECTS  8
+// Number of SPI transactions that can be in flight at once
+#define GC9A01_QUEUE_SIZE       7
+// Parameter bytes a transport copies instead of referencing
+#define GC9A01_INLINE_DATA      4
+
+#if defined(CONFIG_GC9A01_BUFFER_MODE) && defined(CONFIG_GC9A01_BAND_MODE)
+#error "CONFIG_GC9A01_BUFFER_MODE and CONFIG_GC9A01_BAND_MODE are exclusive"
+#endif
+#if defined(CONFIG_GC9A01_DIFF_FLUSH) && !defined(CONFIG_GC9A01_BUFFER_MODE)
+#error "CONFIG_GC9A01_DIFF_FLUSH needs CONFIG_GC9A01_BUFFER_MODE"
+#endif
+#ifndef CONFIG_GC9A01_DISPLAY_LIST_SIZE
+#define CONFIG_GC9A01_DISPLAY_LIST_SIZE 128
+#endif
+#ifndef CONFIG_GC9A01_DISPLAY_LIST_FILLS
+#define CONFIG_GC9A01_DISPLAY_LIST_FILLS 1024
+#endif
+// Compressed images one display list can hold, each keeps a decoder
+#define GC9A01_DISPLAY_LIST_IMAGES 4
+// Sprites one display list can hold, plain or rotated, each keeps a copy of its `GC9A01Sprite`
+#define GC9A01_DISPLAY_LIST_SPRITES 8
+// Arcs one display list can hold, each keeps its angles
+#define GC9A01_DISPLAY_LIST_ARCS 16
+// Spans of opaque pixels per row that direct mode sends as one block with the rows around it
+#define GC9A01_SPRITE_SPANS 8
+
+#ifndef CONFIG_GC9A01_TEXT_CACHE_SIZE
+#define CONFIG_GC9A01_TEXT_CACHE_SIZE 16
+#endif
+// The text cache is split into this many slots, a line takes as many consecutive slots as it needs
+#define GC9A01_TEXT_CACHE_SLOTS 16
+// Pixels of a text cache slot, even so every slot starts 4-byte aligned
+#define GC9A01_TEXT_SLOT_PIXELS (CONFIG_GC9A01_TEXT_CACHE_SIZE * 1024 / 2 / GC9A01_TEXT_CACHE_SLOTS & ~1)
+// Longest line kept in the text cache, longer ones are rendered every time
+#define GC9A01_TEXT_CACHE_CHARS 24
+
+#ifdef CONFIG_GC9A01_TRACE
+#ifndef CONFIG_GC9A01_TRACE_DEPTH
+#define CONFIG_GC9A01_TRACE_DEPTH 64
+#endif
+static_assert((CONFIG_GC9A01_TRACE_DEPTH & (CONFIG_GC9A01_TRACE_DEPTH - 1)) == 0,
+              "CONFIG_GC9A01_TRACE_DEPTH has to be a power of two");
+#endif
+
 #define REDSHIFT    11
 #define GREENSHIFT  5
 
@@ -24,69 +95,163 @@ typedef int16_t i16;
 typedef int8_t i8;
 
 
-typedef struct gc9a01_cmd_t {
-    // Command
-    u8 cmd;
-    // Data
-    u8 data[16];
-    // Data size (bytes)
-    u8 datasize;
-} gc9a01_cmd_t;
-
 struct Color {
     u8 r;
     u8 g;
     u8 b;
 
-    u16 to_rgb444() const {
-        // Scale red value to 4 bits
-        u16 r = this->r * (15.0 / 255.0);
-        // Scale green value to 4 bits
-        u16 g = this->g * (15.0 / 255.0);
-        // Scale blue value to 4 bits
-        u16 b = this->b * (15.0 / 255.0);    
-        return (r << 8) | (g << 4) | b;
+    // Scale an 8-bit channel down to `bits` bits, rounded to the nearest value
+    static constexpr u32 scale(const u8 value, const u8 bits) {
+        return (value * ((1u << bits) - 1) + 127) / 255;
+    }
+
+    constexpr u16 to_rgb444() const {
+        return (scale(r, 4) << 8) | (scale(g, 4) << 4) | scale(b, 4);
     }
 
-    u16 to_12bit() const {
+    constexpr u16 to_12bit() const {
         return to_rgb444();
     }
 
-    u16 to_rgb565() const {
-        // Scale red value to 5 bits
-        u16 r = this->r * (31.0 / 255.0);
-        // Scale green value to 6 bits
-        u16 g = this->g * (63.0 / 255.0);
-        // Scale blue value to 5 bits
-        u16 b = this->b * (31.0 / 255.0);    
-        return (r << REDSHIFT) | (g << GREENSHIFT) | b;
+    constexpr u16 to_rgb565() const {
+        return (scale(r, 5) << REDSHIFT) | (scale(g, 6) << GREENSHIFT) | scale(b, 5);
     }
-    u16 to_16bit() const {
+    constexpr u16 to_16bit() const {
         return to_rgb565();
     }
 
-    u32 to_rgb666() const {
-        // Scale red value to 6 bits
-        u32 r = this->r * (63.0 / 255.0);
-        // Scale green value to 6 bits
-        u32 g = this->g * (63.0 / 255.0);
-        // Scale blue value to 6 bits
-        u32 b = this->b * (63.0 / 255.0);    
-        return (r << 12) | (g << 6) | b;
+    constexpr u32 to_rgb666() const {
+        return (scale(r, 6) << 12) | (scale(g, 6) << 6) | scale(b, 6);
     }
 
-    u32 to_18bit() const {
+    constexpr u32 to_18bit() const {
         return to_rgb666();
     }
 };
 
 // TODO: Maybe move back to `esp_err_t`
-// TODO: Add buffer mode 
+/**
+ * With `CONFIG_GC9A01_BUFFER_MODE` enabled all drawing calls only write to an
+ * in-RAM framebuffer and record the dirty area, `flush()` sends it to the display.
+ * Without it (direct mode) every call is sent to the display right away.
+ *
+ * All transfers are queued to the SPI driver. By default every call waits for
+ * its transfers before returning. With `set_async(true)` calls return as soon
+ * as everything is queued; `fence()`, `is_done()` and `wait()` tell when it was
+ * sent. Memory passed to an asynchronous call (e.g. a bitmap) has to stay
+ * untouched until then.
+ *
+ * `init_async()` initializes the panel in the background, nothing else may be
+ * called until `wait_ready()` returned.
+ *
+ * The bus is reached through a `Transport`. On ESP-IDF the pin constructors
+ * set up a `GC9A01SpiTransport`, any other transport (e.g. `GC9A01MemoryTransport`
+ * on a host) can be passed in instead.
+ */
 class GC9A01 {
 public:
+    class Transport;
+
+#ifdef ESP_PLATFORM
     GC9A01();
-    GC9A01(gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs, gpio_num_t dc, gpio_num_t rst);
-    ~GC9A01() = default;
+    GC9A01(gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs, gpio_num_t dc, gpio_num_t rst, gpio_num_t te = GPIO_NUM_NC);
+#endif
+    explicit GC9A01(Transport& transport);
+    ~GC9A01();
+
+    /**
+     * Called from the SPI interrupt every time a transaction finished,
+     * `fence` is the value `fence()` returned right after queueing it
+     */
+    typedef void (*CompletionCallback)(u32 fence, void* arg);
+
+    GC9A01(const GC9A01&) = delete;
+    GC9A01& operator=(const GC9A01&) = delete;
+
+    /**
+     * Drawing primitives, used to attribute statistics
+     */
+    enum Primitive : u8 {
+        PRIM_OTHER,
+        PRIM_SET_PIXEL,
+        PRIM_HLINE,
+        PRIM_VLINE,
+        PRIM_RECT,
+        PRIM_FILL_RECT,
+        PRIM_BITMAP,
+        PRIM_CIRCLE,
+        PRIM_FILL_CIRCLE,
+        PRIM_ARC,
+        PRIM_LINE,
+        PRIM_ROUND_RECT,
+        PRIM_TRIANGLE,
+        PRIM_FILL,
+        PRIM_FLUSH,
+        PRIM_TEXT,
+        PRIM_SPRITE,
+        PRIM_ROTATED,
+        PRIM_COUNT
+    };
+
+#ifdef CONFIG_GC9A01_STATS
+    /**
+     * Driver statistics, indexed by `Primitive`
+     */
+    struct Stats {
+        // Calls of the public drawing function
+        u32 calls[PRIM_COUNT];
+        // SPI transactions queued and bytes sent, commands included
+        u32 transactions[PRIM_COUNT];
+        u64 bytes[PRIM_COUNT];
+        // Time `cmd()` / `data()` waited for a free transaction slot, in microseconds
+        u64 blocked_us[PRIM_COUNT];
+        // Calls to `set_write_window()`
+        u32 window_setups[PRIM_COUNT];
+        // Transactions the window cache saved compared to a full CASET/RASET/RAMWR setup
+        u32 transactions_saved[PRIM_COUNT];
+        // Time spent in `wait()` / `sync()` for transfers to finish, in microseconds
+        u64 wait_us;
+    };
+#endif
+
+    /**
+     * Frame pacing statistics of `present()`
+     */
+    struct FrameStats {
+        // Frames sent by `present()`
+        u32 presented;
+        // Frame slots of the target rate that passed without a new frame
+        u32 missed;
+        // Calls that gave up waiting for a TE pulse and sent right away
+        u32 tear_timeouts;
+        // Time between the last two frames and the longest one, in microseconds
+        u32 last_interval_us;
+        u32 max_interval_us;
+    };
+
+#ifdef CONFIG_GC9A01_TRACE
+    /**
+     * Kind of a trace entry
+     */
+    enum TraceEvent : u8 {
+        TRACE_CMD,      // `value` is the command byte
+        TRACE_DATA,     // `value` is the number of bytes
+        TRACE_BLOCKED,  // `value` is the time waited for a free transaction slot in us
+        TRACE_WAIT      // `value` is the time waited in `wait()` / `sync()` in us
+    };
+
+    /**
+     * Transaction recorded by the trace ring buffer
+     */
+    struct TraceEntry {
+        // Lower 32 bits of `esp_timer_get_time()`
+        u32 time_us;
+        TraceEvent event;
+        Primitive primitive;
+        // Saturates at `0xFFFFFF`
+        u32 value;
+    };
+#endif
 
     /**
      * Error codes for the GC9A01 display driver
@@ -94,46 +259,464 @@ public:
     enum Error{
         OK,
         SPI_TRANSMIT_ERROR,
-        INVALID_ARGUMENT
+        INVALID_ARGUMENT,
+        OUT_OF_MEMORY,
+        TIMEOUT
+    };
+
+    /**
+     * Bus the display is attached to.
+     *
+     * Transfers are sent and finished in the order they were queued. The driver
+     * keeps at most `GC9A01_QUEUE_SIZE` of them in flight and collects each one
+     * with `collect()`. Transfers are numbered from 1 in queue order,
+     * `completed()` has to be called with that number as each one finished.
+     */
+    class Transport {
+    public:
+        virtual ~Transport() = default;
+
+        // Set up the bus, called by `init()`
+        virtual Error begin             () = 0;
+        // Queue a command byte, D/C low
+        virtual Error cmd               (const u8 command) = 0;
+        // Queue up to `GC9A01_INLINE_DATA` bytes with D/C high, they are copied
+        virtual Error data              (const u8* data, const u32 size) = 0;
+        // Queue `size` bytes with D/C high, they have to stay untouched until collected
+        virtual Error queue_data        (const u8* data, const u32 size) = 0;
+        // Wait up to `timeout` ticks for the oldest transfer in flight
+        virtual Error collect           (const TickType_t timeout) = 0;
+        // Drive the reset line, does nothing if `has_reset()` is `false`
+        virtual void  set_reset         (const bool level) = 0;
+        virtual bool  has_reset         () const = 0;
+        // Whether `queue_data()` can send from `data` directly (e.g. DMA capable memory)
+        virtual bool  can_send_from     (const void* data) const = 0;
+        // Largest transfer the bus takes in bytes, valid after `begin()`. Bursts
+        // from the DMA buffers and from caller memory are cut to it.
+        virtual u32   max_transfer      () const { return GC9A01_MAX_TRANSFER_SZ; }
+        // Whether the tearing effect (TE) output of the panel is connected
+        virtual bool  has_tear          () const { return false; }
+        // Wait up to `timeout` ticks for the next TE pulse, one that came before the call does not count
+        virtual Error wait_tear         (const TickType_t) { return INVALID_ARGUMENT; }
+
+        void set_completion_callback    (CompletionCallback callback, void* arg) {
+            callback_arg_ = arg;
+            callback_ = callback;
+        }
+
+    protected:
+        void completed                  (const u32 sequence) const {
+            if (callback_ != nullptr) {
+                callback_(sequence, callback_arg_);
+            }
+        }
+
+    private:
+        CompletionCallback callback_ = nullptr;
+        void* callback_arg_ = nullptr;
     };
 
 
     // NOTE: Maybe arguments needed: Add arguments for pin
 
     Error init              ();
+    Error init_async        (const UBaseType_t priority = 5);
+    Error wait_ready        (const TickType_t timeout = portMAX_DELAY);
     Error display_on        () const;
     Error display_off       () const;
     Error invert            (const bool invert) const;
     Error clear             () const;
     
-    Error set_pixel         (u16 x, u16 y, Color color) const;
-    Error draw_bitmap       (u16 x, u16 y, u16 w, u16 h, const u16* data) const;
-    Error draw_hline        (u16 x, u16 y, u16 w, Color color) const;
-    Error draw_vline        (u16 x, u16 y, u16 h, Color color) const;
-    Error draw_line         (u16 x, u16 y, u16 x2, u16 y2, Color color) const;
-    Error draw_rect         (u16 x, u16 y, u16 w, u16 h, Color color) const;
-    Error draw_circle       (u16 x, u16 y, u16 r, Color color) const;
+    // Drawing calls clip against the screen, shapes may be partly or fully off-screen
+    Error set_pixel         (i16 x, i16 y, Color color) const;
+    Error draw_bitmap       (i16 x, i16 y, u16 w, u16 h, const u16* data) const;
+    Error draw_bitmap_be    (i16 x, i16 y, u16 w, u16 h, const u16* data) const;
+    // Image written by `tools/gc9a01_imgconv.py`, decoded while it is sent
+    Error draw_image        (i16 x, i16 y, const u8* image, u32 size) const;
+    // Blended with what lies beneath, in direct mode with `background`
+    Error draw_sprite       (i16 x, i16 y, const GC9A01Sprite& sprite, Color background = Color(0, 0, 0)) const;
+    // Turned clockwise by `angle` in tenths of a degree and scaled by `scale` / 256 around
+    // `pivot_x`, `pivot_y` of the sprite, which lands on `x`, `y`
+    Error draw_rotated      (i16 x, i16 y, const GC9A01Sprite& sprite, i16 pivot_x, i16 pivot_y, i16 angle,
+                             u16 scale = 256, Color background = Color(0, 0, 0)) const;
+    Error draw_hline        (i16 x, i16 y, u16 w, Color color) const;
+    Error draw_vline        (i16 x, i16 y, u16 h, Color color) const;
+    Error draw_line         (i16 x0, i16 y0, i16 x1, i16 y1, Color color) const;
+    Error draw_rect         (i16 x, i16 y, u16 w, u16 h, Color color) const;
+    Error draw_round_rect   (i16 x, i16 y, u16 w, u16 h, u16 r, Color color) const;
+    Error draw_circle       (i16 x, i16 y, u16 r, Color color) const;
+    Error draw_arc          (i16 x, i16 y, u16 r_outer, u16 r_inner, i16 start, i16 end, Color color) const;
+    Error draw_triangle     (i16 x0, i16 y0, i16 x1, i16 y1, i16 x2, i16 y2, Color color) const;
 
     Error set_rotation      (u8 rotation) const;
+    // Hardware vertical scrolling, in GRAM rows
+    Error set_scroll_area   (u16 top_fixed, u16 lines) const;
+    Error scroll_to         (u16 line) const;
+    Error reset_scroll      () const;
+    Error set_color_mode    (const u8 colmod);
+    u8    color_mode        () const;
+#ifdef CONFIG_GC9A01_ROUND_MASK
+    void  set_round_mask    (bool enable);
+#endif
     
-    Error fill_rect         (u16 x, u16 y, u16 w, u16 h, Color color) const;
+    Error fill_rect         (i16 x, i16 y, u16 w, u16 h, Color color) const;
+    Error fill_round_rect   (i16 x, i16 y, u16 w, u16 h, u16 r, Color color) const;
+    Error fill_circle       (i16 x, i16 y, u16 r, Color color) const;
+    Error fill_triangle     (i16 x0, i16 y0, i16 x1, i16 y1, i16 x2, i16 y2, Color color) const;
     Error fill              (Color color) const;
 
+    // Text on an opaque background, `y` is the top of the first line, `\n` starts the next one
+    Error draw_text         (i16 x, i16 y, const char* text, const GC9A01Font& font, Color color, Color background) const;
+    // Width of the widest line of `text` in pixels
+    u16   text_width        (const char* text, const GC9A01Font& font) const;
+
+    // Send the dirty area of the framebuffer (buffer mode) or render the display
+    // list (band mode) to the display, no-op in direct mode
+    Error flush             () const;
+#ifdef CONFIG_GC9A01_BAND_MODE
+    void  set_background    (Color color);
+#endif
+
+    // Frame pacing, synchronized to the TE pulse if the transport has one
+    Error set_tear_scanline (u16 line) const;
+    void  set_frame_rate    (u16 fps);
+    Error present           () const;
+    const FrameStats& frame_stats() const;
+    void  reset_frame_stats ();
+
+    // Asynchronous operation
+    void  set_async         (bool async);
+    void  set_completion_callback(CompletionCallback callback, void* arg);
+    u32   fence             () const;
+    bool  is_done           (u32 fence) const;
+    Error wait              (u32 fence) const;
+    Error sync              () const;
+
+#ifdef CONFIG_GC9A01_STATS
+    const Stats& stats      () const;
+    void  reset_stats       ();
+#endif
+#ifdef CONFIG_GC9A01_TRACE
+    // May be called from another task while drawing
+    u32   read_trace        (TraceEntry* entries, u32 count) const;
+    void  dump_trace        () const;
+#endif
+
     // Reset
     Error soft_reset        () const;
     Error hard_reset        () const;
 
 private:
+    Error init_bus                  ();
+    Error init_panel                ();
+    static void init_task           (void* arg);
     Error cmd                       (const u8 cmnd) const;
     Error data                      (const u8* data, const u32 datasize) const;
-    Error set_write_window          (const u8 x, const u8 y, const u8 w, const u8 h) const;
-
-    spi_device_handle_t spi_;
-    spi_host_device_t host_;
-    gpio_num_t mosi_;
-    gpio_num_t clk_;
-    gpio_num_t cs_;
-    gpio_num_t dc_;
-    gpio_num_t rst_;
-    bool is_bgr_;
+    Error set_write_window          (const u16 x, const u16 y, const u16 w, const u16 h) const;
+    Error fill_color                (const u16 color16, const u32 pixels) const;
+    Error write_pixels              (const u16* src, const u16 w, const u16 h, const u32 stride, const bool swap) const;
+    template <class Format>
+    Error fill_color_as             (const u16 color16, const u32 pixels) const;
+    template <class Format>
+    Error write_pixels_as           (const u16* src, const u16 w, const u16 h, const u32 stride, const bool swap) const;
+    u32   burst_bytes               () const;
+    Error reserve                   () const;
+#ifdef CONFIG_GC9A01_TRACE
+    void  trace                     (const TraceEvent event, const u32 value) const;
+#endif
+    Error collect                   (const TickType_t timeout) const;
+    Error finish                    (const Error err) const;
+    void  invalidate_window         () const;
+    Error fill_area                 (const u16 x, const u16 y, const u16 w, const u16 h, const u16 color16) const;
+    Error blit_area                 (const u16 x, const u16 y, const u16 w, const u16 h, const u16* src, const u32 stride, const bool swap) const;
+    Error send_fill                 (const u16 x, const u16 y, const u16 w, const u16 h, const u16 color16) const;
+    Error send_pixels               (const u16 x, const u16 y, const u16 w, const u16 h, const u16* src, const u32 stride, const bool swap) const;
+    Error clip_fill                 (i32 x, i32 y, i32 w, i32 h, const u16 color16) const;
+    Error clip_blit                 (i32 x, i32 y, i32 w, i32 h, const u16* src, const bool swap) const;
+    Error round_rect_spans          (i16 x, i16 y, u16 w, u16 h, u16 r, const bool filled, const u16 color16) const;
+
+    // Ring segment of `draw_arc()`, the center is kept by the caller
+    struct Arc {
+        // Directions of the start and end rays in Q15, y grows downwards
+        i32 sx;
+        i32 sy;
+        i32 ex;
+        i32 ey;
+        u16 r_outer;
+        u16 r_inner;
+        // Degrees from the start to the end ray clockwise, 0 for the full ring
+        u16 sweep;
+        u16 color16;
+    };
+    u8    arc_runs                  (const Arc& arc, const i32 dy, i32 runs[4][2]) const;
+    static u8 circle_runs           (const i32 r, const i32 dy, const bool filled, i32 runs[2][2]);
+    Error draw_text_line            (const i16 x, const i16 y, const char* text, const u16 length, const GC9A01Font& font,
+                                     const Color color, const Color background) const;
+    Error alloc_text_slots          (const u8 count, u8& first) const;
+
+    /**
+     * State of the decoder of a compressed image, see `gc9a01_image.h`
+     */
+    struct ImageDecoder {
+        void  begin                 (const u8* image, const u32 size);
+        // Write the next `n` pixels as big-endian RGB565 to `dst`, drop them if `dst` is `nullptr`
+        void  decode                (u16* dst, u32 n);
+        void  skip                  (const u32 n) { decode(nullptr, n); }
+
+        const u8* image;
+        const u8* pos;
+        const u8* end;
+        // Repeats of `prev` left from the last run
+        u32 run;
+        u16 prev;
+        // Row of the image the decoder is at the start of
+        u16 row;
+        // Set if the data ended early, the missing pixels repeat the last one
+        bool truncated;
+        u16 index[64];
+    };
+    Error write_image               (ImageDecoder& decoder, const i16 x, const i16 y, const u16 w,
+                                     const u16 x0, const u16 y0, const u16 x1, const u16 y1) const;
+    template <class Format>
+    Error write_image_as            (ImageDecoder& decoder, const i16 x, const i16 y, const u16 w,
+                                     const u16 x0, const u16 y0, const u16 x1, const u16 y1) const;
+    void  blend_sprite              (u16* dst, const u32 stride, const GC9A01Sprite& sprite,
+                                     const u16 sx, const u16 sy, const u16 w, const u16 h,
+                                     u32* covered = nullptr, const u32 bit = 0) const;
+    template <class Format>
+    Error write_sprite_as           (const GC9A01Sprite& sprite, const i16 x, const i16 y,
+                                     const u16 x0, const u16 y0, const u16 x1, const u16 y1, const u16 background) const;
+
+    // Inverse mapping of `draw_rotated()`: the center of screen pixel `x`, `y` samples the
+    // sprite at `u0 + x * du_dx + y * du_dy`, `v0 + x * dv_dx + y * dv_dy`, in Q16
+    struct Affine {
+        i64 u0;
+        i64 v0;
+        i32 du_dx;
+        i32 dv_dx;
+        i32 du_dy;
+        i32 dv_dy;
+    };
+    bool  affine_span               (const Affine& t, const GC9A01Sprite& sprite, const i32 row,
+                                     i32& from, i32& to, u32& u, u32& v) const;
+    void  blend_affine              (u16* dst, const u32 stride, const Affine& t, const GC9A01Sprite& sprite,
+                                     const u16 x0, const u16 y0, const u16 x1, const u16 y1,
+                                     u32* covered = nullptr, const u32 bit = 0) const;
+    template <class Format>
+    Error write_affine_as           (const Affine& t, const GC9A01Sprite& sprite,
+                                     const u16 x0, const u16 y0, const u16 x1, const u16 y1, const u16 background) const;
+#ifdef CONFIG_GC9A01_BAND_MODE
+    Error record_circle             (const i16 x0, const i16 y0, const u16 r, const bool filled, const u16 color16) const;
+    Error render_list               () const;
+    Error render_early              () const;
+    template <class Format>
+    Error render_list_as            () const;
+    void  render_area               (u16* buf, const u16 x, const u16 y, const u16 w, const u16 h,
+                                     u32* covered = nullptr) const;
+#endif
+
+    /**
+     * Text line rendered into the text cache, stored at the index of its first slot
+     */
+    struct TextLine {
+        const GC9A01Font* font;
+        // Key of the line, RGB565 colors
+        u16 color;
+        u16 background;
+        char text[GC9A01_TEXT_CACHE_CHARS];
+        u8 length;
+        // Slots taken, 0 for a slot no line starts at
+        u8 slots;
+        // Whether the pixels may be reused for the same key, else they are a scratch area
+        bool cached;
+        // `text_clock_` at the last use, the least recently used lines are replaced first
+        u32 used;
+        // Last transfer reading the pixels
+        u32 fence;
+#ifdef CONFIG_GC9A01_BAND_MODE
+        // `list_generation_` when the line was recorded, the list references it until rendered
+        u32 generation;
+#endif
+    };
+
+    Transport* transport_;
+    // Set if the transport was created by a pin constructor
+    Transport* owned_transport_ = nullptr;
+    // The init sequence sets BGR order in MADCTL, rotation has to keep it
+    bool is_bgr_ = true;
+
+    // DMA capable ping-pong buffers, `dma_buf_[0]` also streams solid fills
+    u16* dma_buf_[2] = {nullptr, nullptr};
+    // Color currently repeated in `dma_buf_[0]` (in wire format), valid if `dma_buf_filled_`
+    mutable u16 dma_buf_color_ = 0;
+    mutable u32 dma_buf_filled_ = 0;
+    // Fence of the last transaction reading each DMA buffer
+    mutable u32 dma_buf_fence_[2] = {0, 0};
+
+    // Rendered text lines, allocated on the first `draw_text()`. They are kept as
+    // big-endian RGB565, the wire format of 16-bit COLMOD only: buffer and band mode
+    // copy them as RGB565, and the round mask cuts them at any column, which packed
+    // 12-bit pixels cannot start at. In 12 and 18-bit COLMOD each send converts them.
+    mutable u16* text_cache_ = nullptr;
+    mutable TextLine text_lines_[GC9A01_TEXT_CACHE_SLOTS] = {};
+    mutable u32 text_clock_ = 0;
+
+    // Number of transactions queued / collected so far
+    mutable u32 queued_ = 0;
+    mutable u32 completed_ = 0;
+    bool async_ = false;
+#ifdef CONFIG_GC9A01_ROUND_MASK
+    // Only send pixels behind the round glass
+    bool round_mask_ = true;
+#endif
+    // Pixel format on the wire, one of `COLOR_MODE_MCU_*`
+    u8 colmod_ = CONFIG_GC9A01_COLOR_MODE;
+    // Scroll area set by `set_scroll_area()`
+    mutable u16 scroll_top_ = 0;
+    mutable u16 scroll_lines_ = GC9A01_HEIGHT;
+
+    // Frame pacing of `present()`, times in us since boot
+    u32 frame_period_us_ = 0;
+    mutable i64 next_frame_us_ = 0;
+    mutable i64 last_frame_us_ = 0;
+    mutable FrameStats frame_stats_ = {};
+
+    // Time of the last reset (us since boot), the panel needs some time before SLPOUT
+    mutable i64 reset_at_ = 0;
+    // Given by the `init_async()` task once `init_result_` is set
+    SemaphoreHandle_t ready_ = nullptr;
+    Error init_result_ = OK;
+
+    // Address window last sent to the display, end coordinates are inclusive
+    mutable u16 win_x0_ = 0;
+    mutable u16 win_x1_ = 0;
+    mutable u16 win_y0_ = 0;
+    mutable u16 win_y1_ = 0;
+    mutable bool win_valid_ = false;
+    // Whether the last command was a memory write, so more pixels continue it
+    mutable bool writing_ = false;
+    // Pixels written since the memory write started
+    mutable u32 win_written_ = 0;
+
+    // Marks the primitive currently drawing, nested calls keep the outermost one
+    class PrimitiveScope {
+    public:
+        PrimitiveScope(const GC9A01* display, Primitive primitive);
+        ~PrimitiveScope();
+    private:
+        const GC9A01* display_;
+        bool outermost_;
+    };
+    mutable Primitive primitive_ = PRIM_OTHER;
+#ifdef CONFIG_GC9A01_STATS
+    mutable Stats stats_ = {};
+#endif
+#ifdef CONFIG_GC9A01_TRACE
+    // Ring of packed entries {time, event | primitive | value}, written by the
+    // drawing task only. `trace_head_` counts all entries ever written.
+    mutable std::atomic<u32> trace_[CONFIG_GC9A01_TRACE_DEPTH][2] = {};
+    mutable std::atomic<u32> trace_head_ = 0;
+#endif
+
+#if defined(CONFIG_GC9A01_BUFFER_MODE) || defined(CONFIG_GC9A01_BAND_MODE)
+    // Area of the screen, end coordinates are exclusive
+    struct Rect {
+        u16 x0;
+        u16 y0;
+        u16 x1;
+        u16 y1;
+    };
+#endif
+
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    void mark_dirty                 (const u16 x, const u16 y, const u16 w, const u16 h) const;
+#ifdef CONFIG_GC9A01_DIFF_FLUSH
+    Error send_changed              (const Rect& rect) const;
+#endif
+
+    // Framebuffer, pixels are stored big-endian so they can be sent as they are
+    u16* fb_ = nullptr;
+    mutable Rect dirty_[GC9A01_MAX_DIRTY_RECTS];
+    mutable u8 dirty_count_ = 0;
+    // Fence of the last flush reading the framebuffer
+    mutable u32 fb_fence_ = 0;
+#ifdef CONFIG_GC9A01_DIFF_FLUSH
+    // Frame the display shows, in the same format as `fb_`
+    u16* shadow_ = nullptr;
+    // Cleared when GRAM may no longer match `shadow_`, the next flush sends everything
+    mutable bool shadow_valid_ = false;
+#endif
+#endif
+
+#ifdef CONFIG_GC9A01_BAND_MODE
+    enum DrawOpType : u8 {
+        OP_FILL,
+        OP_BITMAP,
+        OP_CIRCLE,
+        OP_FILLED_CIRCLE,
+        OP_IMAGE,
+        OP_SPRITE,
+        OP_ROTATED,
+        OP_ARC
+    };
+    // Drawing call recorded for the next `flush()`
+    struct DrawOp {
+        // OP_BITMAP: first pixel, has to stay valid until `flush()`
+        const u16* src;
+        // OP_BITMAP, OP_IMAGE, OP_SPRITE: top left corner, circles and OP_ARC: center,
+        // OP_ROTATED: top left corner of the area it may cover
+        i16 x;
+        i16 y;
+        // OP_BITMAP, OP_IMAGE, OP_SPRITE, OP_ROTATED: size, circles and OP_ARC: (outer) radius in `w`,
+        // OP_FILL: first area in `fills_` and the number of areas
+        u16 w;
+        u16 h;
+        // RGB565 color, row stride in pixels for OP_BITMAP, decoder in `images_` for OP_IMAGE,
+        // sprite in `sprites_` for OP_SPRITE, sprite and mapping in `sprites_` and `affines_` for OP_ROTATED,
+        // ring segment in `arcs_` for OP_ARC
+        u16 value;
+        DrawOpType type;
+        // OP_BITMAP: pixels are little-endian
+        bool swap;
+    };
+    // Solid area of an OP_FILL, shapes break down into many of them
+    struct FillArea {
+        u8 x;
+        u8 y;
+        u8 w;
+        u8 h;
+    };
+    Error record                    (const DrawOp& op, const Rect& area) const;
+    Error record_fill               (const u16 x, const u16 y, const u16 w, const u16 h, const u16 color16) const;
+    void  record_area               (const Rect& area) const;
+
+    mutable DrawOp list_[CONFIG_GC9A01_DISPLAY_LIST_SIZE];
+    mutable u16 list_count_ = 0;
+    // Consecutive fills of the same color share one OP_FILL
+    mutable FillArea fills_[CONFIG_GC9A01_DISPLAY_LIST_FILLS];
+    mutable u16 fill_count_ = 0;
+    // Bounding box of the recorded operations
+    mutable Rect list_area_ = {GC9A01_WIDTH, GC9A01_HEIGHT, 0, 0};
+    // Where no operation draws, big-endian RGB565
+    u16 background_ = 0;
+    // Counts the renders of a non-empty list
+    mutable u32 list_generation_ = 0;
+    // Set when a full list was rendered before `flush()`, `painted_` then has a bit
+    // for each pixel sent since, which later renders of the frame must not paint over
+    mutable bool rendered_early_ = false;
+    mutable u32* painted_ = nullptr;
+    // Pixels of the band being rendered that an operation draws to
+    mutable u32 covered_[(GC9A01_DMA_BUFFER_PIXELS + 31) / 32];
+    // Decoders of the OP_IMAGE operations, they advance band by band
+    mutable ImageDecoder images_[GC9A01_DISPLAY_LIST_IMAGES];
+    mutable u8 image_count_ = 0;
+    // Copies of the sprites of the OP_SPRITE and OP_ROTATED operations
+    mutable GC9A01Sprite sprites_[GC9A01_DISPLAY_LIST_SPRITES];
+    // Mappings of the OP_ROTATED operations, at the index of their sprite
+    mutable Affine affines_[GC9A01_DISPLAY_LIST_SPRITES];
+    mutable u8 sprite_count_ = 0;
+    // Ring segments of the OP_ARC operations
+    mutable Arc arcs_[GC9A01_DISPLAY_LIST_ARCS];
+    mutable u8 arc_count_ = 0;
+#endif
 };
\ No newline at end of file
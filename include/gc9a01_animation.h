@@ -0,0 +1,120 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_animation.h
+ * @brief Delta-coded animations written by `tools/gc9a01_animconv.py` and their player
+ *
+ * An animation starts with a 16-byte header: the magic `"G5AN"`, then width,
+ * height, number of frames and frames per second as big-endian 16-bit values
+ * and the size of the largest frame as a big-endian 32-bit value. Each frame
+ * follows as
+ *
+ * - its size in bytes without this field, 32 bits
+ * - the number of rectangles, 16 bits
+ * - per rectangle: `x` and `y` in the animation, 16 bits each, the size of
+ *   the image, 32 bits, then the image (see `gc9a01_image.h`)
+ *
+ * all big-endian. The first frame covers the whole animation, later frames
+ * only the rectangles that changed since the frame before, a frame without
+ * changes has none.
+ */
+#pragma once
+
+#include "gc9a01.h"
+
+// Bytes before the first frame / before the rectangles of a frame
+#define GC9A01_ANIMATION_HEADER_SIZE 16
+#define GC9A01_ANIMATION_FRAME_HEADER_SIZE 6
+// Bytes before the image of a rectangle
+#define GC9A01_ANIMATION_RECT_HEADER_SIZE 8
+
+/**
+ * Plays a delta-coded animation on a display.
+ *
+ * Frames are read straight from memory, e.g. flash or a memory-mapped
+ * partition, or through a read function (a file, `esp_partition_read()`)
+ * into a buffer of the size of the largest frame. Each rectangle is decoded
+ * into the DMA buffers like `draw_image()` does, so a frame costs only the
+ * pixels that changed on the bus. In band mode each rectangle is rendered
+ * on its own, the background must not cover the pixels between them.
+ *
+ * `play_frame()` draws the next frame and hands it to `present()`, paced to
+ * the frame rate of the animation. In buffer mode a frame that is more than
+ * half a period late is dropped: it is drawn into the framebuffer, but sent
+ * together with the next one. In the other modes every frame is sent, late
+ * frames show up in `frame_stats().missed` of the display.
+ */
+class GC9A01Animation {
+public:
+    using Error = GC9A01::Error;
+    // Read `size` bytes at `offset` of the animation into `dst`, `false` on failure
+    typedef bool (*ReadFunction)(void* arg, u32 offset, u8* dst, u32 size);
+
+    /**
+     * Playback statistics since `open()` or `reset_stats()`
+     */
+    struct Stats {
+        // Frames sent by `present()`
+        u32 shown;
+        // Frames drawn but sent together with the next one
+        u32 dropped;
+        // Bytes of frame data read
+        u32 bytes;
+        // Time to read and draw the last frame and the slowest one, in microseconds
+        u32 last_frame_us;
+        u32 max_frame_us;
+    };
+
+    explicit GC9A01Animation(GC9A01& display);
+    ~GC9A01Animation();
+
+    GC9A01Animation(const GC9A01Animation&) = delete;
+    GC9A01Animation& operator=(const GC9A01Animation&) = delete;
+
+    // Play from memory, `data` has to stay valid while the animation is open
+    Error open              (const u8* data, u32 size);
+    // Play through `read`, frames are read into a buffer of the largest frame size
+    Error open              (ReadFunction read, void* arg, u32 size);
+    void  close             ();
+    void  set_position      (i16 x, i16 y);
+    Error play_frame        ();
+    Error play              (u32 loops = 1);
+    void  rewind            ();
+    bool  finished          () const;
+
+    u16   width             () const;
+    u16   height            () const;
+    u16   frame_count       () const;
+    u16   frame_rate        () const;
+    const Stats& stats      () const;
+    void  reset_stats       ();
+
+private:
+    Error open_header       (const u8* header, u32 size);
+    Error load_frame        (const u8*& frame, u32& size);
+    Error draw_frame        (const u8* frame, u32 size) const;
+
+    GC9A01& display_;
+    // Whole animation when played from memory
+    const u8* data_ = nullptr;
+    ReadFunction read_ = nullptr;
+    void* read_arg_ = nullptr;
+    // Frame buffer for `read_`, `max_frame_` bytes
+    u8* buf_ = nullptr;
+    u32 size_ = 0;
+    u32 max_frame_ = 0;
+    u16 width_ = 0;
+    u16 height_ = 0;
+    u16 frames_ = 0;
+    u16 fps_ = 0;
+    i16 x_ = 0;
+    i16 y_ = 0;
+
+    // Next frame and its offset
+    u16 frame_ = 0;
+    u32 offset_ = GC9A01_ANIMATION_HEADER_SIZE;
+    // Slot of the next frame, 0 before the first one
+    i64 due_us_ = 0;
+    Stats stats_ = {};
+};
@@ -0,0 +1,98 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_bus.h
+ * @brief Fair sharing of one bus between several displays
+ */
+#pragma once
+
+#include "gc9a01.h"
+
+// Displays one scheduler can share a bus between
+#define GC9A01_BUS_MAX_DEVICES  4
+// Largest transfer of a display on a shared bus, another display waits for at most about that long
+#define GC9A01_BUS_QUANTUM      (GC9A01_DMA_BUFFER_PIXELS * 2)
+
+class GC9A01SharedTransport;
+
+/**
+ * Takes turns between displays on one bus.
+ *
+ * The SPI master serves the devices of a host in a fixed order, whatever a
+ * device has queued goes out before the transfers of the next one. A display
+ * flushing a frame keeps its queue full, so the others get the bus only once
+ * it is done. Each display drawing from its own task goes through a
+ * `GC9A01SharedTransport`. While another display is blocked waiting for its
+ * transfers, a display keeps at most one transfer in flight and its transfers
+ * are at most a quantum long, so concurrent flushes alternate transfer by
+ * transfer. Without contention the full queue is used.
+ */
+class GC9A01BusScheduler {
+public:
+    explicit GC9A01BusScheduler(u32 quantum = GC9A01_BUS_QUANTUM);
+    ~GC9A01BusScheduler();
+
+    GC9A01BusScheduler(const GC9A01BusScheduler&) = delete;
+    GC9A01BusScheduler& operator=(const GC9A01BusScheduler&) = delete;
+
+    u32   quantum               () const;
+    // Times a display drained its queue to let another one on the bus
+    u32   yields                () const;
+
+private:
+    friend class GC9A01SharedTransport;
+
+    GC9A01::Error attach        (GC9A01SharedTransport* device);
+    void  detach                (GC9A01SharedTransport* device);
+    bool  contended             (const GC9A01SharedTransport* device);
+    void  set_blocked           (GC9A01SharedTransport* device, const bool blocked);
+
+    u32 quantum_;
+    u32 yields_ = 0;
+    // Guards everything below and the `blocked_` flags of the devices
+    SemaphoreHandle_t lock_ = nullptr;
+    GC9A01SharedTransport* devices_[GC9A01_BUS_MAX_DEVICES] = {};
+};
+
+/**
+ * Transport of one display on a shared bus, forwards to the transport of
+ * that display (e.g. a `GC9A01SpiTransport` with its own CS and D/C pins)
+ * and asks `scheduler` before every transfer.
+ */
+class GC9A01SharedTransport : public GC9A01::Transport {
+public:
+    GC9A01SharedTransport(GC9A01BusScheduler& scheduler, GC9A01::Transport& bus);
+    ~GC9A01SharedTransport() override;
+
+    GC9A01SharedTransport(const GC9A01SharedTransport&) = delete;
+    GC9A01SharedTransport& operator=(const GC9A01SharedTransport&) = delete;
+
+    GC9A01::Error begin         () override;
+    GC9A01::Error cmd           (const u8 command) override;
+    GC9A01::Error data          (const u8* data, const u32 size) override;
+    GC9A01::Error queue_data    (const u8* data, const u32 size) override;
+    GC9A01::Error collect       (const TickType_t timeout) override;
+    void  set_reset             (const bool level) override;
+    bool  has_reset             () const override;
+    bool  can_send_from         (const void* data) const override;
+    u32   max_transfer          () const override;
+    bool  has_tear              () const override;
+    GC9A01::Error wait_tear     (const TickType_t timeout) override;
+
+private:
+    friend class GC9A01BusScheduler;
+
+    static void forward_completion (u32 sequence, void* arg);
+    GC9A01::Error turn          ();
+    GC9A01::Error queued        (const GC9A01::Error err);
+
+    GC9A01BusScheduler& scheduler_;
+    GC9A01::Transport& bus_;
+    // Waiting for its own transfers, guarded by the lock of the scheduler
+    bool blocked_ = false;
+    // Transfers queued on `bus_` and not collected, and those collected
+    // by `turn()` that the driver did not collect yet
+    u32 in_flight_ = 0;
+    u32 collected_ = 0;
+};
@@ -0,0 +1,56 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_console.h
+ * @brief Scrolling text console on top of the hardware vertical scrolling
+ */
+#pragma once
+
+#include "gc9a01.h"
+
+// Size of a character cell of the built-in 5x7 font
+#define GC9A01_CONSOLE_CHAR_W   6
+#define GC9A01_CONSOLE_CHAR_H   8
+#define GC9A01_CONSOLE_COLUMNS  (GC9A01_WIDTH / GC9A01_CONSOLE_CHAR_W)
+
+/**
+ * Text console writing one line at a time into the scroll area of a display.
+ *
+ * Lines fill the scroll area from the top. Once it is full, each new line
+ * overwrites the oldest one in GRAM and the area is scrolled by one line, so
+ * a new line costs one line of pixels and one scroll command instead of a
+ * full redraw. Lines longer than `GC9A01_CONSOLE_COLUMNS` wrap.
+ *
+ * Rows are GRAM rows, so the console expects rotation 0. The corners of the
+ * round glass cut off the ends of the first and last lines, a scroll area
+ * away from the top and bottom (e.g. `begin(40, 160)`) avoids that.
+ */
+class GC9A01Console {
+public:
+    using Error = GC9A01::Error;
+
+    explicit GC9A01Console(GC9A01& display, Color foreground = Color(255, 255, 255), Color background = Color(0, 0, 0));
+
+    Error begin             (const u16 top_fixed = 0, const u16 height = GC9A01_HEIGHT);
+    Error clear             ();
+    // Print text, `\n` starts a new line
+    Error print             (const char* text);
+    Error printf            (const char* format, ...) __attribute__((format(printf, 2, 3)));
+    void  set_colors        (Color foreground, Color background);
+
+private:
+    Error new_line          (const char* text, const u16 length);
+
+    GC9A01& display_;
+    Color foreground_;
+    Color background_;
+    u16 top_ = 0;
+    // Lines in the scroll area
+    u16 lines_ = 0;
+    // Lines printed since `begin()` or `clear()`
+    u32 count_ = 0;
+    // Pixels of the line being sent, reused once `fence_` passed
+    alignas(4) u16 buf_[GC9A01_WIDTH * GC9A01_CONSOLE_CHAR_H];
+    u32 fence_ = 0;
+};
@@ -0,0 +1,45 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_font.h
+ * @brief Fonts pre-rasterized by `tools/gc9a01_fontconv.py`
+ *
+ * Each glyph is a box of alpha values stored as runs, row after row (a run
+ * may continue on the next row). A run is one byte: the upper nibble is the
+ * alpha from 0 (background) to 15 (foreground), the lower nibble the length
+ * minus one. Monochrome fonts only use alpha 0 and 15.
+ */
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Glyph of a `GC9A01Font`
+ */
+struct GC9A01Glyph {
+    // First run of the glyph in `GC9A01Font::runs`
+    uint32_t offset;
+    // Size of the box, 0 for glyphs without pixels (e.g. space)
+    uint8_t width;
+    uint8_t height;
+    // Pixels the pen moves to the right after the glyph
+    uint8_t advance;
+    // Top left corner of the box relative to the pen and the top of the line
+    int8_t x_offset;
+    int8_t y_offset;
+};
+
+/**
+ * Font covering the characters `first` to `last`, e.g. `' '` to `'~'`
+ */
+struct GC9A01Font {
+    const uint8_t* runs;
+    const GC9A01Glyph* glyphs;
+    uint8_t first;
+    uint8_t last;
+    // Distance between two lines
+    uint8_t line_height;
+    // Distance from the top of a line to the baseline
+    uint8_t baseline;
+};
@@ -0,0 +1,82 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_host.h
+ * @brief In-memory GC9A01 transport for host builds
+ */
+#pragma once
+
+#include <vector>
+
+#include "gc9a01.h"
+
+/**
+ * Transport without hardware. Queued transfers are only read when they are
+ * collected, like a DMA would, so buffers reused too early show up as wrong
+ * data. Every collected transfer is passed to `transfer()`, which records it.
+ */
+class GC9A01MemoryTransport : public GC9A01::Transport {
+public:
+    // One recorded transfer, its bytes are `log()[offset]` to `log()[offset + size - 1]`
+    struct Record {
+        bool dc;
+        u32 offset;
+        u32 size;
+    };
+
+    GC9A01MemoryTransport() = default;
+    ~GC9A01MemoryTransport() override = default;
+
+    GC9A01::Error begin         () override;
+    GC9A01::Error cmd           (const u8 command) override;
+    GC9A01::Error data          (const u8* data, const u32 size) override;
+    GC9A01::Error queue_data    (const u8* data, const u32 size) override;
+    GC9A01::Error collect       (const TickType_t timeout) override;
+    void  set_reset             (const bool level) override;
+    bool  has_reset             () const override;
+    bool  can_send_from         (const void* data) const override;
+    u32   max_transfer          () const override;
+
+    // Keep the bytes of every transfer, counters are updated either way
+    void  set_recording         (const bool recording);
+    // Refuse transfers longer than `bytes`, like a bus set up with that `max_transfer_sz`
+    void  set_max_transfer      (const u32 bytes);
+    const std::vector<Record>& records () const;
+    const std::vector<u8>& log  () const;
+    // Forget the recorded transfers and reset the counters
+    virtual void clear          ();
+
+    u32   transactions          () const;
+    u32   commands              () const;
+    u64   bytes                 () const;
+    // Transfers queued but not collected yet
+    u32   in_flight             () const;
+    bool  reset_level           () const;
+
+protected:
+    // Called for every transfer as it is collected, `dc` is `false` for commands
+    virtual void transfer       (const bool dc, const u8* data, const u32 size);
+
+private:
+    GC9A01::Error queue         (const u8* data, const u32 size, const bool dc, const bool copy);
+
+    struct Pending {
+        const u8* data;
+        u32 size;
+        u8 copy[GC9A01_INLINE_DATA];
+        bool dc;
+    };
+    Pending pending_[GC9A01_QUEUE_SIZE] = {};
+    u32 queued_ = 0;
+    u32 collected_ = 0;
+
+    bool recording_ = true;
+    u32 max_transfer_ = GC9A01_MAX_TRANSFER_SZ;
+    std::vector<Record> records_;
+    std::vector<u8> log_;
+    u32 transactions_ = 0;
+    u32 commands_ = 0;
+    u64 bytes_ = 0;
+    bool reset_level_ = true;
+};
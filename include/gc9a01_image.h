@@ -0,0 +1,45 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_image.h
+ * @brief Compressed RGB565 images written by `tools/gc9a01_imgconv.py`
+ *
+ * An image starts with an 8-byte header: the magic `"G565"`, then width and
+ * height as big-endian 16-bit values. The pixels follow row after row as a
+ * stream of operations in the spirit of QOI, working on the RGB565 channels
+ * (`r` and `b` with 5 bits, `g` with 6 bits). The decoder keeps the previous
+ * pixel, black at the start, and a table of 64 recently seen colors, each
+ * stored at `(r * 3 + g * 5 + b * 7) % 64`:
+ *
+ * - `00iiiiii`: the color at index `i` of the table
+ * - `01rrggbb`: the previous pixel plus `r - 2`, `g - 2`, `b - 2`
+ * - `10gggggg rrrrbbbb`: the previous pixel plus `dg = g - 32`, `dg + r - 8`
+ *   and `dg + b - 8` for the green, red and blue channel
+ * - `11nnnnnn` (`n` < 62): the previous pixel `n + 1` times
+ * - `0xFE` and 2 bytes: a big-endian RGB565 pixel
+ * - `0xFF` and 2 bytes: the previous pixel `63 + n` times, `n` big-endian
+ *
+ * Channels wrap around. Every pixel that is not part of a run is stored in
+ * the table. Runs may continue on the next row.
+ */
+#pragma once
+
+#include <cstdint>
+
+// Bytes before the first operation
+#define GC9A01_IMAGE_HEADER_SIZE 8
+
+/**
+ * @brief Read the size of an encoded image
+ * @return `false` if `image` does not start with a valid header
+ */
+inline bool gc9a01_image_size(const uint8_t* image, const uint32_t size, uint16_t& width, uint16_t& height) {
+    if (image == nullptr || size < GC9A01_IMAGE_HEADER_SIZE
+        || image[0] != 'G' || image[1] != '5' || image[2] != '6' || image[3] != '5') {
+        return false;
+    }
+    width = static_cast<uint16_t>((image[4] << 8) | image[5]);
+    height = static_cast<uint16_t>((image[6] << 8) | image[7]);
+    return true;
+}
@@ -0,0 +1,115 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_mock.h
+ * @brief Host-side GC9A01 panel emulator with a bus timing model
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "gc9a01_host.h"
+
+/**
+ * Transport that decodes the command stream like the panel would and applies
+ * it to a simulated GRAM. Handles CASET/RASET, RAMWR/RAMWRC in all three
+ * COLMOD formats, MADCTL, vertical scrolling, reset and the on/off commands.
+ * The TE output is simulated by `tear()`, which tests call from another
+ * thread in place of the panel refresh.
+ *
+ * Each collected transfer is charged `transaction_overhead_ns` plus the time
+ * its bytes take at `sck_hz`, `bus_time_ns()` gives the sum since `clear()`.
+ */
+class GC9A01MockPanel : public GC9A01MemoryTransport {
+public:
+    explicit GC9A01MockPanel(u32 sck_hz = 40000000, u32 transaction_overhead_ns = 10000);
+
+    // GRAM content as RGB565, addressed by memory row and column
+    u16   pixel                 (const u16 x, const u16 y) const;
+    const u16* gram             () const;
+    // What is shown at `x`, `y` on the glass, takes vertical scrolling into account
+    u16   shown_pixel           (const u16 x, const u16 y) const;
+
+    // Panel state set by commands
+    u8    madctl                () const;
+    u8    colmod                () const;
+    bool  sleeping              () const;
+    bool  display_on            () const;
+    bool  inverted              () const;
+    u16   scroll_start          () const;
+    bool  tear_on               () const;
+    // Parameter of TEON: 0 for V-blank only, 1 for V and H-blank
+    u8    tear_mode             () const;
+    u16   tear_scanline         () const;
+
+    // Pulse TE, ignored while TEON is off. May be called from any thread.
+    void  tear                  ();
+    // Pulses sent since construction
+    u32   tears                 () const;
+
+    // Counters since `clear()`
+    u64   bus_time_ns           () const;
+    u32   pixels_written        () const;
+    u32   memory_writes         () const;
+    // Data without a command expecting it, or pixels sent before a reset finished
+    u32   protocol_errors       () const;
+
+    void  set_sck               (const u32 sck_hz);
+    void  set_transaction_overhead(const u32 ns);
+    void  clear                 () override;
+    void  set_reset             (const bool level) override;
+    bool  has_tear              () const override;
+    GC9A01::Error wait_tear     (const TickType_t timeout) override;
+
+protected:
+    void  transfer              (const bool dc, const u8* data, const u32 size) override;
+
+private:
+    void  reset_state           ();
+    void  command               (const u8 command);
+    void  parameter             (const u8 value);
+    void  pixel_byte            (const u8 value);
+    void  put                   (const u16 color565);
+
+    u32 sck_hz_;
+    u32 overhead_ns_;
+    u64 bus_time_ns_ = 0;
+    u32 pixels_written_ = 0;
+    u32 memory_writes_ = 0;
+    u32 protocol_errors_ = 0;
+
+    u16 gram_[GC9A01_PIXELS] = {};
+    u8 command_ = 0;
+    u8 params_[8] = {};
+    u8 param_count_ = 0;
+    // Bytes of the pixel (or pixel pair in 12-bit mode) being assembled
+    u8 partial_[3] = {};
+    u8 partial_count_ = 0;
+
+    u16 col_start_ = 0;
+    u16 col_end_ = GC9A01_WIDTH - 1;
+    u16 row_start_ = 0;
+    u16 row_end_ = GC9A01_HEIGHT - 1;
+    u16 col_ = 0;
+    u16 row_ = 0;
+
+    u8 madctl_ = 0;
+    u8 colmod_ = COLOR_MODE_MCU_18BIT;
+    bool sleeping_ = true;
+    bool display_on_ = false;
+    bool inverted_ = false;
+    u16 top_fixed_ = 0;
+    u16 scroll_height_ = GC9A01_HEIGHT;
+    u16 scroll_start_ = 0;
+    u16 tear_scanline_ = 0;
+    u8 tear_mode_ = 0;
+
+    // Set by the driver thread, read by the one calling `tear()`
+    std::atomic<bool> tear_on_ = false;
+    mutable std::mutex tear_mutex_;
+    std::condition_variable tear_pulse_;
+    u32 tears_ = 0;
+};
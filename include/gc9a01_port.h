@@ -0,0 +1,130 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_port.h
+ * @brief FreeRTOS / ESP-IDF API used by the driver, mapped to the C++ standard library on a host
+ */
+#pragma once
+
+#include <cstdint>
+
+#ifdef ESP_PLATFORM
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+
+#else
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define portMAX_DELAY       UINT32_MAX
+#define portNUM_PROCESSORS  2
+#define tskNO_AFFINITY      INT32_MAX
+#define portTICK_PERIOD_MS  1
+#define pdMS_TO_TICKS(ms)   (ms)
+#define pdFALSE             0
+#define pdTRUE              1
+#define pdPASS              1
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+
+inline void vTaskDelay(const TickType_t ticks) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
+
+// Tasks become detached threads, priority and stack size are ignored
+inline BaseType_t xTaskCreate(TaskFunction_t task, const char*, uint32_t, void* arg, UBaseType_t, TaskHandle_t* handle) {
+    std::thread(task, arg).detach();
+    if (handle != nullptr) {
+        *handle = nullptr;
+    }
+    return pdPASS;
+}
+
+// The core is ignored as well
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stack, void* arg,
+                                          UBaseType_t priority, TaskHandle_t* handle, BaseType_t) {
+    return xTaskCreate(task, name, stack, arg, priority, handle);
+}
+
+// Returning ends the thread
+inline void vTaskDelete(TaskHandle_t) {
+}
+
+struct HostSemaphore {
+    std::mutex mutex;
+    std::condition_variable given;
+    bool available = false;
+};
+typedef HostSemaphore* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return new HostSemaphore();
+}
+
+// Not recursive and without priority inheritance, which threads do not need
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+    SemaphoreHandle_t sem = new HostSemaphore();
+    sem->available = true;
+    return sem;
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, const TickType_t timeout) {
+    std::unique_lock<std::mutex> lock(sem->mutex);
+    const auto available = [sem] { return sem->available; };
+    if (timeout == portMAX_DELAY) {
+        sem->given.wait(lock, available);
+    } else if (!sem->given.wait_for(lock, std::chrono::milliseconds(timeout * portTICK_PERIOD_MS), available)) {
+        return pdFALSE;
+    }
+    sem->available = false;
+    return pdTRUE;
+}
+
+// Notifies under the lock, the woken task may delete the semaphore right away
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    std::lock_guard<std::mutex> lock(sem->mutex);
+    sem->available = true;
+    sem->given.notify_one();
+    return pdTRUE;
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    delete sem;
+}
+
+inline int64_t esp_timer_get_time() {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+inline void esp_rom_delay_us(const uint32_t us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+// Any memory will do, capabilities are ignored
+inline void* heap_caps_malloc(const size_t size, uint32_t) {
+    return std::aligned_alloc(4, (size + 3) & ~static_cast<size_t>(3));
+}
+
+inline void heap_caps_free(void* ptr) {
+    std::free(ptr);
+}
+
+#endif
@@ -0,0 +1,164 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_queue.h
+ * @brief Drawing from any task through a lock-free command queue and a display task
+ */
+#pragma once
+
+#include <atomic>
+
+#include "gc9a01.h"
+
+#ifndef CONFIG_GC9A01_COMMAND_QUEUE_SIZE
+#define CONFIG_GC9A01_COMMAND_QUEUE_SIZE 64
+#endif
+static_assert((CONFIG_GC9A01_COMMAND_QUEUE_SIZE & (CONFIG_GC9A01_COMMAND_QUEUE_SIZE - 1)) == 0,
+              "CONFIG_GC9A01_COMMAND_QUEUE_SIZE has to be a power of two");
+
+// Core of the display task, the second core on a dual-core chip
+#define GC9A01_DISPLAY_CORE (portNUM_PROCESSORS - 1)
+
+/**
+ * Runs the drawing calls of a display on a task of its own.
+ *
+ * `GC9A01` keeps the address window and the transfer queue of the bus as
+ * state, so its methods must only be called from one task. Tasks on any core
+ * submit drawing calls here instead: each call is a fixed-size command in a
+ * bounded, lock-free multi-producer ring. The display task, pinned to the
+ * other core by default, takes them out in order and does the conversion and
+ * SPI work, while the submitting tasks go on rendering.
+ *
+ * Commands run in the order they were submitted. A submit blocks only while
+ * the queue is full. Only pointers are queued: bitmaps, images, sprites
+ * (the `GC9A01Sprite` as well as its pixels), strings and fonts are read when
+ * their command runs, so they have to stay valid and untouched until `sync()`
+ * returned. The same goes for the argument of `call()`, the way to run any
+ * other method of the display. Errors of commands are kept until `error()`
+ * is called.
+ */
+class GC9A01CommandQueue {
+public:
+    using Error = GC9A01::Error;
+    // Runs on the display task with the display, for anything without a command of its own
+    typedef Error (*Function)(GC9A01& display, void* arg);
+
+    explicit GC9A01CommandQueue(GC9A01& display);
+    ~GC9A01CommandQueue();
+
+    GC9A01CommandQueue(const GC9A01CommandQueue&) = delete;
+    GC9A01CommandQueue& operator=(const GC9A01CommandQueue&) = delete;
+
+    // Start the display task, commands submitted before wait for it
+    Error begin             (const BaseType_t core = GC9A01_DISPLAY_CORE, const UBaseType_t priority = 5);
+    // Run what was submitted and stop the task
+    void  end               ();
+
+    Error set_pixel         (i16 x, i16 y, Color color);
+    Error draw_bitmap       (i16 x, i16 y, u16 w, u16 h, const u16* data);
+    Error draw_bitmap_be    (i16 x, i16 y, u16 w, u16 h, const u16* data);
+    Error draw_image        (i16 x, i16 y, const u8* image, u32 size);
+    Error draw_sprite       (i16 x, i16 y, const GC9A01Sprite& sprite, Color background = Color(0, 0, 0));
+    Error draw_rotated      (i16 x, i16 y, const GC9A01Sprite& sprite, i16 pivot_x, i16 pivot_y, i16 angle,
+                             u16 scale = 256, Color background = Color(0, 0, 0));
+    Error draw_text         (i16 x, i16 y, const char* text, const GC9A01Font& font, Color color, Color background);
+    Error draw_hline        (i16 x, i16 y, u16 w, Color color);
+    Error draw_vline        (i16 x, i16 y, u16 h, Color color);
+    Error draw_line         (i16 x0, i16 y0, i16 x1, i16 y1, Color color);
+    Error draw_rect         (i16 x, i16 y, u16 w, u16 h, Color color);
+    Error draw_round_rect   (i16 x, i16 y, u16 w, u16 h, u16 r, Color color);
+    Error draw_circle       (i16 x, i16 y, u16 r, Color color);
+    Error draw_arc          (i16 x, i16 y, u16 r_outer, u16 r_inner, i16 start, i16 end, Color color);
+    Error draw_triangle     (i16 x0, i16 y0, i16 x1, i16 y1, i16 x2, i16 y2, Color color);
+    Error fill_rect         (i16 x, i16 y, u16 w, u16 h, Color color);
+    Error fill_round_rect   (i16 x, i16 y, u16 w, u16 h, u16 r, Color color);
+    Error fill_circle       (i16 x, i16 y, u16 r, Color color);
+    Error fill_triangle     (i16 x0, i16 y0, i16 x1, i16 y1, i16 x2, i16 y2, Color color);
+    Error fill              (Color color);
+    Error set_rotation      (u8 rotation);
+    Error flush             ();
+    Error present           ();
+    Error call              (Function function, void* arg);
+
+    // Wait until everything submitted so far by any task was sent
+    Error sync              (const TickType_t timeout = portMAX_DELAY);
+    // First error of a command since the last call, `OK` if there was none
+    Error error             ();
+
+private:
+    enum Op : u8 {
+        OP_SET_PIXEL,
+        OP_BITMAP,
+        OP_BITMAP_BE,
+        OP_IMAGE,
+        OP_SPRITE,
+        OP_ROTATED,
+        OP_TEXT,
+        OP_HLINE,
+        OP_VLINE,
+        OP_LINE,
+        OP_RECT,
+        OP_ROUND_RECT,
+        OP_CIRCLE,
+        OP_ARC,
+        OP_TRIANGLE,
+        OP_FILL_RECT,
+        OP_FILL_ROUND_RECT,
+        OP_FILL_CIRCLE,
+        OP_FILL_TRIANGLE,
+        OP_FILL,
+        OP_ROTATION,
+        OP_FLUSH,
+        OP_PRESENT,
+        OP_CALL,
+        OP_SYNC,
+        OP_STOP
+    };
+    // Drawing call with its arguments in call order, sizes and radii included
+    struct Command {
+        Function function;
+        const void* ptr;
+        // Font of `draw_text()`
+        const void* aux;
+        i16 args[7];
+        Color color;
+        // Background of `draw_text()`
+        Color background;
+        Op op;
+    };
+    // Slot of the ring, `sequence` tells whose turn it is (see `push()`)
+    struct Cell {
+        std::atomic<u32> sequence;
+        Command command;
+    };
+
+    static void task        (void* arg);
+    Error submit            (const Command& command, u32* ticket = nullptr);
+    bool  push              (const Command& command, u32& ticket);
+    bool  pop               (Command& command);
+    Error run               (const Command& command);
+
+    GC9A01& display_;
+    Cell cells_[CONFIG_GC9A01_COMMAND_QUEUE_SIZE];
+    // Next position to write, claimed by producers with a compare-and-swap
+    std::atomic<u32> head_ = 0;
+    // Next position to read, owned by the display task
+    u32 tail_ = 0;
+    // Commands done, `sync()` waits for its ticket to pass
+    std::atomic<u32> done_ = 0;
+    std::atomic<Error> error_ = GC9A01::OK;
+
+    // Set while the display task sleeps on `work_`, the next push gives it
+    std::atomic<bool> idle_ = false;
+    // Tasks blocked on a full queue / in `sync()`, the display task gives
+    // `space_` / `passed_` after each command while there are any
+    std::atomic<u32> full_waiters_ = 0;
+    std::atomic<u32> sync_waiters_ = 0;
+    SemaphoreHandle_t work_ = nullptr;
+    SemaphoreHandle_t space_ = nullptr;
+    SemaphoreHandle_t passed_ = nullptr;
+    // Given by the display task when it stopped
+    SemaphoreHandle_t stopped_ = nullptr;
+    bool running_ = false;
+};
@@ -0,0 +1,83 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_spi.h
+ * @brief GC9A01 transport over the ESP-IDF SPI master driver
+ */
+#pragma once
+
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+
+#include "gc9a01.h"
+
+/**
+ * Sends through `spi_device_queue_trans()` with a fixed pool of descriptors,
+ * D/C is driven from the pre-transfer callback of each transaction. If the
+ * TE output of the panel is connected, its rising edge gives a semaphore
+ * from a GPIO interrupt.
+ *
+ * `max_transfer` is the `max_transfer_sz` the SPI host is initialized with.
+ * A transport joining a host set up by another `GC9A01SpiTransport` takes
+ * the limit recorded by that one. For a host set up by the application,
+ * pass the `max_transfer_sz` it used.
+ */
+class GC9A01SpiTransport : public GC9A01::Transport {
+public:
+    GC9A01SpiTransport(spi_host_device_t host, gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs,
+                       gpio_num_t dc, gpio_num_t rst, gpio_num_t te = GPIO_NUM_NC,
+                       int clock_hz = CONFIG_GC9A01_SPI_SCK_FREQ_M * 1000000,
+                       u32 max_transfer = GC9A01_MAX_TRANSFER_SZ);
+    ~GC9A01SpiTransport() override;
+
+    GC9A01SpiTransport(const GC9A01SpiTransport&) = delete;
+    GC9A01SpiTransport& operator=(const GC9A01SpiTransport&) = delete;
+
+    GC9A01::Error begin         () override;
+    GC9A01::Error cmd           (const u8 command) override;
+    GC9A01::Error data          (const u8* data, const u32 size) override;
+    GC9A01::Error queue_data    (const u8* data, const u32 size) override;
+    GC9A01::Error collect       (const TickType_t timeout) override;
+    void  set_reset             (const bool level) override;
+    bool  has_reset             () const override;
+    bool  can_send_from         (const void* data) const override;
+    u32   max_transfer          () const override;
+    bool  has_tear              () const override;
+    GC9A01::Error wait_tear     (const TickType_t timeout) override;
+
+private:
+    GC9A01::Error queue         (const u8* data, const u32 size, const u8 dc, const bool copy);
+    GC9A01::Error begin_tear    ();
+
+    static void pre_transfer_callback   (spi_transaction_t* t);
+    static void post_transfer_callback  (spi_transaction_t* t);
+    static void tear_isr                (void* arg);
+
+    // Transaction descriptor, used round robin in queue order
+    struct Transaction {
+        spi_transaction_t trans;
+        const GC9A01SpiTransport* owner;
+        u32 sequence;
+        u8 dc;
+    };
+
+    spi_device_handle_t spi_ = nullptr;
+    spi_host_device_t host_;
+    gpio_num_t mosi_;
+    gpio_num_t clk_;
+    gpio_num_t cs_;
+    gpio_num_t dc_;
+    gpio_num_t rst_;
+    gpio_num_t te_;
+    int clock_hz_;
+    u32 max_transfer_;
+    // Given on every TE pulse
+    SemaphoreHandle_t tear_ = nullptr;
+
+    Transaction pool_[GC9A01_QUEUE_SIZE];
+    u32 queued_ = 0;
+
+    // `max_transfer_sz` of the hosts initialized by a transport, 0 for the others
+    static u32 bus_max_transfer_[SPI_HOST_MAX];
+};
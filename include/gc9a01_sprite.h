@@ -0,0 +1,43 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_sprite.h
+ * @brief Sprites: RGB565 bitmaps with a transparent color or an alpha channel
+ *
+ * The pixels are stored like the ones of `draw_bitmap()`, RGB565 in CPU
+ * byte order, row after row. The alpha channel is a separate array, with
+ * 8 bits per pixel or 4 bits, where two pixels share a byte (the left one in
+ * the upper nibble) and every row starts on a new byte.
+ */
+#pragma once
+
+#include <cstdint>
+
+/**
+ * How the pixels of a sprite cover what lies beneath
+ */
+enum GC9A01SpriteMode : uint8_t {
+    // Every pixel is drawn, like `draw_bitmap()`
+    GC9A01_SPRITE_OPAQUE,
+    // Pixels of the color `key` are transparent
+    GC9A01_SPRITE_KEY,
+    // `alpha` holds one byte per pixel, 0 is transparent, 255 opaque
+    GC9A01_SPRITE_ALPHA8,
+    // `alpha` holds 4 bits per pixel, 0 is transparent, 15 opaque
+    GC9A01_SPRITE_ALPHA4
+};
+
+/**
+ * Sprite drawn by `GC9A01::draw_sprite()`
+ */
+struct GC9A01Sprite {
+    const uint16_t* pixels;
+    // Alpha channel of `GC9A01_SPRITE_ALPHA8` / `GC9A01_SPRITE_ALPHA4`, else unused
+    const uint8_t* alpha;
+    uint16_t width;
+    uint16_t height;
+    GC9A01SpriteMode mode;
+    // Transparent RGB565 color of `GC9A01_SPRITE_KEY`
+    uint16_t key;
+};
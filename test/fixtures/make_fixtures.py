@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+@author Daniel Mironov
+@copyright Copyright (c) 2024, Daniel Mironov
+@license MIT
+@file make_fixtures.py
+@brief Regenerate the image and animation fixtures of the tests
+
+Draws a test image and the frames of a test animation, converts them with
+`tools/gc9a01_imgconv.py` and `tools/gc9a01_animconv.py` and writes the
+RGB565 pixels they have to decode to, straight from the source images.
+
+    python3 test/fixtures/make_fixtures.py
+
+Needs Pillow (`pip install pillow`).
+"""
+
+import os
+import subprocess
+import sys
+import tempfile
+
+from PIL import Image
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TOOLS = os.path.join(HERE, "..", "..", "tools")
+
+IMAGE_SIZE = (48, 40)
+FRAME_SIZE = (32, 32)
+FRAMES = 6
+
+
+def rgb565(r, g, b):
+    return (((r * 31 + 127) // 255) << 11) | (((g * 63 + 127) // 255) << 5) | ((b * 31 + 127) // 255)
+
+
+def test_image():
+    """Gradients, flat areas, a few repeating colors and noise, so every operation of the format is used"""
+    width, height = IMAGE_SIZE
+    image = Image.new("RGB", IMAGE_SIZE)
+    seed = 1
+    for y in range(height):
+        for x in range(width):
+            if y < 10:
+                color = (x * 5, 40 + y * 3, 200 - x * 4)
+            elif y < 20:
+                color = (30, 90, 160) if x < 30 else (250, 250, 250)
+            elif y < 30:
+                color = [(255, 0, 0), (0, 255, 0), (0, 0, 255), (255, 255, 0)][(x // 3 + y) % 4]
+            else:
+                seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+                color = (seed >> 8 & 0xFF, seed >> 16 & 0xFF, seed >> 4 & 0xFF)
+            image.putpixel((x, y), color)
+    return image
+
+
+def test_frame(index):
+    """A square moving over a gradient, with a blinking corner"""
+    width, height = FRAME_SIZE
+    image = Image.new("RGB", FRAME_SIZE)
+    for y in range(height):
+        for x in range(width):
+            color = (x * 8, y * 8, 128)
+            if index * 4 <= x < index * 4 + 8 and 10 <= y < 18:
+                color = (255, 255, 255)
+            if x >= 28 and y >= 28 and index % 2 == 1:
+                color = (0, 0, 0)
+            image.putpixel((x, y), color)
+    return image
+
+
+def write_reference(path, name, images, size):
+    width, height = size
+    out = [f"// RGB565 pixels of {name}, generated by test/fixtures/make_fixtures.py",
+           "#pragma once",
+           "",
+           "#include <cstdint>",
+           "",
+           f"static const uint16_t {name}[{len(images)}][{width * height}] = {{"]
+    for image in images:
+        pixels = [rgb565(*image.getpixel((x, y))) for y in range(height) for x in range(width)]
+        out.append("    {")
+        for i in range(0, len(pixels), 12):
+            out.append("        " + ", ".join(f"0x{p:04X}" for p in pixels[i:i + 12]) + ",")
+        out.append("    },")
+    out.append("};")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def main():
+    with tempfile.TemporaryDirectory() as tmp:
+        image = test_image()
+        image_path = os.path.join(tmp, "test_image.png")
+        image.save(image_path)
+        # Run in the directory of the sources, the headers name them
+        subprocess.run([sys.executable, os.path.join(TOOLS, "gc9a01_imgconv.py"), "test_image.png",
+                        "-o", os.path.join(HERE, "test_image.h")], cwd=tmp, check=True)
+        write_reference(os.path.join(HERE, "test_image_ref.h"), "test_image_ref", [image], IMAGE_SIZE)
+
+        frames = [test_frame(i) for i in range(FRAMES)]
+        paths = []
+        for i, frame in enumerate(frames):
+            paths.append(f"frame{i}.png")
+            frame.save(os.path.join(tmp, paths[-1]))
+        subprocess.run([sys.executable, os.path.join(TOOLS, "gc9a01_animconv.py"), *paths, "--fps", "50",
+                        "-o", os.path.join(HERE, "test_anim.h")], cwd=tmp, check=True)
+        write_reference(os.path.join(HERE, "test_anim_ref.h"), "test_anim_ref", frames, FRAME_SIZE)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,188 @@
+// 6 frames, 32x32 at 50 fps, generated by tools/gc9a01_animconv.py
+#pragma once
+
+#include <cstdint>
+
+static const uint8_t test_anim[] = {
+    0x47, 0x35, 0x41, 0x4E, 0x00, 0x20, 0x00, 0x20, 0x00, 0x06, 0x00, 0x32, 0x00, 0x00, 0x04, 0x11,
+    0x00, 0x00, 0x04, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x47, 0x35,
+    0x36, 0x35, 0x00, 0x20, 0x00, 0x20, 0xFE, 0x00, 0x10, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2,
+    0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0xFE, 0xFF, 0xFF, 0xC6, 0xFE, 0x42, 0x90, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31,
+    0xC6, 0xFE, 0x42, 0xD0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x43, 0x10,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x43, 0x50, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0xFE, 0xFF, 0xFF, 0xC6, 0xFE, 0x43, 0x90, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x31, 0xC6, 0xFE, 0x43, 0xD0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE,
+    0x44, 0x10, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xFF, 0xFF, 0xC6, 0xFE, 0x44, 0x50,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA1, 0x97, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA2,
+    0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0xA2, 0x86, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x00, 0x00, 0x01, 0x6E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00,
+    0x00, 0x01, 0x0B, 0x47, 0x35, 0x36, 0x35, 0x00, 0x10, 0x00, 0x10, 0xFE, 0x02, 0x10, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x02, 0x50,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE,
+    0x02, 0x90, 0x7A, 0x7A, 0x7A, 0xFE, 0xFF, 0xFF, 0xC6, 0xB5, 0x04, 0x7A, 0x7A, 0x7A, 0xFE, 0x02,
+    0xD0, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x62, 0xD0, 0x7A, 0x7A, 0x7A, 0xFE, 0x03, 0x10, 0x7A,
+    0x7A, 0x7A, 0xFE, 0xFF, 0xFF, 0xC6, 0xFE, 0x63, 0x10, 0x7A, 0x7A, 0x7A, 0xFE, 0x03, 0x50, 0x7A,
+    0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x63, 0x50, 0x7A, 0x7A, 0x7A, 0xFE, 0x03, 0x90, 0x7A, 0x7A, 0x7A,
+    0x31, 0xC6, 0xFE, 0x63, 0x90, 0x7A, 0x7A, 0x7A, 0xFE, 0x03, 0xD0, 0x7A, 0x7A, 0x7A, 0x31, 0xC6,
+    0xFE, 0x63, 0xD0, 0x7A, 0x7A, 0x7A, 0xFE, 0x04, 0x10, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x64,
+    0x10, 0x7A, 0x7A, 0x7A, 0xFE, 0x04, 0x50, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x64, 0x50, 0x7A,
+    0x7A, 0x7A, 0xFE, 0x04, 0x90, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x04, 0xD0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x05, 0x10, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x05, 0x50, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x05, 0x70, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x05, 0xB0, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x00, 0x18,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x51, 0x47, 0x35, 0x36, 0x35, 0x00, 0x08, 0x00, 0x08, 0xFE, 0xBD,
+    0xF0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0x30, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0xFE, 0xBE, 0x70, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0xB0, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0xF0, 0x7A, 0x7A, 0x7A, 0xA9, 0x5F, 0xC2, 0xFE,
+    0xBF, 0x30, 0x7A, 0x7A, 0x7A, 0x00, 0xC2, 0xFE, 0xBF, 0x70, 0x7A, 0x7A, 0x7A, 0x00, 0xC2, 0xFE,
+    0xBF, 0xB0, 0x7A, 0x7A, 0x7A, 0x00, 0xC2, 0x00, 0x00, 0x01, 0x66, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0xFC, 0x47, 0x35, 0x36, 0x35, 0x00, 0x10, 0x00, 0x10, 0xFE, 0x02, 0x10,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE,
+    0x02, 0x50, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0xFE, 0x02, 0x90, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xFF, 0xFF, 0xC6, 0xFE,
+    0x02, 0xD0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x03, 0x10, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xFF, 0xFF, 0xC6, 0xFE, 0x03, 0x50, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x03, 0x90, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31,
+    0xC6, 0xFE, 0x03, 0xD0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x04, 0x10,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x04, 0x50, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x04, 0x90, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x04, 0xD0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x05, 0x10, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x05, 0x50, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x05, 0x70,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE,
+    0x05, 0xB0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x58, 0x47, 0x35, 0x36, 0x35, 0x00, 0x08, 0x00,
+    0x08, 0xFE, 0xBD, 0xF0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0x30, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0x70, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE,
+    0xBE, 0xB0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0xF0, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0xFE, 0xBF, 0x30, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBF, 0x70,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBF, 0xB0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x00, 0x00, 0x01, 0x6D, 0x00, 0x02, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x01, 0x0A, 0x47,
+    0x35, 0x36, 0x35, 0x00, 0x10, 0x00, 0x10, 0xB0, 0x08, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x42, 0x50, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x42, 0x90, 0x7A, 0x7A, 0x7A,
+    0xFE, 0xFF, 0xFF, 0xC6, 0xB5, 0x74, 0x7A, 0x7A, 0x7A, 0xFE, 0x42, 0xD0, 0x7A, 0x7A, 0x7A, 0x31,
+    0xC6, 0xB7, 0x52, 0x7A, 0x7A, 0x7A, 0xFE, 0x43, 0x10, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xB9, 0x30,
+    0x7A, 0x7A, 0x7A, 0xFE, 0x43, 0x50, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x9B, 0x50, 0x7A, 0x7A,
+    0x7A, 0xFE, 0x43, 0x90, 0x7A, 0x7A, 0x7A, 0xFE, 0xFF, 0xFF, 0xC6, 0xFE, 0x9B, 0x90, 0x7A, 0x7A,
+    0x7A, 0xFE, 0x43, 0xD0, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x9B, 0xD0, 0x7A, 0x7A, 0x7A, 0xFE,
+    0x44, 0x10, 0x7A, 0x7A, 0x7A, 0xFE, 0xFF, 0xFF, 0xC6, 0xFE, 0x9C, 0x10, 0x7A, 0x7A, 0x7A, 0xFE,
+    0x44, 0x50, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x9C, 0x50, 0x7A, 0x7A, 0x7A, 0xFE, 0x44, 0x90,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE,
+    0x44, 0xD0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A,
+    0x7A, 0xFE, 0x45, 0x10, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A,
+    0x7A, 0x7A, 0x7A, 0xFE, 0x45, 0x50, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x45, 0x70, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x45, 0xB0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x51, 0x47, 0x35, 0x36, 0x35, 0x00, 0x08, 0x00, 0x08, 0xFE, 0xBD, 0xF0, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0x30, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0x70,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0xB0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0xFE, 0xBE, 0xF0, 0x7A, 0x7A, 0x7A, 0xA9, 0x5F, 0xC2, 0xFE, 0xBF, 0x30, 0x7A, 0x7A, 0x7A,
+    0x00, 0xC2, 0xFE, 0xBF, 0x70, 0x7A, 0x7A, 0x7A, 0x00, 0xC2, 0xFE, 0xBF, 0xB0, 0x7A, 0x7A, 0x7A,
+    0x00, 0xC2, 0x00, 0x00, 0x01, 0x64, 0x00, 0x02, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0xFA,
+    0x47, 0x35, 0x36, 0x35, 0x00, 0x10, 0x00, 0x10, 0xB0, 0x08, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x42, 0x50, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x42, 0x90, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x8B, 0xDC, 0xC6, 0xFE, 0x42, 0xD0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x43, 0x10, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31, 0xC6,
+    0xFE, 0x43, 0x50, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x43, 0x90, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x43, 0xD0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x44, 0x10, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xFF,
+    0xFF, 0xC6, 0xFE, 0x44, 0x50, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x31, 0xC6, 0xFE, 0x44,
+    0x90, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A,
+    0xFE, 0x44, 0xD0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A,
+    0x7A, 0x7A, 0xFE, 0x45, 0x10, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0,
+    0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x45, 0x50, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x45, 0x70, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x45, 0xB0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x58, 0x47, 0x35, 0x36, 0x35, 0x00, 0x08, 0x00, 0x08, 0xFE, 0xBD, 0xF0, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0x30, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE,
+    0x70, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0xB0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0xFE, 0xBE, 0xF0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBF, 0x30, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBF, 0x70, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0xFE, 0xBF, 0xB0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x00, 0x00, 0x01, 0x68, 0x00, 0x02,
+    0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x01, 0x05, 0x47, 0x35, 0x36, 0x35, 0x00, 0x10, 0x00, 0x10,
+    0xB0, 0x88, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0xFE, 0x82, 0x50, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0xFE, 0x82, 0x90, 0x7A, 0x7A, 0xC0, 0x8B, 0xAC, 0xC6, 0xB5, 0xF4, 0x7A, 0x7A,
+    0x7A, 0xFE, 0x82, 0xD0, 0x7A, 0x7A, 0xC0, 0x31, 0xC6, 0xB7, 0xD2, 0x7A, 0x7A, 0x7A, 0xFE, 0x83,
+    0x10, 0x7A, 0x7A, 0xC0, 0x31, 0xC6, 0xB9, 0xB0, 0x7A, 0x7A, 0x7A, 0xFE, 0x83, 0x50, 0x7A, 0x7A,
+    0xC0, 0x31, 0xC6, 0xFE, 0xDB, 0x50, 0x7A, 0x7A, 0x7A, 0xFE, 0x83, 0x90, 0x7A, 0x7A, 0xC0, 0x31,
+    0xC6, 0xFE, 0xDB, 0x90, 0x7A, 0x7A, 0x7A, 0xFE, 0x83, 0xD0, 0x7A, 0x7A, 0xC0, 0x31, 0xC6, 0xFE,
+    0xDB, 0xD0, 0x7A, 0x7A, 0x7A, 0xFE, 0x84, 0x10, 0x7A, 0x7A, 0xC0, 0x31, 0xC6, 0xFE, 0xDC, 0x10,
+    0x7A, 0x7A, 0x7A, 0xFE, 0x84, 0x50, 0x7A, 0x7A, 0xC0, 0x31, 0xC6, 0xFE, 0xDC, 0x50, 0x7A, 0x7A,
+    0x7A, 0xFE, 0x84, 0x90, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0xFE, 0x84, 0xD0, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x85, 0x10, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x85, 0x50, 0x7A, 0x7A, 0xC0, 0x7A, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x85, 0x70, 0x7A, 0x7A, 0xC0, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0x85, 0xB0, 0x7A, 0x7A,
+    0xC0, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x00, 0x18, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x51, 0x47, 0x35, 0x36, 0x35, 0x00, 0x08, 0x00, 0x08, 0xFE, 0xBD, 0xF0,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0x30, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+    0x7A, 0xFE, 0xBE, 0x70, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0xB0, 0x7A, 0x7A,
+    0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xFE, 0xBE, 0xF0, 0x7A, 0x7A, 0x7A, 0xA9, 0x5F, 0xC2, 0xFE, 0xBF,
+    0x30, 0x7A, 0x7A, 0x7A, 0x00, 0xC2, 0xFE, 0xBF, 0x70, 0x7A, 0x7A, 0x7A, 0x00, 0xC2, 0xFE, 0xBF,
+    0xB0, 0x7A, 0x7A, 0x7A, 0x00, 0xC2,
+};
@@ -0,0 +1,535 @@
+// RGB565 pixels of test_anim_ref, generated by test/fixtures/make_fixtures.py
+#pragma once
+
+#include <cstdint>
+
+static const uint16_t test_anim_ref[6][1024] = {
+    {
+        0x0010, 0x0810, 0x1010, 0x1810, 0x2010, 0x2810, 0x3010, 0x3810, 0x4010, 0x4810, 0x5010, 0x5810,
+        0x6010, 0x6810, 0x7010, 0x7810, 0x8010, 0x8810, 0x9010, 0x9010, 0x9810, 0xA010, 0xA810, 0xB010,
+        0xB810, 0xC010, 0xC810, 0xD010, 0xD810, 0xE010, 0xE810, 0xF010, 0x0050, 0x0850, 0x1050, 0x1850,
+        0x2050, 0x2850, 0x3050, 0x3850, 0x4050, 0x4850, 0x5050, 0x5850, 0x6050, 0x6850, 0x7050, 0x7850,
+        0x8050, 0x8850, 0x9050, 0x9050, 0x9850, 0xA050, 0xA850, 0xB050, 0xB850, 0xC050, 0xC850, 0xD050,
+        0xD850, 0xE050, 0xE850, 0xF050, 0x0090, 0x0890, 0x1090, 0x1890, 0x2090, 0x2890, 0x3090, 0x3890,
+        0x4090, 0x4890, 0x5090, 0x5890, 0x6090, 0x6890, 0x7090, 0x7890, 0x8090, 0x8890, 0x9090, 0x9090,
+        0x9890, 0xA090, 0xA890, 0xB090, 0xB890, 0xC090, 0xC890, 0xD090, 0xD890, 0xE090, 0xE890, 0xF090,
+        0x00D0, 0x08D0, 0x10D0, 0x18D0, 0x20D0, 0x28D0, 0x30D0, 0x38D0, 0x40D0, 0x48D0, 0x50D0, 0x58D0,
+        0x60D0, 0x68D0, 0x70D0, 0x78D0, 0x80D0, 0x88D0, 0x90D0, 0x90D0, 0x98D0, 0xA0D0, 0xA8D0, 0xB0D0,
+        0xB8D0, 0xC0D0, 0xC8D0, 0xD0D0, 0xD8D0, 0xE0D0, 0xE8D0, 0xF0D0, 0x0110, 0x0910, 0x1110, 0x1910,
+        0x2110, 0x2910, 0x3110, 0x3910, 0x4110, 0x4910, 0x5110, 0x5910, 0x6110, 0x6910, 0x7110, 0x7910,
+        0x8110, 0x8910, 0x9110, 0x9110, 0x9910, 0xA110, 0xA910, 0xB110, 0xB910, 0xC110, 0xC910, 0xD110,
+        0xD910, 0xE110, 0xE910, 0xF110, 0x0150, 0x0950, 0x1150, 0x1950, 0x2150, 0x2950, 0x3150, 0x3950,
+        0x4150, 0x4950, 0x5150, 0x5950, 0x6150, 0x6950, 0x7150, 0x7950, 0x8150, 0x8950, 0x9150, 0x9150,
+        0x9950, 0xA150, 0xA950, 0xB150, 0xB950, 0xC150, 0xC950, 0xD150, 0xD950, 0xE150, 0xE950, 0xF150,
+        0x0190, 0x0990, 0x1190, 0x1990, 0x2190, 0x2990, 0x3190, 0x3990, 0x4190, 0x4990, 0x5190, 0x5990,
+        0x6190, 0x6990, 0x7190, 0x7990, 0x8190, 0x8990, 0x9190, 0x9190, 0x9990, 0xA190, 0xA990, 0xB190,
+        0xB990, 0xC190, 0xC990, 0xD190, 0xD990, 0xE190, 0xE990, 0xF190, 0x01D0, 0x09D0, 0x11D0, 0x19D0,
+        0x21D0, 0x29D0, 0x31D0, 0x39D0, 0x41D0, 0x49D0, 0x51D0, 0x59D0, 0x61D0, 0x69D0, 0x71D0, 0x79D0,
+        0x81D0, 0x89D0, 0x91D0, 0x91D0, 0x99D0, 0xA1D0, 0xA9D0, 0xB1D0, 0xB9D0, 0xC1D0, 0xC9D0, 0xD1D0,
+        0xD9D0, 0xE1D0, 0xE9D0, 0xF1D0, 0x0210, 0x0A10, 0x1210, 0x1A10, 0x2210, 0x2A10, 0x3210, 0x3A10,
+        0x4210, 0x4A10, 0x5210, 0x5A10, 0x6210, 0x6A10, 0x7210, 0x7A10, 0x8210, 0x8A10, 0x9210, 0x9210,
+        0x9A10, 0xA210, 0xAA10, 0xB210, 0xBA10, 0xC210, 0xCA10, 0xD210, 0xDA10, 0xE210, 0xEA10, 0xF210,
+        0x0250, 0x0A50, 0x1250, 0x1A50, 0x2250, 0x2A50, 0x3250, 0x3A50, 0x4250, 0x4A50, 0x5250, 0x5A50,
+        0x6250, 0x6A50, 0x7250, 0x7A50, 0x8250, 0x8A50, 0x9250, 0x9250, 0x9A50, 0xA250, 0xAA50, 0xB250,
+        0xBA50, 0xC250, 0xCA50, 0xD250, 0xDA50, 0xE250, 0xEA50, 0xF250, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4290, 0x4A90, 0x5290, 0x5A90, 0x6290, 0x6A90, 0x7290, 0x7A90,
+        0x8290, 0x8A90, 0x9290, 0x9290, 0x9A90, 0xA290, 0xAA90, 0xB290, 0xBA90, 0xC290, 0xCA90, 0xD290,
+        0xDA90, 0xE290, 0xEA90, 0xF290, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x42D0, 0x4AD0, 0x52D0, 0x5AD0, 0x62D0, 0x6AD0, 0x72D0, 0x7AD0, 0x82D0, 0x8AD0, 0x92D0, 0x92D0,
+        0x9AD0, 0xA2D0, 0xAAD0, 0xB2D0, 0xBAD0, 0xC2D0, 0xCAD0, 0xD2D0, 0xDAD0, 0xE2D0, 0xEAD0, 0xF2D0,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4310, 0x4B10, 0x5310, 0x5B10,
+        0x6310, 0x6B10, 0x7310, 0x7B10, 0x8310, 0x8B10, 0x9310, 0x9310, 0x9B10, 0xA310, 0xAB10, 0xB310,
+        0xBB10, 0xC310, 0xCB10, 0xD310, 0xDB10, 0xE310, 0xEB10, 0xF310, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4350, 0x4B50, 0x5350, 0x5B50, 0x6350, 0x6B50, 0x7350, 0x7B50,
+        0x8350, 0x8B50, 0x9350, 0x9350, 0x9B50, 0xA350, 0xAB50, 0xB350, 0xBB50, 0xC350, 0xCB50, 0xD350,
+        0xDB50, 0xE350, 0xEB50, 0xF350, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x4390, 0x4B90, 0x5390, 0x5B90, 0x6390, 0x6B90, 0x7390, 0x7B90, 0x8390, 0x8B90, 0x9390, 0x9390,
+        0x9B90, 0xA390, 0xAB90, 0xB390, 0xBB90, 0xC390, 0xCB90, 0xD390, 0xDB90, 0xE390, 0xEB90, 0xF390,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x43D0, 0x4BD0, 0x53D0, 0x5BD0,
+        0x63D0, 0x6BD0, 0x73D0, 0x7BD0, 0x83D0, 0x8BD0, 0x93D0, 0x93D0, 0x9BD0, 0xA3D0, 0xABD0, 0xB3D0,
+        0xBBD0, 0xC3D0, 0xCBD0, 0xD3D0, 0xDBD0, 0xE3D0, 0xEBD0, 0xF3D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4410, 0x4C10, 0x5410, 0x5C10, 0x6410, 0x6C10, 0x7410, 0x7C10,
+        0x8410, 0x8C10, 0x9410, 0x9410, 0x9C10, 0xA410, 0xAC10, 0xB410, 0xBC10, 0xC410, 0xCC10, 0xD410,
+        0xDC10, 0xE410, 0xEC10, 0xF410, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x4450, 0x4C50, 0x5450, 0x5C50, 0x6450, 0x6C50, 0x7450, 0x7C50, 0x8450, 0x8C50, 0x9450, 0x9450,
+        0x9C50, 0xA450, 0xAC50, 0xB450, 0xBC50, 0xC450, 0xCC50, 0xD450, 0xDC50, 0xE450, 0xEC50, 0xF450,
+        0x0490, 0x0C90, 0x1490, 0x1C90, 0x2490, 0x2C90, 0x3490, 0x3C90, 0x4490, 0x4C90, 0x5490, 0x5C90,
+        0x6490, 0x6C90, 0x7490, 0x7C90, 0x8490, 0x8C90, 0x9490, 0x9490, 0x9C90, 0xA490, 0xAC90, 0xB490,
+        0xBC90, 0xC490, 0xCC90, 0xD490, 0xDC90, 0xE490, 0xEC90, 0xF490, 0x04D0, 0x0CD0, 0x14D0, 0x1CD0,
+        0x24D0, 0x2CD0, 0x34D0, 0x3CD0, 0x44D0, 0x4CD0, 0x54D0, 0x5CD0, 0x64D0, 0x6CD0, 0x74D0, 0x7CD0,
+        0x84D0, 0x8CD0, 0x94D0, 0x94D0, 0x9CD0, 0xA4D0, 0xACD0, 0xB4D0, 0xBCD0, 0xC4D0, 0xCCD0, 0xD4D0,
+        0xDCD0, 0xE4D0, 0xECD0, 0xF4D0, 0x0510, 0x0D10, 0x1510, 0x1D10, 0x2510, 0x2D10, 0x3510, 0x3D10,
+        0x4510, 0x4D10, 0x5510, 0x5D10, 0x6510, 0x6D10, 0x7510, 0x7D10, 0x8510, 0x8D10, 0x9510, 0x9510,
+        0x9D10, 0xA510, 0xAD10, 0xB510, 0xBD10, 0xC510, 0xCD10, 0xD510, 0xDD10, 0xE510, 0xED10, 0xF510,
+        0x0550, 0x0D50, 0x1550, 0x1D50, 0x2550, 0x2D50, 0x3550, 0x3D50, 0x4550, 0x4D50, 0x5550, 0x5D50,
+        0x6550, 0x6D50, 0x7550, 0x7D50, 0x8550, 0x8D50, 0x9550, 0x9550, 0x9D50, 0xA550, 0xAD50, 0xB550,
+        0xBD50, 0xC550, 0xCD50, 0xD550, 0xDD50, 0xE550, 0xED50, 0xF550, 0x0570, 0x0D70, 0x1570, 0x1D70,
+        0x2570, 0x2D70, 0x3570, 0x3D70, 0x4570, 0x4D70, 0x5570, 0x5D70, 0x6570, 0x6D70, 0x7570, 0x7D70,
+        0x8570, 0x8D70, 0x9570, 0x9570, 0x9D70, 0xA570, 0xAD70, 0xB570, 0xBD70, 0xC570, 0xCD70, 0xD570,
+        0xDD70, 0xE570, 0xED70, 0xF570, 0x05B0, 0x0DB0, 0x15B0, 0x1DB0, 0x25B0, 0x2DB0, 0x35B0, 0x3DB0,
+        0x45B0, 0x4DB0, 0x55B0, 0x5DB0, 0x65B0, 0x6DB0, 0x75B0, 0x7DB0, 0x85B0, 0x8DB0, 0x95B0, 0x95B0,
+        0x9DB0, 0xA5B0, 0xADB0, 0xB5B0, 0xBDB0, 0xC5B0, 0xCDB0, 0xD5B0, 0xDDB0, 0xE5B0, 0xEDB0, 0xF5B0,
+        0x05F0, 0x0DF0, 0x15F0, 0x1DF0, 0x25F0, 0x2DF0, 0x35F0, 0x3DF0, 0x45F0, 0x4DF0, 0x55F0, 0x5DF0,
+        0x65F0, 0x6DF0, 0x75F0, 0x7DF0, 0x85F0, 0x8DF0, 0x95F0, 0x95F0, 0x9DF0, 0xA5F0, 0xADF0, 0xB5F0,
+        0xBDF0, 0xC5F0, 0xCDF0, 0xD5F0, 0xDDF0, 0xE5F0, 0xEDF0, 0xF5F0, 0x0630, 0x0E30, 0x1630, 0x1E30,
+        0x2630, 0x2E30, 0x3630, 0x3E30, 0x4630, 0x4E30, 0x5630, 0x5E30, 0x6630, 0x6E30, 0x7630, 0x7E30,
+        0x8630, 0x8E30, 0x9630, 0x9630, 0x9E30, 0xA630, 0xAE30, 0xB630, 0xBE30, 0xC630, 0xCE30, 0xD630,
+        0xDE30, 0xE630, 0xEE30, 0xF630, 0x0670, 0x0E70, 0x1670, 0x1E70, 0x2670, 0x2E70, 0x3670, 0x3E70,
+        0x4670, 0x4E70, 0x5670, 0x5E70, 0x6670, 0x6E70, 0x7670, 0x7E70, 0x8670, 0x8E70, 0x9670, 0x9670,
+        0x9E70, 0xA670, 0xAE70, 0xB670, 0xBE70, 0xC670, 0xCE70, 0xD670, 0xDE70, 0xE670, 0xEE70, 0xF670,
+        0x06B0, 0x0EB0, 0x16B0, 0x1EB0, 0x26B0, 0x2EB0, 0x36B0, 0x3EB0, 0x46B0, 0x4EB0, 0x56B0, 0x5EB0,
+        0x66B0, 0x6EB0, 0x76B0, 0x7EB0, 0x86B0, 0x8EB0, 0x96B0, 0x96B0, 0x9EB0, 0xA6B0, 0xAEB0, 0xB6B0,
+        0xBEB0, 0xC6B0, 0xCEB0, 0xD6B0, 0xDEB0, 0xE6B0, 0xEEB0, 0xF6B0, 0x06F0, 0x0EF0, 0x16F0, 0x1EF0,
+        0x26F0, 0x2EF0, 0x36F0, 0x3EF0, 0x46F0, 0x4EF0, 0x56F0, 0x5EF0, 0x66F0, 0x6EF0, 0x76F0, 0x7EF0,
+        0x86F0, 0x8EF0, 0x96F0, 0x96F0, 0x9EF0, 0xA6F0, 0xAEF0, 0xB6F0, 0xBEF0, 0xC6F0, 0xCEF0, 0xD6F0,
+        0xDEF0, 0xE6F0, 0xEEF0, 0xF6F0, 0x0730, 0x0F30, 0x1730, 0x1F30, 0x2730, 0x2F30, 0x3730, 0x3F30,
+        0x4730, 0x4F30, 0x5730, 0x5F30, 0x6730, 0x6F30, 0x7730, 0x7F30, 0x8730, 0x8F30, 0x9730, 0x9730,
+        0x9F30, 0xA730, 0xAF30, 0xB730, 0xBF30, 0xC730, 0xCF30, 0xD730, 0xDF30, 0xE730, 0xEF30, 0xF730,
+        0x0770, 0x0F70, 0x1770, 0x1F70, 0x2770, 0x2F70, 0x3770, 0x3F70, 0x4770, 0x4F70, 0x5770, 0x5F70,
+        0x6770, 0x6F70, 0x7770, 0x7F70, 0x8770, 0x8F70, 0x9770, 0x9770, 0x9F70, 0xA770, 0xAF70, 0xB770,
+        0xBF70, 0xC770, 0xCF70, 0xD770, 0xDF70, 0xE770, 0xEF70, 0xF770, 0x07B0, 0x0FB0, 0x17B0, 0x1FB0,
+        0x27B0, 0x2FB0, 0x37B0, 0x3FB0, 0x47B0, 0x4FB0, 0x57B0, 0x5FB0, 0x67B0, 0x6FB0, 0x77B0, 0x7FB0,
+        0x87B0, 0x8FB0, 0x97B0, 0x97B0, 0x9FB0, 0xA7B0, 0xAFB0, 0xB7B0, 0xBFB0, 0xC7B0, 0xCFB0, 0xD7B0,
+        0xDFB0, 0xE7B0, 0xEFB0, 0xF7B0,
+    },
+    {
+        0x0010, 0x0810, 0x1010, 0x1810, 0x2010, 0x2810, 0x3010, 0x3810, 0x4010, 0x4810, 0x5010, 0x5810,
+        0x6010, 0x6810, 0x7010, 0x7810, 0x8010, 0x8810, 0x9010, 0x9010, 0x9810, 0xA010, 0xA810, 0xB010,
+        0xB810, 0xC010, 0xC810, 0xD010, 0xD810, 0xE010, 0xE810, 0xF010, 0x0050, 0x0850, 0x1050, 0x1850,
+        0x2050, 0x2850, 0x3050, 0x3850, 0x4050, 0x4850, 0x5050, 0x5850, 0x6050, 0x6850, 0x7050, 0x7850,
+        0x8050, 0x8850, 0x9050, 0x9050, 0x9850, 0xA050, 0xA850, 0xB050, 0xB850, 0xC050, 0xC850, 0xD050,
+        0xD850, 0xE050, 0xE850, 0xF050, 0x0090, 0x0890, 0x1090, 0x1890, 0x2090, 0x2890, 0x3090, 0x3890,
+        0x4090, 0x4890, 0x5090, 0x5890, 0x6090, 0x6890, 0x7090, 0x7890, 0x8090, 0x8890, 0x9090, 0x9090,
+        0x9890, 0xA090, 0xA890, 0xB090, 0xB890, 0xC090, 0xC890, 0xD090, 0xD890, 0xE090, 0xE890, 0xF090,
+        0x00D0, 0x08D0, 0x10D0, 0x18D0, 0x20D0, 0x28D0, 0x30D0, 0x38D0, 0x40D0, 0x48D0, 0x50D0, 0x58D0,
+        0x60D0, 0x68D0, 0x70D0, 0x78D0, 0x80D0, 0x88D0, 0x90D0, 0x90D0, 0x98D0, 0xA0D0, 0xA8D0, 0xB0D0,
+        0xB8D0, 0xC0D0, 0xC8D0, 0xD0D0, 0xD8D0, 0xE0D0, 0xE8D0, 0xF0D0, 0x0110, 0x0910, 0x1110, 0x1910,
+        0x2110, 0x2910, 0x3110, 0x3910, 0x4110, 0x4910, 0x5110, 0x5910, 0x6110, 0x6910, 0x7110, 0x7910,
+        0x8110, 0x8910, 0x9110, 0x9110, 0x9910, 0xA110, 0xA910, 0xB110, 0xB910, 0xC110, 0xC910, 0xD110,
+        0xD910, 0xE110, 0xE910, 0xF110, 0x0150, 0x0950, 0x1150, 0x1950, 0x2150, 0x2950, 0x3150, 0x3950,
+        0x4150, 0x4950, 0x5150, 0x5950, 0x6150, 0x6950, 0x7150, 0x7950, 0x8150, 0x8950, 0x9150, 0x9150,
+        0x9950, 0xA150, 0xA950, 0xB150, 0xB950, 0xC150, 0xC950, 0xD150, 0xD950, 0xE150, 0xE950, 0xF150,
+        0x0190, 0x0990, 0x1190, 0x1990, 0x2190, 0x2990, 0x3190, 0x3990, 0x4190, 0x4990, 0x5190, 0x5990,
+        0x6190, 0x6990, 0x7190, 0x7990, 0x8190, 0x8990, 0x9190, 0x9190, 0x9990, 0xA190, 0xA990, 0xB190,
+        0xB990, 0xC190, 0xC990, 0xD190, 0xD990, 0xE190, 0xE990, 0xF190, 0x01D0, 0x09D0, 0x11D0, 0x19D0,
+        0x21D0, 0x29D0, 0x31D0, 0x39D0, 0x41D0, 0x49D0, 0x51D0, 0x59D0, 0x61D0, 0x69D0, 0x71D0, 0x79D0,
+        0x81D0, 0x89D0, 0x91D0, 0x91D0, 0x99D0, 0xA1D0, 0xA9D0, 0xB1D0, 0xB9D0, 0xC1D0, 0xC9D0, 0xD1D0,
+        0xD9D0, 0xE1D0, 0xE9D0, 0xF1D0, 0x0210, 0x0A10, 0x1210, 0x1A10, 0x2210, 0x2A10, 0x3210, 0x3A10,
+        0x4210, 0x4A10, 0x5210, 0x5A10, 0x6210, 0x6A10, 0x7210, 0x7A10, 0x8210, 0x8A10, 0x9210, 0x9210,
+        0x9A10, 0xA210, 0xAA10, 0xB210, 0xBA10, 0xC210, 0xCA10, 0xD210, 0xDA10, 0xE210, 0xEA10, 0xF210,
+        0x0250, 0x0A50, 0x1250, 0x1A50, 0x2250, 0x2A50, 0x3250, 0x3A50, 0x4250, 0x4A50, 0x5250, 0x5A50,
+        0x6250, 0x6A50, 0x7250, 0x7A50, 0x8250, 0x8A50, 0x9250, 0x9250, 0x9A50, 0xA250, 0xAA50, 0xB250,
+        0xBA50, 0xC250, 0xCA50, 0xD250, 0xDA50, 0xE250, 0xEA50, 0xF250, 0x0290, 0x0A90, 0x1290, 0x1A90,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6290, 0x6A90, 0x7290, 0x7A90,
+        0x8290, 0x8A90, 0x9290, 0x9290, 0x9A90, 0xA290, 0xAA90, 0xB290, 0xBA90, 0xC290, 0xCA90, 0xD290,
+        0xDA90, 0xE290, 0xEA90, 0xF290, 0x02D0, 0x0AD0, 0x12D0, 0x1AD0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62D0, 0x6AD0, 0x72D0, 0x7AD0, 0x82D0, 0x8AD0, 0x92D0, 0x92D0,
+        0x9AD0, 0xA2D0, 0xAAD0, 0xB2D0, 0xBAD0, 0xC2D0, 0xCAD0, 0xD2D0, 0xDAD0, 0xE2D0, 0xEAD0, 0xF2D0,
+        0x0310, 0x0B10, 0x1310, 0x1B10, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x6310, 0x6B10, 0x7310, 0x7B10, 0x8310, 0x8B10, 0x9310, 0x9310, 0x9B10, 0xA310, 0xAB10, 0xB310,
+        0xBB10, 0xC310, 0xCB10, 0xD310, 0xDB10, 0xE310, 0xEB10, 0xF310, 0x0350, 0x0B50, 0x1350, 0x1B50,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6350, 0x6B50, 0x7350, 0x7B50,
+        0x8350, 0x8B50, 0x9350, 0x9350, 0x9B50, 0xA350, 0xAB50, 0xB350, 0xBB50, 0xC350, 0xCB50, 0xD350,
+        0xDB50, 0xE350, 0xEB50, 0xF350, 0x0390, 0x0B90, 0x1390, 0x1B90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6390, 0x6B90, 0x7390, 0x7B90, 0x8390, 0x8B90, 0x9390, 0x9390,
+        0x9B90, 0xA390, 0xAB90, 0xB390, 0xBB90, 0xC390, 0xCB90, 0xD390, 0xDB90, 0xE390, 0xEB90, 0xF390,
+        0x03D0, 0x0BD0, 0x13D0, 0x1BD0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x63D0, 0x6BD0, 0x73D0, 0x7BD0, 0x83D0, 0x8BD0, 0x93D0, 0x93D0, 0x9BD0, 0xA3D0, 0xABD0, 0xB3D0,
+        0xBBD0, 0xC3D0, 0xCBD0, 0xD3D0, 0xDBD0, 0xE3D0, 0xEBD0, 0xF3D0, 0x0410, 0x0C10, 0x1410, 0x1C10,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6410, 0x6C10, 0x7410, 0x7C10,
+        0x8410, 0x8C10, 0x9410, 0x9410, 0x9C10, 0xA410, 0xAC10, 0xB410, 0xBC10, 0xC410, 0xCC10, 0xD410,
+        0xDC10, 0xE410, 0xEC10, 0xF410, 0x0450, 0x0C50, 0x1450, 0x1C50, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6450, 0x6C50, 0x7450, 0x7C50, 0x8450, 0x8C50, 0x9450, 0x9450,
+        0x9C50, 0xA450, 0xAC50, 0xB450, 0xBC50, 0xC450, 0xCC50, 0xD450, 0xDC50, 0xE450, 0xEC50, 0xF450,
+        0x0490, 0x0C90, 0x1490, 0x1C90, 0x2490, 0x2C90, 0x3490, 0x3C90, 0x4490, 0x4C90, 0x5490, 0x5C90,
+        0x6490, 0x6C90, 0x7490, 0x7C90, 0x8490, 0x8C90, 0x9490, 0x9490, 0x9C90, 0xA490, 0xAC90, 0xB490,
+        0xBC90, 0xC490, 0xCC90, 0xD490, 0xDC90, 0xE490, 0xEC90, 0xF490, 0x04D0, 0x0CD0, 0x14D0, 0x1CD0,
+        0x24D0, 0x2CD0, 0x34D0, 0x3CD0, 0x44D0, 0x4CD0, 0x54D0, 0x5CD0, 0x64D0, 0x6CD0, 0x74D0, 0x7CD0,
+        0x84D0, 0x8CD0, 0x94D0, 0x94D0, 0x9CD0, 0xA4D0, 0xACD0, 0xB4D0, 0xBCD0, 0xC4D0, 0xCCD0, 0xD4D0,
+        0xDCD0, 0xE4D0, 0xECD0, 0xF4D0, 0x0510, 0x0D10, 0x1510, 0x1D10, 0x2510, 0x2D10, 0x3510, 0x3D10,
+        0x4510, 0x4D10, 0x5510, 0x5D10, 0x6510, 0x6D10, 0x7510, 0x7D10, 0x8510, 0x8D10, 0x9510, 0x9510,
+        0x9D10, 0xA510, 0xAD10, 0xB510, 0xBD10, 0xC510, 0xCD10, 0xD510, 0xDD10, 0xE510, 0xED10, 0xF510,
+        0x0550, 0x0D50, 0x1550, 0x1D50, 0x2550, 0x2D50, 0x3550, 0x3D50, 0x4550, 0x4D50, 0x5550, 0x5D50,
+        0x6550, 0x6D50, 0x7550, 0x7D50, 0x8550, 0x8D50, 0x9550, 0x9550, 0x9D50, 0xA550, 0xAD50, 0xB550,
+        0xBD50, 0xC550, 0xCD50, 0xD550, 0xDD50, 0xE550, 0xED50, 0xF550, 0x0570, 0x0D70, 0x1570, 0x1D70,
+        0x2570, 0x2D70, 0x3570, 0x3D70, 0x4570, 0x4D70, 0x5570, 0x5D70, 0x6570, 0x6D70, 0x7570, 0x7D70,
+        0x8570, 0x8D70, 0x9570, 0x9570, 0x9D70, 0xA570, 0xAD70, 0xB570, 0xBD70, 0xC570, 0xCD70, 0xD570,
+        0xDD70, 0xE570, 0xED70, 0xF570, 0x05B0, 0x0DB0, 0x15B0, 0x1DB0, 0x25B0, 0x2DB0, 0x35B0, 0x3DB0,
+        0x45B0, 0x4DB0, 0x55B0, 0x5DB0, 0x65B0, 0x6DB0, 0x75B0, 0x7DB0, 0x85B0, 0x8DB0, 0x95B0, 0x95B0,
+        0x9DB0, 0xA5B0, 0xADB0, 0xB5B0, 0xBDB0, 0xC5B0, 0xCDB0, 0xD5B0, 0xDDB0, 0xE5B0, 0xEDB0, 0xF5B0,
+        0x05F0, 0x0DF0, 0x15F0, 0x1DF0, 0x25F0, 0x2DF0, 0x35F0, 0x3DF0, 0x45F0, 0x4DF0, 0x55F0, 0x5DF0,
+        0x65F0, 0x6DF0, 0x75F0, 0x7DF0, 0x85F0, 0x8DF0, 0x95F0, 0x95F0, 0x9DF0, 0xA5F0, 0xADF0, 0xB5F0,
+        0xBDF0, 0xC5F0, 0xCDF0, 0xD5F0, 0xDDF0, 0xE5F0, 0xEDF0, 0xF5F0, 0x0630, 0x0E30, 0x1630, 0x1E30,
+        0x2630, 0x2E30, 0x3630, 0x3E30, 0x4630, 0x4E30, 0x5630, 0x5E30, 0x6630, 0x6E30, 0x7630, 0x7E30,
+        0x8630, 0x8E30, 0x9630, 0x9630, 0x9E30, 0xA630, 0xAE30, 0xB630, 0xBE30, 0xC630, 0xCE30, 0xD630,
+        0xDE30, 0xE630, 0xEE30, 0xF630, 0x0670, 0x0E70, 0x1670, 0x1E70, 0x2670, 0x2E70, 0x3670, 0x3E70,
+        0x4670, 0x4E70, 0x5670, 0x5E70, 0x6670, 0x6E70, 0x7670, 0x7E70, 0x8670, 0x8E70, 0x9670, 0x9670,
+        0x9E70, 0xA670, 0xAE70, 0xB670, 0xBE70, 0xC670, 0xCE70, 0xD670, 0xDE70, 0xE670, 0xEE70, 0xF670,
+        0x06B0, 0x0EB0, 0x16B0, 0x1EB0, 0x26B0, 0x2EB0, 0x36B0, 0x3EB0, 0x46B0, 0x4EB0, 0x56B0, 0x5EB0,
+        0x66B0, 0x6EB0, 0x76B0, 0x7EB0, 0x86B0, 0x8EB0, 0x96B0, 0x96B0, 0x9EB0, 0xA6B0, 0xAEB0, 0xB6B0,
+        0xBEB0, 0xC6B0, 0xCEB0, 0xD6B0, 0xDEB0, 0xE6B0, 0xEEB0, 0xF6B0, 0x06F0, 0x0EF0, 0x16F0, 0x1EF0,
+        0x26F0, 0x2EF0, 0x36F0, 0x3EF0, 0x46F0, 0x4EF0, 0x56F0, 0x5EF0, 0x66F0, 0x6EF0, 0x76F0, 0x7EF0,
+        0x86F0, 0x8EF0, 0x96F0, 0x96F0, 0x9EF0, 0xA6F0, 0xAEF0, 0xB6F0, 0xBEF0, 0xC6F0, 0xCEF0, 0xD6F0,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0730, 0x0F30, 0x1730, 0x1F30, 0x2730, 0x2F30, 0x3730, 0x3F30,
+        0x4730, 0x4F30, 0x5730, 0x5F30, 0x6730, 0x6F30, 0x7730, 0x7F30, 0x8730, 0x8F30, 0x9730, 0x9730,
+        0x9F30, 0xA730, 0xAF30, 0xB730, 0xBF30, 0xC730, 0xCF30, 0xD730, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0770, 0x0F70, 0x1770, 0x1F70, 0x2770, 0x2F70, 0x3770, 0x3F70, 0x4770, 0x4F70, 0x5770, 0x5F70,
+        0x6770, 0x6F70, 0x7770, 0x7F70, 0x8770, 0x8F70, 0x9770, 0x9770, 0x9F70, 0xA770, 0xAF70, 0xB770,
+        0xBF70, 0xC770, 0xCF70, 0xD770, 0x0000, 0x0000, 0x0000, 0x0000, 0x07B0, 0x0FB0, 0x17B0, 0x1FB0,
+        0x27B0, 0x2FB0, 0x37B0, 0x3FB0, 0x47B0, 0x4FB0, 0x57B0, 0x5FB0, 0x67B0, 0x6FB0, 0x77B0, 0x7FB0,
+        0x87B0, 0x8FB0, 0x97B0, 0x97B0, 0x9FB0, 0xA7B0, 0xAFB0, 0xB7B0, 0xBFB0, 0xC7B0, 0xCFB0, 0xD7B0,
+        0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0010, 0x0810, 0x1010, 0x1810, 0x2010, 0x2810, 0x3010, 0x3810, 0x4010, 0x4810, 0x5010, 0x5810,
+        0x6010, 0x6810, 0x7010, 0x7810, 0x8010, 0x8810, 0x9010, 0x9010, 0x9810, 0xA010, 0xA810, 0xB010,
+        0xB810, 0xC010, 0xC810, 0xD010, 0xD810, 0xE010, 0xE810, 0xF010, 0x0050, 0x0850, 0x1050, 0x1850,
+        0x2050, 0x2850, 0x3050, 0x3850, 0x4050, 0x4850, 0x5050, 0x5850, 0x6050, 0x6850, 0x7050, 0x7850,
+        0x8050, 0x8850, 0x9050, 0x9050, 0x9850, 0xA050, 0xA850, 0xB050, 0xB850, 0xC050, 0xC850, 0xD050,
+        0xD850, 0xE050, 0xE850, 0xF050, 0x0090, 0x0890, 0x1090, 0x1890, 0x2090, 0x2890, 0x3090, 0x3890,
+        0x4090, 0x4890, 0x5090, 0x5890, 0x6090, 0x6890, 0x7090, 0x7890, 0x8090, 0x8890, 0x9090, 0x9090,
+        0x9890, 0xA090, 0xA890, 0xB090, 0xB890, 0xC090, 0xC890, 0xD090, 0xD890, 0xE090, 0xE890, 0xF090,
+        0x00D0, 0x08D0, 0x10D0, 0x18D0, 0x20D0, 0x28D0, 0x30D0, 0x38D0, 0x40D0, 0x48D0, 0x50D0, 0x58D0,
+        0x60D0, 0x68D0, 0x70D0, 0x78D0, 0x80D0, 0x88D0, 0x90D0, 0x90D0, 0x98D0, 0xA0D0, 0xA8D0, 0xB0D0,
+        0xB8D0, 0xC0D0, 0xC8D0, 0xD0D0, 0xD8D0, 0xE0D0, 0xE8D0, 0xF0D0, 0x0110, 0x0910, 0x1110, 0x1910,
+        0x2110, 0x2910, 0x3110, 0x3910, 0x4110, 0x4910, 0x5110, 0x5910, 0x6110, 0x6910, 0x7110, 0x7910,
+        0x8110, 0x8910, 0x9110, 0x9110, 0x9910, 0xA110, 0xA910, 0xB110, 0xB910, 0xC110, 0xC910, 0xD110,
+        0xD910, 0xE110, 0xE910, 0xF110, 0x0150, 0x0950, 0x1150, 0x1950, 0x2150, 0x2950, 0x3150, 0x3950,
+        0x4150, 0x4950, 0x5150, 0x5950, 0x6150, 0x6950, 0x7150, 0x7950, 0x8150, 0x8950, 0x9150, 0x9150,
+        0x9950, 0xA150, 0xA950, 0xB150, 0xB950, 0xC150, 0xC950, 0xD150, 0xD950, 0xE150, 0xE950, 0xF150,
+        0x0190, 0x0990, 0x1190, 0x1990, 0x2190, 0x2990, 0x3190, 0x3990, 0x4190, 0x4990, 0x5190, 0x5990,
+        0x6190, 0x6990, 0x7190, 0x7990, 0x8190, 0x8990, 0x9190, 0x9190, 0x9990, 0xA190, 0xA990, 0xB190,
+        0xB990, 0xC190, 0xC990, 0xD190, 0xD990, 0xE190, 0xE990, 0xF190, 0x01D0, 0x09D0, 0x11D0, 0x19D0,
+        0x21D0, 0x29D0, 0x31D0, 0x39D0, 0x41D0, 0x49D0, 0x51D0, 0x59D0, 0x61D0, 0x69D0, 0x71D0, 0x79D0,
+        0x81D0, 0x89D0, 0x91D0, 0x91D0, 0x99D0, 0xA1D0, 0xA9D0, 0xB1D0, 0xB9D0, 0xC1D0, 0xC9D0, 0xD1D0,
+        0xD9D0, 0xE1D0, 0xE9D0, 0xF1D0, 0x0210, 0x0A10, 0x1210, 0x1A10, 0x2210, 0x2A10, 0x3210, 0x3A10,
+        0x4210, 0x4A10, 0x5210, 0x5A10, 0x6210, 0x6A10, 0x7210, 0x7A10, 0x8210, 0x8A10, 0x9210, 0x9210,
+        0x9A10, 0xA210, 0xAA10, 0xB210, 0xBA10, 0xC210, 0xCA10, 0xD210, 0xDA10, 0xE210, 0xEA10, 0xF210,
+        0x0250, 0x0A50, 0x1250, 0x1A50, 0x2250, 0x2A50, 0x3250, 0x3A50, 0x4250, 0x4A50, 0x5250, 0x5A50,
+        0x6250, 0x6A50, 0x7250, 0x7A50, 0x8250, 0x8A50, 0x9250, 0x9250, 0x9A50, 0xA250, 0xAA50, 0xB250,
+        0xBA50, 0xC250, 0xCA50, 0xD250, 0xDA50, 0xE250, 0xEA50, 0xF250, 0x0290, 0x0A90, 0x1290, 0x1A90,
+        0x2290, 0x2A90, 0x3290, 0x3A90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x8290, 0x8A90, 0x9290, 0x9290, 0x9A90, 0xA290, 0xAA90, 0xB290, 0xBA90, 0xC290, 0xCA90, 0xD290,
+        0xDA90, 0xE290, 0xEA90, 0xF290, 0x02D0, 0x0AD0, 0x12D0, 0x1AD0, 0x22D0, 0x2AD0, 0x32D0, 0x3AD0,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x82D0, 0x8AD0, 0x92D0, 0x92D0,
+        0x9AD0, 0xA2D0, 0xAAD0, 0xB2D0, 0xBAD0, 0xC2D0, 0xCAD0, 0xD2D0, 0xDAD0, 0xE2D0, 0xEAD0, 0xF2D0,
+        0x0310, 0x0B10, 0x1310, 0x1B10, 0x2310, 0x2B10, 0x3310, 0x3B10, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8310, 0x8B10, 0x9310, 0x9310, 0x9B10, 0xA310, 0xAB10, 0xB310,
+        0xBB10, 0xC310, 0xCB10, 0xD310, 0xDB10, 0xE310, 0xEB10, 0xF310, 0x0350, 0x0B50, 0x1350, 0x1B50,
+        0x2350, 0x2B50, 0x3350, 0x3B50, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x8350, 0x8B50, 0x9350, 0x9350, 0x9B50, 0xA350, 0xAB50, 0xB350, 0xBB50, 0xC350, 0xCB50, 0xD350,
+        0xDB50, 0xE350, 0xEB50, 0xF350, 0x0390, 0x0B90, 0x1390, 0x1B90, 0x2390, 0x2B90, 0x3390, 0x3B90,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8390, 0x8B90, 0x9390, 0x9390,
+        0x9B90, 0xA390, 0xAB90, 0xB390, 0xBB90, 0xC390, 0xCB90, 0xD390, 0xDB90, 0xE390, 0xEB90, 0xF390,
+        0x03D0, 0x0BD0, 0x13D0, 0x1BD0, 0x23D0, 0x2BD0, 0x33D0, 0x3BD0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x83D0, 0x8BD0, 0x93D0, 0x93D0, 0x9BD0, 0xA3D0, 0xABD0, 0xB3D0,
+        0xBBD0, 0xC3D0, 0xCBD0, 0xD3D0, 0xDBD0, 0xE3D0, 0xEBD0, 0xF3D0, 0x0410, 0x0C10, 0x1410, 0x1C10,
+        0x2410, 0x2C10, 0x3410, 0x3C10, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x8410, 0x8C10, 0x9410, 0x9410, 0x9C10, 0xA410, 0xAC10, 0xB410, 0xBC10, 0xC410, 0xCC10, 0xD410,
+        0xDC10, 0xE410, 0xEC10, 0xF410, 0x0450, 0x0C50, 0x1450, 0x1C50, 0x2450, 0x2C50, 0x3450, 0x3C50,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8450, 0x8C50, 0x9450, 0x9450,
+        0x9C50, 0xA450, 0xAC50, 0xB450, 0xBC50, 0xC450, 0xCC50, 0xD450, 0xDC50, 0xE450, 0xEC50, 0xF450,
+        0x0490, 0x0C90, 0x1490, 0x1C90, 0x2490, 0x2C90, 0x3490, 0x3C90, 0x4490, 0x4C90, 0x5490, 0x5C90,
+        0x6490, 0x6C90, 0x7490, 0x7C90, 0x8490, 0x8C90, 0x9490, 0x9490, 0x9C90, 0xA490, 0xAC90, 0xB490,
+        0xBC90, 0xC490, 0xCC90, 0xD490, 0xDC90, 0xE490, 0xEC90, 0xF490, 0x04D0, 0x0CD0, 0x14D0, 0x1CD0,
+        0x24D0, 0x2CD0, 0x34D0, 0x3CD0, 0x44D0, 0x4CD0, 0x54D0, 0x5CD0, 0x64D0, 0x6CD0, 0x74D0, 0x7CD0,
+        0x84D0, 0x8CD0, 0x94D0, 0x94D0, 0x9CD0, 0xA4D0, 0xACD0, 0xB4D0, 0xBCD0, 0xC4D0, 0xCCD0, 0xD4D0,
+        0xDCD0, 0xE4D0, 0xECD0, 0xF4D0, 0x0510, 0x0D10, 0x1510, 0x1D10, 0x2510, 0x2D10, 0x3510, 0x3D10,
+        0x4510, 0x4D10, 0x5510, 0x5D10, 0x6510, 0x6D10, 0x7510, 0x7D10, 0x8510, 0x8D10, 0x9510, 0x9510,
+        0x9D10, 0xA510, 0xAD10, 0xB510, 0xBD10, 0xC510, 0xCD10, 0xD510, 0xDD10, 0xE510, 0xED10, 0xF510,
+        0x0550, 0x0D50, 0x1550, 0x1D50, 0x2550, 0x2D50, 0x3550, 0x3D50, 0x4550, 0x4D50, 0x5550, 0x5D50,
+        0x6550, 0x6D50, 0x7550, 0x7D50, 0x8550, 0x8D50, 0x9550, 0x9550, 0x9D50, 0xA550, 0xAD50, 0xB550,
+        0xBD50, 0xC550, 0xCD50, 0xD550, 0xDD50, 0xE550, 0xED50, 0xF550, 0x0570, 0x0D70, 0x1570, 0x1D70,
+        0x2570, 0x2D70, 0x3570, 0x3D70, 0x4570, 0x4D70, 0x5570, 0x5D70, 0x6570, 0x6D70, 0x7570, 0x7D70,
+        0x8570, 0x8D70, 0x9570, 0x9570, 0x9D70, 0xA570, 0xAD70, 0xB570, 0xBD70, 0xC570, 0xCD70, 0xD570,
+        0xDD70, 0xE570, 0xED70, 0xF570, 0x05B0, 0x0DB0, 0x15B0, 0x1DB0, 0x25B0, 0x2DB0, 0x35B0, 0x3DB0,
+        0x45B0, 0x4DB0, 0x55B0, 0x5DB0, 0x65B0, 0x6DB0, 0x75B0, 0x7DB0, 0x85B0, 0x8DB0, 0x95B0, 0x95B0,
+        0x9DB0, 0xA5B0, 0xADB0, 0xB5B0, 0xBDB0, 0xC5B0, 0xCDB0, 0xD5B0, 0xDDB0, 0xE5B0, 0xEDB0, 0xF5B0,
+        0x05F0, 0x0DF0, 0x15F0, 0x1DF0, 0x25F0, 0x2DF0, 0x35F0, 0x3DF0, 0x45F0, 0x4DF0, 0x55F0, 0x5DF0,
+        0x65F0, 0x6DF0, 0x75F0, 0x7DF0, 0x85F0, 0x8DF0, 0x95F0, 0x95F0, 0x9DF0, 0xA5F0, 0xADF0, 0xB5F0,
+        0xBDF0, 0xC5F0, 0xCDF0, 0xD5F0, 0xDDF0, 0xE5F0, 0xEDF0, 0xF5F0, 0x0630, 0x0E30, 0x1630, 0x1E30,
+        0x2630, 0x2E30, 0x3630, 0x3E30, 0x4630, 0x4E30, 0x5630, 0x5E30, 0x6630, 0x6E30, 0x7630, 0x7E30,
+        0x8630, 0x8E30, 0x9630, 0x9630, 0x9E30, 0xA630, 0xAE30, 0xB630, 0xBE30, 0xC630, 0xCE30, 0xD630,
+        0xDE30, 0xE630, 0xEE30, 0xF630, 0x0670, 0x0E70, 0x1670, 0x1E70, 0x2670, 0x2E70, 0x3670, 0x3E70,
+        0x4670, 0x4E70, 0x5670, 0x5E70, 0x6670, 0x6E70, 0x7670, 0x7E70, 0x8670, 0x8E70, 0x9670, 0x9670,
+        0x9E70, 0xA670, 0xAE70, 0xB670, 0xBE70, 0xC670, 0xCE70, 0xD670, 0xDE70, 0xE670, 0xEE70, 0xF670,
+        0x06B0, 0x0EB0, 0x16B0, 0x1EB0, 0x26B0, 0x2EB0, 0x36B0, 0x3EB0, 0x46B0, 0x4EB0, 0x56B0, 0x5EB0,
+        0x66B0, 0x6EB0, 0x76B0, 0x7EB0, 0x86B0, 0x8EB0, 0x96B0, 0x96B0, 0x9EB0, 0xA6B0, 0xAEB0, 0xB6B0,
+        0xBEB0, 0xC6B0, 0xCEB0, 0xD6B0, 0xDEB0, 0xE6B0, 0xEEB0, 0xF6B0, 0x06F0, 0x0EF0, 0x16F0, 0x1EF0,
+        0x26F0, 0x2EF0, 0x36F0, 0x3EF0, 0x46F0, 0x4EF0, 0x56F0, 0x5EF0, 0x66F0, 0x6EF0, 0x76F0, 0x7EF0,
+        0x86F0, 0x8EF0, 0x96F0, 0x96F0, 0x9EF0, 0xA6F0, 0xAEF0, 0xB6F0, 0xBEF0, 0xC6F0, 0xCEF0, 0xD6F0,
+        0xDEF0, 0xE6F0, 0xEEF0, 0xF6F0, 0x0730, 0x0F30, 0x1730, 0x1F30, 0x2730, 0x2F30, 0x3730, 0x3F30,
+        0x4730, 0x4F30, 0x5730, 0x5F30, 0x6730, 0x6F30, 0x7730, 0x7F30, 0x8730, 0x8F30, 0x9730, 0x9730,
+        0x9F30, 0xA730, 0xAF30, 0xB730, 0xBF30, 0xC730, 0xCF30, 0xD730, 0xDF30, 0xE730, 0xEF30, 0xF730,
+        0x0770, 0x0F70, 0x1770, 0x1F70, 0x2770, 0x2F70, 0x3770, 0x3F70, 0x4770, 0x4F70, 0x5770, 0x5F70,
+        0x6770, 0x6F70, 0x7770, 0x7F70, 0x8770, 0x8F70, 0x9770, 0x9770, 0x9F70, 0xA770, 0xAF70, 0xB770,
+        0xBF70, 0xC770, 0xCF70, 0xD770, 0xDF70, 0xE770, 0xEF70, 0xF770, 0x07B0, 0x0FB0, 0x17B0, 0x1FB0,
+        0x27B0, 0x2FB0, 0x37B0, 0x3FB0, 0x47B0, 0x4FB0, 0x57B0, 0x5FB0, 0x67B0, 0x6FB0, 0x77B0, 0x7FB0,
+        0x87B0, 0x8FB0, 0x97B0, 0x97B0, 0x9FB0, 0xA7B0, 0xAFB0, 0xB7B0, 0xBFB0, 0xC7B0, 0xCFB0, 0xD7B0,
+        0xDFB0, 0xE7B0, 0xEFB0, 0xF7B0,
+    },
+    {
+        0x0010, 0x0810, 0x1010, 0x1810, 0x2010, 0x2810, 0x3010, 0x3810, 0x4010, 0x4810, 0x5010, 0x5810,
+        0x6010, 0x6810, 0x7010, 0x7810, 0x8010, 0x8810, 0x9010, 0x9010, 0x9810, 0xA010, 0xA810, 0xB010,
+        0xB810, 0xC010, 0xC810, 0xD010, 0xD810, 0xE010, 0xE810, 0xF010, 0x0050, 0x0850, 0x1050, 0x1850,
+        0x2050, 0x2850, 0x3050, 0x3850, 0x4050, 0x4850, 0x5050, 0x5850, 0x6050, 0x6850, 0x7050, 0x7850,
+        0x8050, 0x8850, 0x9050, 0x9050, 0x9850, 0xA050, 0xA850, 0xB050, 0xB850, 0xC050, 0xC850, 0xD050,
+        0xD850, 0xE050, 0xE850, 0xF050, 0x0090, 0x0890, 0x1090, 0x1890, 0x2090, 0x2890, 0x3090, 0x3890,
+        0x4090, 0x4890, 0x5090, 0x5890, 0x6090, 0x6890, 0x7090, 0x7890, 0x8090, 0x8890, 0x9090, 0x9090,
+        0x9890, 0xA090, 0xA890, 0xB090, 0xB890, 0xC090, 0xC890, 0xD090, 0xD890, 0xE090, 0xE890, 0xF090,
+        0x00D0, 0x08D0, 0x10D0, 0x18D0, 0x20D0, 0x28D0, 0x30D0, 0x38D0, 0x40D0, 0x48D0, 0x50D0, 0x58D0,
+        0x60D0, 0x68D0, 0x70D0, 0x78D0, 0x80D0, 0x88D0, 0x90D0, 0x90D0, 0x98D0, 0xA0D0, 0xA8D0, 0xB0D0,
+        0xB8D0, 0xC0D0, 0xC8D0, 0xD0D0, 0xD8D0, 0xE0D0, 0xE8D0, 0xF0D0, 0x0110, 0x0910, 0x1110, 0x1910,
+        0x2110, 0x2910, 0x3110, 0x3910, 0x4110, 0x4910, 0x5110, 0x5910, 0x6110, 0x6910, 0x7110, 0x7910,
+        0x8110, 0x8910, 0x9110, 0x9110, 0x9910, 0xA110, 0xA910, 0xB110, 0xB910, 0xC110, 0xC910, 0xD110,
+        0xD910, 0xE110, 0xE910, 0xF110, 0x0150, 0x0950, 0x1150, 0x1950, 0x2150, 0x2950, 0x3150, 0x3950,
+        0x4150, 0x4950, 0x5150, 0x5950, 0x6150, 0x6950, 0x7150, 0x7950, 0x8150, 0x8950, 0x9150, 0x9150,
+        0x9950, 0xA150, 0xA950, 0xB150, 0xB950, 0xC150, 0xC950, 0xD150, 0xD950, 0xE150, 0xE950, 0xF150,
+        0x0190, 0x0990, 0x1190, 0x1990, 0x2190, 0x2990, 0x3190, 0x3990, 0x4190, 0x4990, 0x5190, 0x5990,
+        0x6190, 0x6990, 0x7190, 0x7990, 0x8190, 0x8990, 0x9190, 0x9190, 0x9990, 0xA190, 0xA990, 0xB190,
+        0xB990, 0xC190, 0xC990, 0xD190, 0xD990, 0xE190, 0xE990, 0xF190, 0x01D0, 0x09D0, 0x11D0, 0x19D0,
+        0x21D0, 0x29D0, 0x31D0, 0x39D0, 0x41D0, 0x49D0, 0x51D0, 0x59D0, 0x61D0, 0x69D0, 0x71D0, 0x79D0,
+        0x81D0, 0x89D0, 0x91D0, 0x91D0, 0x99D0, 0xA1D0, 0xA9D0, 0xB1D0, 0xB9D0, 0xC1D0, 0xC9D0, 0xD1D0,
+        0xD9D0, 0xE1D0, 0xE9D0, 0xF1D0, 0x0210, 0x0A10, 0x1210, 0x1A10, 0x2210, 0x2A10, 0x3210, 0x3A10,
+        0x4210, 0x4A10, 0x5210, 0x5A10, 0x6210, 0x6A10, 0x7210, 0x7A10, 0x8210, 0x8A10, 0x9210, 0x9210,
+        0x9A10, 0xA210, 0xAA10, 0xB210, 0xBA10, 0xC210, 0xCA10, 0xD210, 0xDA10, 0xE210, 0xEA10, 0xF210,
+        0x0250, 0x0A50, 0x1250, 0x1A50, 0x2250, 0x2A50, 0x3250, 0x3A50, 0x4250, 0x4A50, 0x5250, 0x5A50,
+        0x6250, 0x6A50, 0x7250, 0x7A50, 0x8250, 0x8A50, 0x9250, 0x9250, 0x9A50, 0xA250, 0xAA50, 0xB250,
+        0xBA50, 0xC250, 0xCA50, 0xD250, 0xDA50, 0xE250, 0xEA50, 0xF250, 0x0290, 0x0A90, 0x1290, 0x1A90,
+        0x2290, 0x2A90, 0x3290, 0x3A90, 0x4290, 0x4A90, 0x5290, 0x5A90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A90, 0xA290, 0xAA90, 0xB290, 0xBA90, 0xC290, 0xCA90, 0xD290,
+        0xDA90, 0xE290, 0xEA90, 0xF290, 0x02D0, 0x0AD0, 0x12D0, 0x1AD0, 0x22D0, 0x2AD0, 0x32D0, 0x3AD0,
+        0x42D0, 0x4AD0, 0x52D0, 0x5AD0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x9AD0, 0xA2D0, 0xAAD0, 0xB2D0, 0xBAD0, 0xC2D0, 0xCAD0, 0xD2D0, 0xDAD0, 0xE2D0, 0xEAD0, 0xF2D0,
+        0x0310, 0x0B10, 0x1310, 0x1B10, 0x2310, 0x2B10, 0x3310, 0x3B10, 0x4310, 0x4B10, 0x5310, 0x5B10,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B10, 0xA310, 0xAB10, 0xB310,
+        0xBB10, 0xC310, 0xCB10, 0xD310, 0xDB10, 0xE310, 0xEB10, 0xF310, 0x0350, 0x0B50, 0x1350, 0x1B50,
+        0x2350, 0x2B50, 0x3350, 0x3B50, 0x4350, 0x4B50, 0x5350, 0x5B50, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B50, 0xA350, 0xAB50, 0xB350, 0xBB50, 0xC350, 0xCB50, 0xD350,
+        0xDB50, 0xE350, 0xEB50, 0xF350, 0x0390, 0x0B90, 0x1390, 0x1B90, 0x2390, 0x2B90, 0x3390, 0x3B90,
+        0x4390, 0x4B90, 0x5390, 0x5B90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x9B90, 0xA390, 0xAB90, 0xB390, 0xBB90, 0xC390, 0xCB90, 0xD390, 0xDB90, 0xE390, 0xEB90, 0xF390,
+        0x03D0, 0x0BD0, 0x13D0, 0x1BD0, 0x23D0, 0x2BD0, 0x33D0, 0x3BD0, 0x43D0, 0x4BD0, 0x53D0, 0x5BD0,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BD0, 0xA3D0, 0xABD0, 0xB3D0,
+        0xBBD0, 0xC3D0, 0xCBD0, 0xD3D0, 0xDBD0, 0xE3D0, 0xEBD0, 0xF3D0, 0x0410, 0x0C10, 0x1410, 0x1C10,
+        0x2410, 0x2C10, 0x3410, 0x3C10, 0x4410, 0x4C10, 0x5410, 0x5C10, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9C10, 0xA410, 0xAC10, 0xB410, 0xBC10, 0xC410, 0xCC10, 0xD410,
+        0xDC10, 0xE410, 0xEC10, 0xF410, 0x0450, 0x0C50, 0x1450, 0x1C50, 0x2450, 0x2C50, 0x3450, 0x3C50,
+        0x4450, 0x4C50, 0x5450, 0x5C50, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x9C50, 0xA450, 0xAC50, 0xB450, 0xBC50, 0xC450, 0xCC50, 0xD450, 0xDC50, 0xE450, 0xEC50, 0xF450,
+        0x0490, 0x0C90, 0x1490, 0x1C90, 0x2490, 0x2C90, 0x3490, 0x3C90, 0x4490, 0x4C90, 0x5490, 0x5C90,
+        0x6490, 0x6C90, 0x7490, 0x7C90, 0x8490, 0x8C90, 0x9490, 0x9490, 0x9C90, 0xA490, 0xAC90, 0xB490,
+        0xBC90, 0xC490, 0xCC90, 0xD490, 0xDC90, 0xE490, 0xEC90, 0xF490, 0x04D0, 0x0CD0, 0x14D0, 0x1CD0,
+        0x24D0, 0x2CD0, 0x34D0, 0x3CD0, 0x44D0, 0x4CD0, 0x54D0, 0x5CD0, 0x64D0, 0x6CD0, 0x74D0, 0x7CD0,
+        0x84D0, 0x8CD0, 0x94D0, 0x94D0, 0x9CD0, 0xA4D0, 0xACD0, 0xB4D0, 0xBCD0, 0xC4D0, 0xCCD0, 0xD4D0,
+        0xDCD0, 0xE4D0, 0xECD0, 0xF4D0, 0x0510, 0x0D10, 0x1510, 0x1D10, 0x2510, 0x2D10, 0x3510, 0x3D10,
+        0x4510, 0x4D10, 0x5510, 0x5D10, 0x6510, 0x6D10, 0x7510, 0x7D10, 0x8510, 0x8D10, 0x9510, 0x9510,
+        0x9D10, 0xA510, 0xAD10, 0xB510, 0xBD10, 0xC510, 0xCD10, 0xD510, 0xDD10, 0xE510, 0xED10, 0xF510,
+        0x0550, 0x0D50, 0x1550, 0x1D50, 0x2550, 0x2D50, 0x3550, 0x3D50, 0x4550, 0x4D50, 0x5550, 0x5D50,
+        0x6550, 0x6D50, 0x7550, 0x7D50, 0x8550, 0x8D50, 0x9550, 0x9550, 0x9D50, 0xA550, 0xAD50, 0xB550,
+        0xBD50, 0xC550, 0xCD50, 0xD550, 0xDD50, 0xE550, 0xED50, 0xF550, 0x0570, 0x0D70, 0x1570, 0x1D70,
+        0x2570, 0x2D70, 0x3570, 0x3D70, 0x4570, 0x4D70, 0x5570, 0x5D70, 0x6570, 0x6D70, 0x7570, 0x7D70,
+        0x8570, 0x8D70, 0x9570, 0x9570, 0x9D70, 0xA570, 0xAD70, 0xB570, 0xBD70, 0xC570, 0xCD70, 0xD570,
+        0xDD70, 0xE570, 0xED70, 0xF570, 0x05B0, 0x0DB0, 0x15B0, 0x1DB0, 0x25B0, 0x2DB0, 0x35B0, 0x3DB0,
+        0x45B0, 0x4DB0, 0x55B0, 0x5DB0, 0x65B0, 0x6DB0, 0x75B0, 0x7DB0, 0x85B0, 0x8DB0, 0x95B0, 0x95B0,
+        0x9DB0, 0xA5B0, 0xADB0, 0xB5B0, 0xBDB0, 0xC5B0, 0xCDB0, 0xD5B0, 0xDDB0, 0xE5B0, 0xEDB0, 0xF5B0,
+        0x05F0, 0x0DF0, 0x15F0, 0x1DF0, 0x25F0, 0x2DF0, 0x35F0, 0x3DF0, 0x45F0, 0x4DF0, 0x55F0, 0x5DF0,
+        0x65F0, 0x6DF0, 0x75F0, 0x7DF0, 0x85F0, 0x8DF0, 0x95F0, 0x95F0, 0x9DF0, 0xA5F0, 0xADF0, 0xB5F0,
+        0xBDF0, 0xC5F0, 0xCDF0, 0xD5F0, 0xDDF0, 0xE5F0, 0xEDF0, 0xF5F0, 0x0630, 0x0E30, 0x1630, 0x1E30,
+        0x2630, 0x2E30, 0x3630, 0x3E30, 0x4630, 0x4E30, 0x5630, 0x5E30, 0x6630, 0x6E30, 0x7630, 0x7E30,
+        0x8630, 0x8E30, 0x9630, 0x9630, 0x9E30, 0xA630, 0xAE30, 0xB630, 0xBE30, 0xC630, 0xCE30, 0xD630,
+        0xDE30, 0xE630, 0xEE30, 0xF630, 0x0670, 0x0E70, 0x1670, 0x1E70, 0x2670, 0x2E70, 0x3670, 0x3E70,
+        0x4670, 0x4E70, 0x5670, 0x5E70, 0x6670, 0x6E70, 0x7670, 0x7E70, 0x8670, 0x8E70, 0x9670, 0x9670,
+        0x9E70, 0xA670, 0xAE70, 0xB670, 0xBE70, 0xC670, 0xCE70, 0xD670, 0xDE70, 0xE670, 0xEE70, 0xF670,
+        0x06B0, 0x0EB0, 0x16B0, 0x1EB0, 0x26B0, 0x2EB0, 0x36B0, 0x3EB0, 0x46B0, 0x4EB0, 0x56B0, 0x5EB0,
+        0x66B0, 0x6EB0, 0x76B0, 0x7EB0, 0x86B0, 0x8EB0, 0x96B0, 0x96B0, 0x9EB0, 0xA6B0, 0xAEB0, 0xB6B0,
+        0xBEB0, 0xC6B0, 0xCEB0, 0xD6B0, 0xDEB0, 0xE6B0, 0xEEB0, 0xF6B0, 0x06F0, 0x0EF0, 0x16F0, 0x1EF0,
+        0x26F0, 0x2EF0, 0x36F0, 0x3EF0, 0x46F0, 0x4EF0, 0x56F0, 0x5EF0, 0x66F0, 0x6EF0, 0x76F0, 0x7EF0,
+        0x86F0, 0x8EF0, 0x96F0, 0x96F0, 0x9EF0, 0xA6F0, 0xAEF0, 0xB6F0, 0xBEF0, 0xC6F0, 0xCEF0, 0xD6F0,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0730, 0x0F30, 0x1730, 0x1F30, 0x2730, 0x2F30, 0x3730, 0x3F30,
+        0x4730, 0x4F30, 0x5730, 0x5F30, 0x6730, 0x6F30, 0x7730, 0x7F30, 0x8730, 0x8F30, 0x9730, 0x9730,
+        0x9F30, 0xA730, 0xAF30, 0xB730, 0xBF30, 0xC730, 0xCF30, 0xD730, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0770, 0x0F70, 0x1770, 0x1F70, 0x2770, 0x2F70, 0x3770, 0x3F70, 0x4770, 0x4F70, 0x5770, 0x5F70,
+        0x6770, 0x6F70, 0x7770, 0x7F70, 0x8770, 0x8F70, 0x9770, 0x9770, 0x9F70, 0xA770, 0xAF70, 0xB770,
+        0xBF70, 0xC770, 0xCF70, 0xD770, 0x0000, 0x0000, 0x0000, 0x0000, 0x07B0, 0x0FB0, 0x17B0, 0x1FB0,
+        0x27B0, 0x2FB0, 0x37B0, 0x3FB0, 0x47B0, 0x4FB0, 0x57B0, 0x5FB0, 0x67B0, 0x6FB0, 0x77B0, 0x7FB0,
+        0x87B0, 0x8FB0, 0x97B0, 0x97B0, 0x9FB0, 0xA7B0, 0xAFB0, 0xB7B0, 0xBFB0, 0xC7B0, 0xCFB0, 0xD7B0,
+        0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0010, 0x0810, 0x1010, 0x1810, 0x2010, 0x2810, 0x3010, 0x3810, 0x4010, 0x4810, 0x5010, 0x5810,
+        0x6010, 0x6810, 0x7010, 0x7810, 0x8010, 0x8810, 0x9010, 0x9010, 0x9810, 0xA010, 0xA810, 0xB010,
+        0xB810, 0xC010, 0xC810, 0xD010, 0xD810, 0xE010, 0xE810, 0xF010, 0x0050, 0x0850, 0x1050, 0x1850,
+        0x2050, 0x2850, 0x3050, 0x3850, 0x4050, 0x4850, 0x5050, 0x5850, 0x6050, 0x6850, 0x7050, 0x7850,
+        0x8050, 0x8850, 0x9050, 0x9050, 0x9850, 0xA050, 0xA850, 0xB050, 0xB850, 0xC050, 0xC850, 0xD050,
+        0xD850, 0xE050, 0xE850, 0xF050, 0x0090, 0x0890, 0x1090, 0x1890, 0x2090, 0x2890, 0x3090, 0x3890,
+        0x4090, 0x4890, 0x5090, 0x5890, 0x6090, 0x6890, 0x7090, 0x7890, 0x8090, 0x8890, 0x9090, 0x9090,
+        0x9890, 0xA090, 0xA890, 0xB090, 0xB890, 0xC090, 0xC890, 0xD090, 0xD890, 0xE090, 0xE890, 0xF090,
+        0x00D0, 0x08D0, 0x10D0, 0x18D0, 0x20D0, 0x28D0, 0x30D0, 0x38D0, 0x40D0, 0x48D0, 0x50D0, 0x58D0,
+        0x60D0, 0x68D0, 0x70D0, 0x78D0, 0x80D0, 0x88D0, 0x90D0, 0x90D0, 0x98D0, 0xA0D0, 0xA8D0, 0xB0D0,
+        0xB8D0, 0xC0D0, 0xC8D0, 0xD0D0, 0xD8D0, 0xE0D0, 0xE8D0, 0xF0D0, 0x0110, 0x0910, 0x1110, 0x1910,
+        0x2110, 0x2910, 0x3110, 0x3910, 0x4110, 0x4910, 0x5110, 0x5910, 0x6110, 0x6910, 0x7110, 0x7910,
+        0x8110, 0x8910, 0x9110, 0x9110, 0x9910, 0xA110, 0xA910, 0xB110, 0xB910, 0xC110, 0xC910, 0xD110,
+        0xD910, 0xE110, 0xE910, 0xF110, 0x0150, 0x0950, 0x1150, 0x1950, 0x2150, 0x2950, 0x3150, 0x3950,
+        0x4150, 0x4950, 0x5150, 0x5950, 0x6150, 0x6950, 0x7150, 0x7950, 0x8150, 0x8950, 0x9150, 0x9150,
+        0x9950, 0xA150, 0xA950, 0xB150, 0xB950, 0xC150, 0xC950, 0xD150, 0xD950, 0xE150, 0xE950, 0xF150,
+        0x0190, 0x0990, 0x1190, 0x1990, 0x2190, 0x2990, 0x3190, 0x3990, 0x4190, 0x4990, 0x5190, 0x5990,
+        0x6190, 0x6990, 0x7190, 0x7990, 0x8190, 0x8990, 0x9190, 0x9190, 0x9990, 0xA190, 0xA990, 0xB190,
+        0xB990, 0xC190, 0xC990, 0xD190, 0xD990, 0xE190, 0xE990, 0xF190, 0x01D0, 0x09D0, 0x11D0, 0x19D0,
+        0x21D0, 0x29D0, 0x31D0, 0x39D0, 0x41D0, 0x49D0, 0x51D0, 0x59D0, 0x61D0, 0x69D0, 0x71D0, 0x79D0,
+        0x81D0, 0x89D0, 0x91D0, 0x91D0, 0x99D0, 0xA1D0, 0xA9D0, 0xB1D0, 0xB9D0, 0xC1D0, 0xC9D0, 0xD1D0,
+        0xD9D0, 0xE1D0, 0xE9D0, 0xF1D0, 0x0210, 0x0A10, 0x1210, 0x1A10, 0x2210, 0x2A10, 0x3210, 0x3A10,
+        0x4210, 0x4A10, 0x5210, 0x5A10, 0x6210, 0x6A10, 0x7210, 0x7A10, 0x8210, 0x8A10, 0x9210, 0x9210,
+        0x9A10, 0xA210, 0xAA10, 0xB210, 0xBA10, 0xC210, 0xCA10, 0xD210, 0xDA10, 0xE210, 0xEA10, 0xF210,
+        0x0250, 0x0A50, 0x1250, 0x1A50, 0x2250, 0x2A50, 0x3250, 0x3A50, 0x4250, 0x4A50, 0x5250, 0x5A50,
+        0x6250, 0x6A50, 0x7250, 0x7A50, 0x8250, 0x8A50, 0x9250, 0x9250, 0x9A50, 0xA250, 0xAA50, 0xB250,
+        0xBA50, 0xC250, 0xCA50, 0xD250, 0xDA50, 0xE250, 0xEA50, 0xF250, 0x0290, 0x0A90, 0x1290, 0x1A90,
+        0x2290, 0x2A90, 0x3290, 0x3A90, 0x4290, 0x4A90, 0x5290, 0x5A90, 0x6290, 0x6A90, 0x7290, 0x7A90,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBA90, 0xC290, 0xCA90, 0xD290,
+        0xDA90, 0xE290, 0xEA90, 0xF290, 0x02D0, 0x0AD0, 0x12D0, 0x1AD0, 0x22D0, 0x2AD0, 0x32D0, 0x3AD0,
+        0x42D0, 0x4AD0, 0x52D0, 0x5AD0, 0x62D0, 0x6AD0, 0x72D0, 0x7AD0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBAD0, 0xC2D0, 0xCAD0, 0xD2D0, 0xDAD0, 0xE2D0, 0xEAD0, 0xF2D0,
+        0x0310, 0x0B10, 0x1310, 0x1B10, 0x2310, 0x2B10, 0x3310, 0x3B10, 0x4310, 0x4B10, 0x5310, 0x5B10,
+        0x6310, 0x6B10, 0x7310, 0x7B10, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xBB10, 0xC310, 0xCB10, 0xD310, 0xDB10, 0xE310, 0xEB10, 0xF310, 0x0350, 0x0B50, 0x1350, 0x1B50,
+        0x2350, 0x2B50, 0x3350, 0x3B50, 0x4350, 0x4B50, 0x5350, 0x5B50, 0x6350, 0x6B50, 0x7350, 0x7B50,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBB50, 0xC350, 0xCB50, 0xD350,
+        0xDB50, 0xE350, 0xEB50, 0xF350, 0x0390, 0x0B90, 0x1390, 0x1B90, 0x2390, 0x2B90, 0x3390, 0x3B90,
+        0x4390, 0x4B90, 0x5390, 0x5B90, 0x6390, 0x6B90, 0x7390, 0x7B90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBB90, 0xC390, 0xCB90, 0xD390, 0xDB90, 0xE390, 0xEB90, 0xF390,
+        0x03D0, 0x0BD0, 0x13D0, 0x1BD0, 0x23D0, 0x2BD0, 0x33D0, 0x3BD0, 0x43D0, 0x4BD0, 0x53D0, 0x5BD0,
+        0x63D0, 0x6BD0, 0x73D0, 0x7BD0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xBBD0, 0xC3D0, 0xCBD0, 0xD3D0, 0xDBD0, 0xE3D0, 0xEBD0, 0xF3D0, 0x0410, 0x0C10, 0x1410, 0x1C10,
+        0x2410, 0x2C10, 0x3410, 0x3C10, 0x4410, 0x4C10, 0x5410, 0x5C10, 0x6410, 0x6C10, 0x7410, 0x7C10,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBC10, 0xC410, 0xCC10, 0xD410,
+        0xDC10, 0xE410, 0xEC10, 0xF410, 0x0450, 0x0C50, 0x1450, 0x1C50, 0x2450, 0x2C50, 0x3450, 0x3C50,
+        0x4450, 0x4C50, 0x5450, 0x5C50, 0x6450, 0x6C50, 0x7450, 0x7C50, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBC50, 0xC450, 0xCC50, 0xD450, 0xDC50, 0xE450, 0xEC50, 0xF450,
+        0x0490, 0x0C90, 0x1490, 0x1C90, 0x2490, 0x2C90, 0x3490, 0x3C90, 0x4490, 0x4C90, 0x5490, 0x5C90,
+        0x6490, 0x6C90, 0x7490, 0x7C90, 0x8490, 0x8C90, 0x9490, 0x9490, 0x9C90, 0xA490, 0xAC90, 0xB490,
+        0xBC90, 0xC490, 0xCC90, 0xD490, 0xDC90, 0xE490, 0xEC90, 0xF490, 0x04D0, 0x0CD0, 0x14D0, 0x1CD0,
+        0x24D0, 0x2CD0, 0x34D0, 0x3CD0, 0x44D0, 0x4CD0, 0x54D0, 0x5CD0, 0x64D0, 0x6CD0, 0x74D0, 0x7CD0,
+        0x84D0, 0x8CD0, 0x94D0, 0x94D0, 0x9CD0, 0xA4D0, 0xACD0, 0xB4D0, 0xBCD0, 0xC4D0, 0xCCD0, 0xD4D0,
+        0xDCD0, 0xE4D0, 0xECD0, 0xF4D0, 0x0510, 0x0D10, 0x1510, 0x1D10, 0x2510, 0x2D10, 0x3510, 0x3D10,
+        0x4510, 0x4D10, 0x5510, 0x5D10, 0x6510, 0x6D10, 0x7510, 0x7D10, 0x8510, 0x8D10, 0x9510, 0x9510,
+        0x9D10, 0xA510, 0xAD10, 0xB510, 0xBD10, 0xC510, 0xCD10, 0xD510, 0xDD10, 0xE510, 0xED10, 0xF510,
+        0x0550, 0x0D50, 0x1550, 0x1D50, 0x2550, 0x2D50, 0x3550, 0x3D50, 0x4550, 0x4D50, 0x5550, 0x5D50,
+        0x6550, 0x6D50, 0x7550, 0x7D50, 0x8550, 0x8D50, 0x9550, 0x9550, 0x9D50, 0xA550, 0xAD50, 0xB550,
+        0xBD50, 0xC550, 0xCD50, 0xD550, 0xDD50, 0xE550, 0xED50, 0xF550, 0x0570, 0x0D70, 0x1570, 0x1D70,
+        0x2570, 0x2D70, 0x3570, 0x3D70, 0x4570, 0x4D70, 0x5570, 0x5D70, 0x6570, 0x6D70, 0x7570, 0x7D70,
+        0x8570, 0x8D70, 0x9570, 0x9570, 0x9D70, 0xA570, 0xAD70, 0xB570, 0xBD70, 0xC570, 0xCD70, 0xD570,
+        0xDD70, 0xE570, 0xED70, 0xF570, 0x05B0, 0x0DB0, 0x15B0, 0x1DB0, 0x25B0, 0x2DB0, 0x35B0, 0x3DB0,
+        0x45B0, 0x4DB0, 0x55B0, 0x5DB0, 0x65B0, 0x6DB0, 0x75B0, 0x7DB0, 0x85B0, 0x8DB0, 0x95B0, 0x95B0,
+        0x9DB0, 0xA5B0, 0xADB0, 0xB5B0, 0xBDB0, 0xC5B0, 0xCDB0, 0xD5B0, 0xDDB0, 0xE5B0, 0xEDB0, 0xF5B0,
+        0x05F0, 0x0DF0, 0x15F0, 0x1DF0, 0x25F0, 0x2DF0, 0x35F0, 0x3DF0, 0x45F0, 0x4DF0, 0x55F0, 0x5DF0,
+        0x65F0, 0x6DF0, 0x75F0, 0x7DF0, 0x85F0, 0x8DF0, 0x95F0, 0x95F0, 0x9DF0, 0xA5F0, 0xADF0, 0xB5F0,
+        0xBDF0, 0xC5F0, 0xCDF0, 0xD5F0, 0xDDF0, 0xE5F0, 0xEDF0, 0xF5F0, 0x0630, 0x0E30, 0x1630, 0x1E30,
+        0x2630, 0x2E30, 0x3630, 0x3E30, 0x4630, 0x4E30, 0x5630, 0x5E30, 0x6630, 0x6E30, 0x7630, 0x7E30,
+        0x8630, 0x8E30, 0x9630, 0x9630, 0x9E30, 0xA630, 0xAE30, 0xB630, 0xBE30, 0xC630, 0xCE30, 0xD630,
+        0xDE30, 0xE630, 0xEE30, 0xF630, 0x0670, 0x0E70, 0x1670, 0x1E70, 0x2670, 0x2E70, 0x3670, 0x3E70,
+        0x4670, 0x4E70, 0x5670, 0x5E70, 0x6670, 0x6E70, 0x7670, 0x7E70, 0x8670, 0x8E70, 0x9670, 0x9670,
+        0x9E70, 0xA670, 0xAE70, 0xB670, 0xBE70, 0xC670, 0xCE70, 0xD670, 0xDE70, 0xE670, 0xEE70, 0xF670,
+        0x06B0, 0x0EB0, 0x16B0, 0x1EB0, 0x26B0, 0x2EB0, 0x36B0, 0x3EB0, 0x46B0, 0x4EB0, 0x56B0, 0x5EB0,
+        0x66B0, 0x6EB0, 0x76B0, 0x7EB0, 0x86B0, 0x8EB0, 0x96B0, 0x96B0, 0x9EB0, 0xA6B0, 0xAEB0, 0xB6B0,
+        0xBEB0, 0xC6B0, 0xCEB0, 0xD6B0, 0xDEB0, 0xE6B0, 0xEEB0, 0xF6B0, 0x06F0, 0x0EF0, 0x16F0, 0x1EF0,
+        0x26F0, 0x2EF0, 0x36F0, 0x3EF0, 0x46F0, 0x4EF0, 0x56F0, 0x5EF0, 0x66F0, 0x6EF0, 0x76F0, 0x7EF0,
+        0x86F0, 0x8EF0, 0x96F0, 0x96F0, 0x9EF0, 0xA6F0, 0xAEF0, 0xB6F0, 0xBEF0, 0xC6F0, 0xCEF0, 0xD6F0,
+        0xDEF0, 0xE6F0, 0xEEF0, 0xF6F0, 0x0730, 0x0F30, 0x1730, 0x1F30, 0x2730, 0x2F30, 0x3730, 0x3F30,
+        0x4730, 0x4F30, 0x5730, 0x5F30, 0x6730, 0x6F30, 0x7730, 0x7F30, 0x8730, 0x8F30, 0x9730, 0x9730,
+        0x9F30, 0xA730, 0xAF30, 0xB730, 0xBF30, 0xC730, 0xCF30, 0xD730, 0xDF30, 0xE730, 0xEF30, 0xF730,
+        0x0770, 0x0F70, 0x1770, 0x1F70, 0x2770, 0x2F70, 0x3770, 0x3F70, 0x4770, 0x4F70, 0x5770, 0x5F70,
+        0x6770, 0x6F70, 0x7770, 0x7F70, 0x8770, 0x8F70, 0x9770, 0x9770, 0x9F70, 0xA770, 0xAF70, 0xB770,
+        0xBF70, 0xC770, 0xCF70, 0xD770, 0xDF70, 0xE770, 0xEF70, 0xF770, 0x07B0, 0x0FB0, 0x17B0, 0x1FB0,
+        0x27B0, 0x2FB0, 0x37B0, 0x3FB0, 0x47B0, 0x4FB0, 0x57B0, 0x5FB0, 0x67B0, 0x6FB0, 0x77B0, 0x7FB0,
+        0x87B0, 0x8FB0, 0x97B0, 0x97B0, 0x9FB0, 0xA7B0, 0xAFB0, 0xB7B0, 0xBFB0, 0xC7B0, 0xCFB0, 0xD7B0,
+        0xDFB0, 0xE7B0, 0xEFB0, 0xF7B0,
+    },
+    {
+        0x0010, 0x0810, 0x1010, 0x1810, 0x2010, 0x2810, 0x3010, 0x3810, 0x4010, 0x4810, 0x5010, 0x5810,
+        0x6010, 0x6810, 0x7010, 0x7810, 0x8010, 0x8810, 0x9010, 0x9010, 0x9810, 0xA010, 0xA810, 0xB010,
+        0xB810, 0xC010, 0xC810, 0xD010, 0xD810, 0xE010, 0xE810, 0xF010, 0x0050, 0x0850, 0x1050, 0x1850,
+        0x2050, 0x2850, 0x3050, 0x3850, 0x4050, 0x4850, 0x5050, 0x5850, 0x6050, 0x6850, 0x7050, 0x7850,
+        0x8050, 0x8850, 0x9050, 0x9050, 0x9850, 0xA050, 0xA850, 0xB050, 0xB850, 0xC050, 0xC850, 0xD050,
+        0xD850, 0xE050, 0xE850, 0xF050, 0x0090, 0x0890, 0x1090, 0x1890, 0x2090, 0x2890, 0x3090, 0x3890,
+        0x4090, 0x4890, 0x5090, 0x5890, 0x6090, 0x6890, 0x7090, 0x7890, 0x8090, 0x8890, 0x9090, 0x9090,
+        0x9890, 0xA090, 0xA890, 0xB090, 0xB890, 0xC090, 0xC890, 0xD090, 0xD890, 0xE090, 0xE890, 0xF090,
+        0x00D0, 0x08D0, 0x10D0, 0x18D0, 0x20D0, 0x28D0, 0x30D0, 0x38D0, 0x40D0, 0x48D0, 0x50D0, 0x58D0,
+        0x60D0, 0x68D0, 0x70D0, 0x78D0, 0x80D0, 0x88D0, 0x90D0, 0x90D0, 0x98D0, 0xA0D0, 0xA8D0, 0xB0D0,
+        0xB8D0, 0xC0D0, 0xC8D0, 0xD0D0, 0xD8D0, 0xE0D0, 0xE8D0, 0xF0D0, 0x0110, 0x0910, 0x1110, 0x1910,
+        0x2110, 0x2910, 0x3110, 0x3910, 0x4110, 0x4910, 0x5110, 0x5910, 0x6110, 0x6910, 0x7110, 0x7910,
+        0x8110, 0x8910, 0x9110, 0x9110, 0x9910, 0xA110, 0xA910, 0xB110, 0xB910, 0xC110, 0xC910, 0xD110,
+        0xD910, 0xE110, 0xE910, 0xF110, 0x0150, 0x0950, 0x1150, 0x1950, 0x2150, 0x2950, 0x3150, 0x3950,
+        0x4150, 0x4950, 0x5150, 0x5950, 0x6150, 0x6950, 0x7150, 0x7950, 0x8150, 0x8950, 0x9150, 0x9150,
+        0x9950, 0xA150, 0xA950, 0xB150, 0xB950, 0xC150, 0xC950, 0xD150, 0xD950, 0xE150, 0xE950, 0xF150,
+        0x0190, 0x0990, 0x1190, 0x1990, 0x2190, 0x2990, 0x3190, 0x3990, 0x4190, 0x4990, 0x5190, 0x5990,
+        0x6190, 0x6990, 0x7190, 0x7990, 0x8190, 0x8990, 0x9190, 0x9190, 0x9990, 0xA190, 0xA990, 0xB190,
+        0xB990, 0xC190, 0xC990, 0xD190, 0xD990, 0xE190, 0xE990, 0xF190, 0x01D0, 0x09D0, 0x11D0, 0x19D0,
+        0x21D0, 0x29D0, 0x31D0, 0x39D0, 0x41D0, 0x49D0, 0x51D0, 0x59D0, 0x61D0, 0x69D0, 0x71D0, 0x79D0,
+        0x81D0, 0x89D0, 0x91D0, 0x91D0, 0x99D0, 0xA1D0, 0xA9D0, 0xB1D0, 0xB9D0, 0xC1D0, 0xC9D0, 0xD1D0,
+        0xD9D0, 0xE1D0, 0xE9D0, 0xF1D0, 0x0210, 0x0A10, 0x1210, 0x1A10, 0x2210, 0x2A10, 0x3210, 0x3A10,
+        0x4210, 0x4A10, 0x5210, 0x5A10, 0x6210, 0x6A10, 0x7210, 0x7A10, 0x8210, 0x8A10, 0x9210, 0x9210,
+        0x9A10, 0xA210, 0xAA10, 0xB210, 0xBA10, 0xC210, 0xCA10, 0xD210, 0xDA10, 0xE210, 0xEA10, 0xF210,
+        0x0250, 0x0A50, 0x1250, 0x1A50, 0x2250, 0x2A50, 0x3250, 0x3A50, 0x4250, 0x4A50, 0x5250, 0x5A50,
+        0x6250, 0x6A50, 0x7250, 0x7A50, 0x8250, 0x8A50, 0x9250, 0x9250, 0x9A50, 0xA250, 0xAA50, 0xB250,
+        0xBA50, 0xC250, 0xCA50, 0xD250, 0xDA50, 0xE250, 0xEA50, 0xF250, 0x0290, 0x0A90, 0x1290, 0x1A90,
+        0x2290, 0x2A90, 0x3290, 0x3A90, 0x4290, 0x4A90, 0x5290, 0x5A90, 0x6290, 0x6A90, 0x7290, 0x7A90,
+        0x8290, 0x8A90, 0x9290, 0x9290, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xDA90, 0xE290, 0xEA90, 0xF290, 0x02D0, 0x0AD0, 0x12D0, 0x1AD0, 0x22D0, 0x2AD0, 0x32D0, 0x3AD0,
+        0x42D0, 0x4AD0, 0x52D0, 0x5AD0, 0x62D0, 0x6AD0, 0x72D0, 0x7AD0, 0x82D0, 0x8AD0, 0x92D0, 0x92D0,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDAD0, 0xE2D0, 0xEAD0, 0xF2D0,
+        0x0310, 0x0B10, 0x1310, 0x1B10, 0x2310, 0x2B10, 0x3310, 0x3B10, 0x4310, 0x4B10, 0x5310, 0x5B10,
+        0x6310, 0x6B10, 0x7310, 0x7B10, 0x8310, 0x8B10, 0x9310, 0x9310, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDB10, 0xE310, 0xEB10, 0xF310, 0x0350, 0x0B50, 0x1350, 0x1B50,
+        0x2350, 0x2B50, 0x3350, 0x3B50, 0x4350, 0x4B50, 0x5350, 0x5B50, 0x6350, 0x6B50, 0x7350, 0x7B50,
+        0x8350, 0x8B50, 0x9350, 0x9350, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xDB50, 0xE350, 0xEB50, 0xF350, 0x0390, 0x0B90, 0x1390, 0x1B90, 0x2390, 0x2B90, 0x3390, 0x3B90,
+        0x4390, 0x4B90, 0x5390, 0x5B90, 0x6390, 0x6B90, 0x7390, 0x7B90, 0x8390, 0x8B90, 0x9390, 0x9390,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDB90, 0xE390, 0xEB90, 0xF390,
+        0x03D0, 0x0BD0, 0x13D0, 0x1BD0, 0x23D0, 0x2BD0, 0x33D0, 0x3BD0, 0x43D0, 0x4BD0, 0x53D0, 0x5BD0,
+        0x63D0, 0x6BD0, 0x73D0, 0x7BD0, 0x83D0, 0x8BD0, 0x93D0, 0x93D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDBD0, 0xE3D0, 0xEBD0, 0xF3D0, 0x0410, 0x0C10, 0x1410, 0x1C10,
+        0x2410, 0x2C10, 0x3410, 0x3C10, 0x4410, 0x4C10, 0x5410, 0x5C10, 0x6410, 0x6C10, 0x7410, 0x7C10,
+        0x8410, 0x8C10, 0x9410, 0x9410, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xDC10, 0xE410, 0xEC10, 0xF410, 0x0450, 0x0C50, 0x1450, 0x1C50, 0x2450, 0x2C50, 0x3450, 0x3C50,
+        0x4450, 0x4C50, 0x5450, 0x5C50, 0x6450, 0x6C50, 0x7450, 0x7C50, 0x8450, 0x8C50, 0x9450, 0x9450,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDC50, 0xE450, 0xEC50, 0xF450,
+        0x0490, 0x0C90, 0x1490, 0x1C90, 0x2490, 0x2C90, 0x3490, 0x3C90, 0x4490, 0x4C90, 0x5490, 0x5C90,
+        0x6490, 0x6C90, 0x7490, 0x7C90, 0x8490, 0x8C90, 0x9490, 0x9490, 0x9C90, 0xA490, 0xAC90, 0xB490,
+        0xBC90, 0xC490, 0xCC90, 0xD490, 0xDC90, 0xE490, 0xEC90, 0xF490, 0x04D0, 0x0CD0, 0x14D0, 0x1CD0,
+        0x24D0, 0x2CD0, 0x34D0, 0x3CD0, 0x44D0, 0x4CD0, 0x54D0, 0x5CD0, 0x64D0, 0x6CD0, 0x74D0, 0x7CD0,
+        0x84D0, 0x8CD0, 0x94D0, 0x94D0, 0x9CD0, 0xA4D0, 0xACD0, 0xB4D0, 0xBCD0, 0xC4D0, 0xCCD0, 0xD4D0,
+        0xDCD0, 0xE4D0, 0xECD0, 0xF4D0, 0x0510, 0x0D10, 0x1510, 0x1D10, 0x2510, 0x2D10, 0x3510, 0x3D10,
+        0x4510, 0x4D10, 0x5510, 0x5D10, 0x6510, 0x6D10, 0x7510, 0x7D10, 0x8510, 0x8D10, 0x9510, 0x9510,
+        0x9D10, 0xA510, 0xAD10, 0xB510, 0xBD10, 0xC510, 0xCD10, 0xD510, 0xDD10, 0xE510, 0xED10, 0xF510,
+        0x0550, 0x0D50, 0x1550, 0x1D50, 0x2550, 0x2D50, 0x3550, 0x3D50, 0x4550, 0x4D50, 0x5550, 0x5D50,
+        0x6550, 0x6D50, 0x7550, 0x7D50, 0x8550, 0x8D50, 0x9550, 0x9550, 0x9D50, 0xA550, 0xAD50, 0xB550,
+        0xBD50, 0xC550, 0xCD50, 0xD550, 0xDD50, 0xE550, 0xED50, 0xF550, 0x0570, 0x0D70, 0x1570, 0x1D70,
+        0x2570, 0x2D70, 0x3570, 0x3D70, 0x4570, 0x4D70, 0x5570, 0x5D70, 0x6570, 0x6D70, 0x7570, 0x7D70,
+        0x8570, 0x8D70, 0x9570, 0x9570, 0x9D70, 0xA570, 0xAD70, 0xB570, 0xBD70, 0xC570, 0xCD70, 0xD570,
+        0xDD70, 0xE570, 0xED70, 0xF570, 0x05B0, 0x0DB0, 0x15B0, 0x1DB0, 0x25B0, 0x2DB0, 0x35B0, 0x3DB0,
+        0x45B0, 0x4DB0, 0x55B0, 0x5DB0, 0x65B0, 0x6DB0, 0x75B0, 0x7DB0, 0x85B0, 0x8DB0, 0x95B0, 0x95B0,
+        0x9DB0, 0xA5B0, 0xADB0, 0xB5B0, 0xBDB0, 0xC5B0, 0xCDB0, 0xD5B0, 0xDDB0, 0xE5B0, 0xEDB0, 0xF5B0,
+        0x05F0, 0x0DF0, 0x15F0, 0x1DF0, 0x25F0, 0x2DF0, 0x35F0, 0x3DF0, 0x45F0, 0x4DF0, 0x55F0, 0x5DF0,
+        0x65F0, 0x6DF0, 0x75F0, 0x7DF0, 0x85F0, 0x8DF0, 0x95F0, 0x95F0, 0x9DF0, 0xA5F0, 0xADF0, 0xB5F0,
+        0xBDF0, 0xC5F0, 0xCDF0, 0xD5F0, 0xDDF0, 0xE5F0, 0xEDF0, 0xF5F0, 0x0630, 0x0E30, 0x1630, 0x1E30,
+        0x2630, 0x2E30, 0x3630, 0x3E30, 0x4630, 0x4E30, 0x5630, 0x5E30, 0x6630, 0x6E30, 0x7630, 0x7E30,
+        0x8630, 0x8E30, 0x9630, 0x9630, 0x9E30, 0xA630, 0xAE30, 0xB630, 0xBE30, 0xC630, 0xCE30, 0xD630,
+        0xDE30, 0xE630, 0xEE30, 0xF630, 0x0670, 0x0E70, 0x1670, 0x1E70, 0x2670, 0x2E70, 0x3670, 0x3E70,
+        0x4670, 0x4E70, 0x5670, 0x5E70, 0x6670, 0x6E70, 0x7670, 0x7E70, 0x8670, 0x8E70, 0x9670, 0x9670,
+        0x9E70, 0xA670, 0xAE70, 0xB670, 0xBE70, 0xC670, 0xCE70, 0xD670, 0xDE70, 0xE670, 0xEE70, 0xF670,
+        0x06B0, 0x0EB0, 0x16B0, 0x1EB0, 0x26B0, 0x2EB0, 0x36B0, 0x3EB0, 0x46B0, 0x4EB0, 0x56B0, 0x5EB0,
+        0x66B0, 0x6EB0, 0x76B0, 0x7EB0, 0x86B0, 0x8EB0, 0x96B0, 0x96B0, 0x9EB0, 0xA6B0, 0xAEB0, 0xB6B0,
+        0xBEB0, 0xC6B0, 0xCEB0, 0xD6B0, 0xDEB0, 0xE6B0, 0xEEB0, 0xF6B0, 0x06F0, 0x0EF0, 0x16F0, 0x1EF0,
+        0x26F0, 0x2EF0, 0x36F0, 0x3EF0, 0x46F0, 0x4EF0, 0x56F0, 0x5EF0, 0x66F0, 0x6EF0, 0x76F0, 0x7EF0,
+        0x86F0, 0x8EF0, 0x96F0, 0x96F0, 0x9EF0, 0xA6F0, 0xAEF0, 0xB6F0, 0xBEF0, 0xC6F0, 0xCEF0, 0xD6F0,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0730, 0x0F30, 0x1730, 0x1F30, 0x2730, 0x2F30, 0x3730, 0x3F30,
+        0x4730, 0x4F30, 0x5730, 0x5F30, 0x6730, 0x6F30, 0x7730, 0x7F30, 0x8730, 0x8F30, 0x9730, 0x9730,
+        0x9F30, 0xA730, 0xAF30, 0xB730, 0xBF30, 0xC730, 0xCF30, 0xD730, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0770, 0x0F70, 0x1770, 0x1F70, 0x2770, 0x2F70, 0x3770, 0x3F70, 0x4770, 0x4F70, 0x5770, 0x5F70,
+        0x6770, 0x6F70, 0x7770, 0x7F70, 0x8770, 0x8F70, 0x9770, 0x9770, 0x9F70, 0xA770, 0xAF70, 0xB770,
+        0xBF70, 0xC770, 0xCF70, 0xD770, 0x0000, 0x0000, 0x0000, 0x0000, 0x07B0, 0x0FB0, 0x17B0, 0x1FB0,
+        0x27B0, 0x2FB0, 0x37B0, 0x3FB0, 0x47B0, 0x4FB0, 0x57B0, 0x5FB0, 0x67B0, 0x6FB0, 0x77B0, 0x7FB0,
+        0x87B0, 0x8FB0, 0x97B0, 0x97B0, 0x9FB0, 0xA7B0, 0xAFB0, 0xB7B0, 0xBFB0, 0xC7B0, 0xCFB0, 0xD7B0,
+        0x0000, 0x0000, 0x0000, 0x0000,
+    },
+};
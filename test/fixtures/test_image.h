@@ -0,0 +1,144 @@
+// test_image.png, 48x40, generated by tools/gc9a01_imgconv.py
+#pragma once
+
+#include <cstdint>
+
+static const uint8_t test_image[] = {
+    0x47, 0x35, 0x36, 0x35, 0x00, 0x30, 0x00, 0x28, 0xFE, 0x01, 0x58, 0x7A, 0x69, 0x7A, 0x69, 0x7A,
+    0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79,
+    0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69,
+    0x7A, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xFE, 0x01, 0x78, 0x7A, 0x69, 0x7A,
+    0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79,
+    0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69,
+    0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0x1F, 0x7A, 0x1B, 0x7A,
+    0x17, 0x7A, 0x79, 0xC0, 0x12, 0xC0, 0x0E, 0x11, 0x0A, 0x0D, 0x10, 0x09, 0x0C, 0x05, 0x08, 0x04,
+    0xC0, 0x00, 0xC0, 0x3C, 0x3F, 0x38, 0x3B, 0x34, 0x37, 0x33, 0xC0, 0x2F, 0xC0, 0x2B, 0x2E, 0x27,
+    0x2A, 0x23, 0x26, 0x79, 0xC0, 0x79, 0x21, 0x69, 0x1D, 0x69, 0x19, 0x15, 0xFE, 0x01, 0x98, 0x7A,
+    0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x7A, 0x69, 0x7A, 0x69,
+    0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79,
+    0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xFE, 0x01,
+    0xB8, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x7A, 0x69,
+    0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79,
+    0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79,
+    0xFE, 0x01, 0xD8, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A,
+    0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79,
+    0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69,
+    0x7A, 0x79, 0x2E, 0x7A, 0x2A, 0x7A, 0x26, 0x7A, 0x79, 0xC0, 0x21, 0xC0, 0x1D, 0x20, 0x19, 0x1C,
+    0x1F, 0x18, 0x1B, 0x14, 0x17, 0x13, 0xC0, 0x0F, 0xC0, 0x0B, 0x0E, 0x07, 0x0A, 0x03, 0x06, 0x02,
+    0xC0, 0x3E, 0xC0, 0x3A, 0x3D, 0x36, 0x39, 0x32, 0x35, 0x79, 0xC0, 0x79, 0x30, 0x69, 0x2C, 0x69,
+    0x28, 0x24, 0xFE, 0x01, 0xF8, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A,
+    0x69, 0x7A, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69,
+    0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0x7A, 0x69,
+    0x7A, 0x69, 0x7A, 0x79, 0xFE, 0x02, 0x18, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0,
+    0x79, 0x7A, 0x69, 0x7A, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69,
+    0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79,
+    0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xFE, 0x02, 0x38, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0,
+    0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79,
+    0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xC0, 0x79, 0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79,
+    0xC0, 0x79, 0x7A, 0x69, 0x7A, 0x69, 0x7A, 0x79, 0xFE, 0x22, 0xD3, 0xDC, 0xFE, 0xF7, 0xDE, 0xD0,
+    0x3F, 0xDC, 0x22, 0xD0, 0x3F, 0xDC, 0x22, 0xD0, 0x3F, 0xDC, 0x22, 0xD0, 0x3F, 0xDC, 0x22, 0xD0,
+    0x3F, 0xDC, 0x22, 0xD0, 0x3F, 0xDC, 0x22, 0xD0, 0x3F, 0xDC, 0x22, 0xD0, 0x3F, 0xDC, 0x22, 0xD0,
+    0x3F, 0xDC, 0x22, 0xD0, 0xA2, 0x78, 0xC1, 0x76, 0xC1, 0x6D, 0xC1, 0x57, 0xC1, 0x1D, 0xC1, 0x3B,
+    0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B,
+    0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19,
+    0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19,
+    0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18,
+    0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18,
+    0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D,
+    0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D,
+    0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B,
+    0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B,
+    0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19,
+    0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19,
+    0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18,
+    0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18,
+    0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D,
+    0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D,
+    0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B,
+    0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B,
+    0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19,
+    0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19, 0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0x3B, 0xC1, 0x19,
+    0xC1, 0x18, 0xC1, 0x1D, 0xC1, 0xFE, 0x7E, 0x3C, 0x8E, 0x00, 0xA1, 0xEE, 0xFE, 0x9B, 0x56, 0xFE,
+    0xDA, 0x7E, 0xFE, 0x77, 0xC9, 0xFE, 0xB7, 0x0C, 0xFE, 0xAF, 0xDC, 0xFE, 0xBA, 0xB8, 0xFE, 0xD7,
+    0xAB, 0x92, 0x2F, 0xFE, 0xF6, 0xEA, 0xFE, 0x23, 0xE5, 0xFE, 0xE8, 0xE2, 0xFE, 0x47, 0x0A, 0xFE,
+    0xEC, 0x36, 0xBF, 0x7D, 0xFE, 0xA5, 0xE4, 0xFE, 0x99, 0x95, 0x8B, 0x33, 0xBE, 0x00, 0xFE, 0x83,
+    0x89, 0xFE, 0x98, 0x9E, 0xFE, 0x92, 0x4F, 0xFE, 0x43, 0x22, 0xFE, 0xF3, 0x29, 0xFE, 0x7C, 0x3C,
+    0x95, 0x51, 0xFE, 0x45, 0x44, 0x98, 0xA9, 0xFE, 0x21, 0xE8, 0xFE, 0x92, 0xC6, 0xFE, 0x4F, 0x50,
+    0xFE, 0xAA, 0xBD, 0xFE, 0x38, 0xB9, 0xFE, 0x7B, 0xD7, 0xFE, 0xDE, 0x9C, 0x8D, 0xE0, 0xFE, 0x35,
+    0x09, 0xAD, 0xCB, 0xFE, 0x51, 0xE4, 0xFE, 0xAA, 0xBF, 0xFE, 0x3A, 0xAD, 0x97, 0xC8, 0xFE, 0xA9,
+    0xDB, 0xBD, 0x71, 0x8E, 0xF7, 0xFE, 0xF2, 0xCC, 0xFE, 0xBE, 0xDD, 0xFE, 0xD0, 0x0F, 0xFE, 0xCB,
+    0xD6, 0xFE, 0xA4, 0xCD, 0xAC, 0xAF, 0xFE, 0x3F, 0x10, 0xFE, 0x70, 0xCB, 0xB7, 0x72, 0xFE, 0xEC,
+    0x7C, 0xFE, 0x0A, 0xED, 0xFE, 0x5E, 0xD5, 0xFE, 0x1C, 0xD4, 0xFE, 0x64, 0x6B, 0xFE, 0x59, 0x1D,
+    0xFE, 0x62, 0x0D, 0x9D, 0x29, 0xFE, 0x47, 0x63, 0xB6, 0xD8, 0xAD, 0x0C, 0xFE, 0x4A, 0x79, 0xFE,
+    0x10, 0x7B, 0x9B, 0x6A, 0x91, 0x84, 0xFE, 0xBD, 0x37, 0xFE, 0x1E, 0xCE, 0xA2, 0x1B, 0xFE, 0xE4,
+    0x35, 0xA2, 0xEE, 0xFE, 0x6E, 0xD2, 0xFE, 0x91, 0x41, 0xFE, 0xC3, 0x73, 0xFE, 0xEA, 0x62, 0xFE,
+    0xCF, 0xE0, 0xB6, 0x8C, 0x83, 0xB1, 0xFE, 0x6B, 0x9E, 0x8C, 0x9D, 0xFE, 0x5F, 0xD8, 0xFE, 0xFC,
+    0x77, 0xFE, 0x95, 0x8A, 0x8A, 0x5B, 0xFE, 0x88, 0x31, 0xFE, 0xE4, 0x8E, 0xAD, 0x3A, 0xB1, 0x9B,
+    0xFE, 0x26, 0xDC, 0xFE, 0x5A, 0xB2, 0xFE, 0x8E, 0x71, 0xFE, 0x6D, 0x55, 0xFE, 0xF1, 0xF4, 0xA3,
+    0x6C, 0xFE, 0x14, 0xDB, 0xFE, 0x6A, 0x9A, 0xFE, 0xB6, 0x90, 0xFE, 0x42, 0x82, 0xB3, 0x28, 0xFE,
+    0x08, 0x38, 0xFE, 0xB4, 0xE7, 0xB3, 0x9C, 0x93, 0xED, 0xFE, 0x56, 0x09, 0xFE, 0x08, 0x31, 0xFE,
+    0x10, 0xA8, 0xFE, 0xDC, 0xD7, 0x8C, 0x38, 0xFE, 0x95, 0x87, 0xB4, 0x94, 0xFE, 0x28, 0xF0, 0xFE,
+    0xCD, 0x5D, 0x82, 0xA9, 0xFE, 0x34, 0x44, 0xFE, 0xF9, 0x98, 0xBB, 0x87, 0xFE, 0x7A, 0x94, 0xFE,
+    0x22, 0x27, 0xFE, 0x14, 0xA8, 0xFE, 0x3B, 0x98, 0xFE, 0x49, 0xBC, 0xB6, 0x8C, 0xFE, 0xEA, 0xB6,
+    0xFE, 0xC7, 0xA8, 0xFE, 0x49, 0xD0, 0xFE, 0x60, 0xEC, 0xFE, 0xB8, 0xBD, 0xFE, 0xFF, 0xD9, 0xFE,
+    0x04, 0x48, 0x9B, 0x63, 0xFE, 0x8F, 0xB3, 0xFE, 0x34, 0xC4, 0x99, 0x45, 0xFE, 0x60, 0xC7, 0xB1,
+    0xC0, 0xFE, 0x72, 0x00, 0xFE, 0xED, 0xC1, 0xFE, 0x13, 0x7C, 0xFE, 0xB3, 0x8D, 0xFE, 0x84, 0x65,
+    0xFE, 0x18, 0x92, 0xFE, 0x7B, 0x98, 0xFE, 0xCA, 0xC2, 0xFE, 0xF6, 0x2C, 0xFE, 0xF0, 0x08, 0xA7,
+    0x6A, 0xFE, 0x51, 0x86, 0xA1, 0x0E, 0xFE, 0xD9, 0xF8, 0xFE, 0x14, 0x9F, 0xFE, 0xF5, 0xF1, 0xFE,
+    0xE8, 0xFF, 0x82, 0x63, 0xFE, 0x48, 0x7B, 0x5B, 0xFE, 0x4D, 0x5A, 0xFE, 0x09, 0xAC, 0xB6, 0x02,
+    0x9C, 0x9E, 0xFE, 0xBA, 0xF7, 0xFE, 0xBC, 0x7F, 0xFE, 0x11, 0xFB, 0xFE, 0x5F, 0x31, 0x81, 0xC4,
+    0xA3, 0x35, 0xFE, 0x2D, 0x30, 0xFE, 0xE1, 0xCA, 0xFE, 0xBD, 0x96, 0xFE, 0x4E, 0x10, 0xFE, 0xB4,
+    0x91, 0xFE, 0x80, 0x84, 0xFE, 0x25, 0x48, 0xFE, 0x13, 0x3E, 0xFE, 0x6E, 0x39, 0xFE, 0x6E, 0xD3,
+    0xFE, 0x4E, 0x5B, 0xFE, 0x6E, 0xEF, 0xFE, 0xAB, 0x1D, 0xFE, 0x9F, 0x13, 0xFE, 0x87, 0x88, 0xFE,
+    0xAD, 0xFB, 0xFE, 0xA8, 0x58, 0x9E, 0xED, 0xFE, 0xD3, 0x26, 0xFE, 0xFD, 0x1C, 0xFE, 0x57, 0x00,
+    0xFE, 0x81, 0x22, 0xFE, 0x0D, 0x0D, 0x80, 0xD3, 0xA4, 0x79, 0xB5, 0x77, 0xB4, 0xC9, 0x83, 0xD6,
+    0xFE, 0xFE, 0x38, 0xFE, 0x1D, 0x4E, 0xFE, 0x0A, 0x99, 0xAB, 0xC6, 0xFE, 0x99, 0x78, 0xFE, 0xB0,
+    0x44, 0xFE, 0x3B, 0x4D, 0xFE, 0x14, 0xA0, 0xA2, 0x6C, 0xFE, 0x3D, 0x79, 0x90, 0xFA, 0xFE, 0x75,
+    0x4A, 0xFE, 0x14, 0xF9, 0xFE, 0xEA, 0xC6, 0xFE, 0xD0, 0x6A, 0xAE, 0x97, 0xFE, 0xF3, 0x8B, 0xFE,
+    0xCC, 0x02, 0xFE, 0x25, 0xA3, 0xFE, 0xEE, 0x60, 0xFE, 0xF2, 0x51, 0x91, 0xBB, 0x86, 0xCA, 0xFE,
+    0x7D, 0x3B, 0xFE, 0x01, 0x45, 0xFE, 0xB6, 0xA8, 0xFE, 0xED, 0x40, 0xFE, 0xD7, 0xC4, 0xFE, 0xBD,
+    0x1E, 0xFE, 0x77, 0x43, 0x93, 0x07, 0xFE, 0x83, 0xCF, 0x8B, 0x03, 0xFE, 0xC3, 0x8C, 0xFE, 0xC1,
+    0x24, 0xFE, 0xF4, 0x95, 0xFE, 0xBA, 0x41, 0xFE, 0x6C, 0x1D, 0xFE, 0xDE, 0x24, 0xFE, 0x4D, 0x30,
+    0xFE, 0x25, 0x3B, 0x98, 0x84, 0xFE, 0xF5, 0xAD, 0xA8, 0xB8, 0xFE, 0x5C, 0x7A, 0xA1, 0x94, 0xFE,
+    0x8F, 0x18, 0xFE, 0x9D, 0x5E, 0x30, 0xFE, 0xF2, 0x2F, 0xFE, 0xEA, 0x9D, 0xFE, 0xA3, 0x24, 0xFE,
+    0xF7, 0x0A, 0xFE, 0x4C, 0xEF, 0xFE, 0x29, 0xB3, 0xFE, 0x69, 0x3B, 0xFE, 0x67, 0xC9, 0xFE, 0xD2,
+    0xEE, 0xFE, 0x0D, 0x53, 0xFE, 0xDD, 0xDF, 0xFE, 0xE3, 0x8F, 0x9C, 0xB1, 0xFE, 0x1A, 0xF4, 0xFE,
+    0x92, 0x67, 0xA9, 0x9A, 0xFE, 0x63, 0xEA, 0xFE, 0xA5, 0xEE, 0xFE, 0xE5, 0x49, 0xFE, 0x94, 0x6A,
+    0x92, 0x73, 0xFE, 0xB8, 0xDA, 0xFE, 0xEB, 0x9F, 0xFE, 0xD6, 0x10, 0xFE, 0x86, 0x45, 0xFE, 0x2A,
+    0xF0, 0xFE, 0x97, 0x22, 0xFE, 0x59, 0x5B, 0xFE, 0xD1, 0xA9, 0xFE, 0x75, 0x48, 0x98, 0xEF, 0xFE,
+    0x92, 0x84, 0xFE, 0x13, 0x3C, 0xFE, 0xED, 0x18, 0x96, 0xD1, 0x9F, 0x55, 0xFE, 0xEB, 0x38, 0xFE,
+    0x9B, 0x3A, 0xFE, 0xCC, 0xDB, 0x94, 0x97, 0xFE, 0xE7, 0x73, 0xFE, 0x53, 0x66, 0x9A, 0xF3, 0xFE,
+    0xBA, 0x1F, 0xFE, 0x45, 0x06, 0xFE, 0x98, 0xF3, 0xAD, 0xA6, 0xFE, 0xE6, 0x2E, 0xFE, 0xF0, 0x08,
+    0xFE, 0xBF, 0xB9, 0xFE, 0x45, 0xDD, 0x96, 0xD7, 0xFE, 0xB2, 0x31, 0xBE, 0xCA, 0xFE, 0x0B, 0x6F,
+    0xFE, 0x40, 0x65, 0xFE, 0x15, 0xBA, 0xFE, 0x89, 0xD3, 0xFE, 0x4E, 0x4D, 0xB2, 0xF4, 0xFE, 0x2F,
+    0xFA, 0xFE, 0x8D, 0xD6, 0xFE, 0x92, 0xAE, 0xFE, 0xE2, 0x91, 0xFE, 0x18, 0xEB, 0xFE, 0x1B, 0xD2,
+    0xFE, 0x50, 0x4B, 0xFE, 0xFC, 0xBB, 0xFE, 0x81, 0x42, 0xBA, 0x6D, 0xFE, 0x9B, 0xFB, 0xFE, 0x3C,
+    0x93, 0xFE, 0xEE, 0x19, 0xA4, 0x03, 0xFE, 0x4E, 0x37, 0xFE, 0x4D, 0x30, 0xFE, 0x93, 0x08, 0xFE,
+    0x4A, 0x91, 0xFE, 0xF8, 0x16, 0xAE, 0xDF, 0xA0, 0x43, 0xFE, 0x05, 0x24, 0xA6, 0x3F, 0xAD, 0x35,
+    0xFE, 0x40, 0x2B, 0xFE, 0x00, 0x68, 0xFE, 0x88, 0xBF, 0x81, 0x11, 0xFE, 0x8C, 0x10, 0xFE, 0x19,
+    0x16, 0xFE, 0x6C, 0x18, 0xFE, 0x6E, 0xBC, 0xFE, 0x75, 0x2C, 0xFE, 0xD3, 0x45, 0xFE, 0x3C, 0x56,
+    0xFE, 0xEB, 0xFD, 0xFE, 0x0C, 0xF8, 0xFE, 0x75, 0xAD, 0xFE, 0x58, 0x0F, 0xFE, 0x0E, 0xD4, 0xFE,
+    0x0C, 0x8C, 0x82, 0x72, 0xFE, 0xDA, 0x3B, 0xFE, 0xAC, 0x57, 0x82, 0xCD, 0xFE, 0x75, 0x8B, 0xFE,
+    0xA8, 0x12, 0xFE, 0x81, 0xA1, 0xAA, 0x86, 0xFE, 0x2A, 0x90, 0x81, 0xD5, 0xFE, 0xF7, 0x08, 0xBD,
+    0x87, 0xFE, 0x75, 0x2F, 0xFE, 0x45, 0x65, 0x85, 0x12, 0xFE, 0xC2, 0x45, 0xFE, 0x6A, 0xFE, 0xFE,
+    0x86, 0xEF, 0xFE, 0x2C, 0x2E, 0x97, 0xA9, 0xFE, 0xDF, 0x58, 0xA7, 0x6E, 0xFE, 0x78, 0x9D, 0xFE,
+    0xAF, 0x1E, 0xFE, 0x48, 0x93, 0xFE, 0x54, 0xDD, 0xFE, 0xA7, 0x4A, 0xFE, 0xF1, 0x26, 0xA2, 0x88,
+    0xFE, 0xC3, 0x12, 0xBE, 0xA5, 0xFE, 0x7B, 0x15, 0x9A, 0x27, 0xA8, 0xEC, 0xA1, 0xF9, 0xFE, 0xC0,
+    0xA5, 0x92, 0x8E, 0xAA, 0x2F, 0x80, 0x7C, 0xFE, 0x0A, 0x4B, 0xAA, 0x42, 0xFE, 0x22, 0x26, 0xFE,
+    0x06, 0xC5, 0xFE, 0x44, 0xA1, 0xFE, 0x1E, 0x39, 0xFE, 0xEB, 0xF8, 0xFE, 0xC0, 0xED, 0x8D, 0x9C,
+    0xFE, 0x08, 0x35, 0xFE, 0xE9, 0xFE, 0xFE, 0xA7, 0x23, 0xFE, 0x4C, 0x9B, 0xFE, 0xCB, 0x9B, 0xFE,
+    0x0A, 0x30, 0xFE, 0x42, 0xFE, 0xFE, 0xD3, 0x70, 0xFE, 0xE8, 0x23, 0xA0, 0x5B, 0x8B, 0x4E, 0xFE,
+    0xCF, 0x54, 0xFE, 0xBD, 0x83, 0xFE, 0xA9, 0x16, 0xFE, 0x31, 0xA5, 0xFE, 0xDA, 0x7F, 0xFE, 0x4B,
+    0xF5, 0xFE, 0xAB, 0x3A, 0xFE, 0x9A, 0x81, 0xFE, 0x90, 0x0A, 0xFE, 0x59, 0xB1, 0xFE, 0xB5, 0xEA,
+    0xFE, 0x01, 0xA3, 0x8B, 0x27, 0xFE, 0x70, 0x8E, 0xFE, 0x5E, 0x5D, 0xFE, 0xB9, 0xC2, 0x9D, 0x57,
+    0xFE, 0xEF, 0x44, 0xFE, 0x09, 0x4C, 0xFE, 0x08, 0xD5, 0xFE, 0x8A, 0x98, 0xFE, 0xD2, 0xEC, 0xFE,
+    0xC5, 0x8E, 0xA8, 0x19, 0xBE, 0x34, 0xB0, 0x35, 0xFE, 0x79, 0xFC, 0xA6, 0x84, 0x8A, 0x62, 0xFE,
+    0xC4, 0xF1, 0xFE, 0xC2, 0x0D, 0xFE, 0x27, 0x64, 0xFE, 0x91, 0x22, 0xA0, 0xB3, 0xA4, 0xE1, 0xFE,
+    0x53, 0xDE, 0xFE, 0x30, 0x69, 0xFE, 0xA8, 0x9B, 0xFE, 0x3D, 0x7A, 0xFE, 0x22, 0x66, 0xFE, 0x58,
+    0x90, 0xFE, 0x94, 0x64, 0xFE, 0x61, 0x86, 0xFE, 0x4E, 0x93, 0xA2, 0x41, 0xFE, 0xE3, 0xED, 0xFE,
+    0x0E, 0xB5, 0xFE, 0x30, 0xBE, 0xFE, 0xCA, 0xBC, 0xFE, 0xF7, 0x0F, 0x91, 0xB8, 0xFE, 0xFE, 0x7E,
+    0xFE, 0xD3, 0xF2, 0xFE, 0xCE, 0x03, 0xFE, 0x15, 0x7E, 0x8D, 0xD9, 0xFE, 0xD5, 0xE7, 0xB6, 0x0C,
+    0xFE, 0x67, 0x08, 0xFE, 0xCC, 0x20, 0xFE, 0xF2, 0x73, 0xFE, 0xC9, 0xC0, 0xFE, 0x2E, 0x15, 0x9C,
+    0x37, 0xFE, 0x48, 0x6F, 0xFE, 0xCA, 0xD8, 0xFE, 0xBC, 0xDD, 0xFE, 0x1A, 0x56, 0xFE, 0x7A, 0xD3,
+    0xFE, 0x42, 0xC3, 0xB9, 0xE6, 0xFE, 0x53, 0xCB, 0xFE, 0x0B, 0xF6,
+};
@@ -0,0 +1,169 @@
+// RGB565 pixels of test_image_ref, generated by test/fixtures/make_fixtures.py
+#pragma once
+
+#include <cstdint>
+
+static const uint16_t test_image_ref[1][1920] = {
+    {
+        0x0158, 0x0958, 0x0957, 0x1157, 0x1156, 0x1956, 0x2155, 0x2155, 0x2954, 0x2954, 0x3153, 0x3953,
+        0x3952, 0x4152, 0x4952, 0x4951, 0x5151, 0x5150, 0x5950, 0x614F, 0x614F, 0x694E, 0x694E, 0x714D,
+        0x794D, 0x794C, 0x814C, 0x814B, 0x894B, 0x914A, 0x914A, 0x9949, 0x9949, 0xA148, 0xA948, 0xA947,
+        0xB147, 0xB146, 0xB946, 0xC145, 0xC145, 0xC944, 0xD144, 0xD143, 0xD943, 0xD942, 0xE142, 0xE941,
+        0x0178, 0x0978, 0x0977, 0x1177, 0x1176, 0x1976, 0x2175, 0x2175, 0x2974, 0x2974, 0x3173, 0x3973,
+        0x3972, 0x4172, 0x4972, 0x4971, 0x5171, 0x5170, 0x5970, 0x616F, 0x616F, 0x696E, 0x696E, 0x716D,
+        0x796D, 0x796C, 0x816C, 0x816B, 0x896B, 0x916A, 0x916A, 0x9969, 0x9969, 0xA168, 0xA968, 0xA967,
+        0xB167, 0xB166, 0xB966, 0xC165, 0xC165, 0xC964, 0xD164, 0xD163, 0xD963, 0xD962, 0xE162, 0xE961,
+        0x0178, 0x0978, 0x0977, 0x1177, 0x1176, 0x1976, 0x2175, 0x2175, 0x2974, 0x2974, 0x3173, 0x3973,
+        0x3972, 0x4172, 0x4972, 0x4971, 0x5171, 0x5170, 0x5970, 0x616F, 0x616F, 0x696E, 0x696E, 0x716D,
+        0x796D, 0x796C, 0x816C, 0x816B, 0x896B, 0x916A, 0x916A, 0x9969, 0x9969, 0xA168, 0xA968, 0xA967,
+        0xB167, 0xB166, 0xB966, 0xC165, 0xC165, 0xC964, 0xD164, 0xD163, 0xD963, 0xD962, 0xE162, 0xE961,
+        0x0198, 0x0998, 0x0997, 0x1197, 0x1196, 0x1996, 0x2195, 0x2195, 0x2994, 0x2994, 0x3193, 0x3993,
+        0x3992, 0x4192, 0x4992, 0x4991, 0x5191, 0x5190, 0x5990, 0x618F, 0x618F, 0x698E, 0x698E, 0x718D,
+        0x798D, 0x798C, 0x818C, 0x818B, 0x898B, 0x918A, 0x918A, 0x9989, 0x9989, 0xA188, 0xA988, 0xA987,
+        0xB187, 0xB186, 0xB986, 0xC185, 0xC185, 0xC984, 0xD184, 0xD183, 0xD983, 0xD982, 0xE182, 0xE981,
+        0x01B8, 0x09B8, 0x09B7, 0x11B7, 0x11B6, 0x19B6, 0x21B5, 0x21B5, 0x29B4, 0x29B4, 0x31B3, 0x39B3,
+        0x39B2, 0x41B2, 0x49B2, 0x49B1, 0x51B1, 0x51B0, 0x59B0, 0x61AF, 0x61AF, 0x69AE, 0x69AE, 0x71AD,
+        0x79AD, 0x79AC, 0x81AC, 0x81AB, 0x89AB, 0x91AA, 0x91AA, 0x99A9, 0x99A9, 0xA1A8, 0xA9A8, 0xA9A7,
+        0xB1A7, 0xB1A6, 0xB9A6, 0xC1A5, 0xC1A5, 0xC9A4, 0xD1A4, 0xD1A3, 0xD9A3, 0xD9A2, 0xE1A2, 0xE9A1,
+        0x01D8, 0x09D8, 0x09D7, 0x11D7, 0x11D6, 0x19D6, 0x21D5, 0x21D5, 0x29D4, 0x29D4, 0x31D3, 0x39D3,
+        0x39D2, 0x41D2, 0x49D2, 0x49D1, 0x51D1, 0x51D0, 0x59D0, 0x61CF, 0x61CF, 0x69CE, 0x69CE, 0x71CD,
+        0x79CD, 0x79CC, 0x81CC, 0x81CB, 0x89CB, 0x91CA, 0x91CA, 0x99C9, 0x99C9, 0xA1C8, 0xA9C8, 0xA9C7,
+        0xB1C7, 0xB1C6, 0xB9C6, 0xC1C5, 0xC1C5, 0xC9C4, 0xD1C4, 0xD1C3, 0xD9C3, 0xD9C2, 0xE1C2, 0xE9C1,
+        0x01D8, 0x09D8, 0x09D7, 0x11D7, 0x11D6, 0x19D6, 0x21D5, 0x21D5, 0x29D4, 0x29D4, 0x31D3, 0x39D3,
+        0x39D2, 0x41D2, 0x49D2, 0x49D1, 0x51D1, 0x51D0, 0x59D0, 0x61CF, 0x61CF, 0x69CE, 0x69CE, 0x71CD,
+        0x79CD, 0x79CC, 0x81CC, 0x81CB, 0x89CB, 0x91CA, 0x91CA, 0x99C9, 0x99C9, 0xA1C8, 0xA9C8, 0xA9C7,
+        0xB1C7, 0xB1C6, 0xB9C6, 0xC1C5, 0xC1C5, 0xC9C4, 0xD1C4, 0xD1C3, 0xD9C3, 0xD9C2, 0xE1C2, 0xE9C1,
+        0x01F8, 0x09F8, 0x09F7, 0x11F7, 0x11F6, 0x19F6, 0x21F5, 0x21F5, 0x29F4, 0x29F4, 0x31F3, 0x39F3,
+        0x39F2, 0x41F2, 0x49F2, 0x49F1, 0x51F1, 0x51F0, 0x59F0, 0x61EF, 0x61EF, 0x69EE, 0x69EE, 0x71ED,
+        0x79ED, 0x79EC, 0x81EC, 0x81EB, 0x89EB, 0x91EA, 0x91EA, 0x99E9, 0x99E9, 0xA1E8, 0xA9E8, 0xA9E7,
+        0xB1E7, 0xB1E6, 0xB9E6, 0xC1E5, 0xC1E5, 0xC9E4, 0xD1E4, 0xD1E3, 0xD9E3, 0xD9E2, 0xE1E2, 0xE9E1,
+        0x0218, 0x0A18, 0x0A17, 0x1217, 0x1216, 0x1A16, 0x2215, 0x2215, 0x2A14, 0x2A14, 0x3213, 0x3A13,
+        0x3A12, 0x4212, 0x4A12, 0x4A11, 0x5211, 0x5210, 0x5A10, 0x620F, 0x620F, 0x6A0E, 0x6A0E, 0x720D,
+        0x7A0D, 0x7A0C, 0x820C, 0x820B, 0x8A0B, 0x920A, 0x920A, 0x9A09, 0x9A09, 0xA208, 0xAA08, 0xAA07,
+        0xB207, 0xB206, 0xBA06, 0xC205, 0xC205, 0xCA04, 0xD204, 0xD203, 0xDA03, 0xDA02, 0xE202, 0xEA01,
+        0x0238, 0x0A38, 0x0A37, 0x1237, 0x1236, 0x1A36, 0x2235, 0x2235, 0x2A34, 0x2A34, 0x3233, 0x3A33,
+        0x3A32, 0x4232, 0x4A32, 0x4A31, 0x5231, 0x5230, 0x5A30, 0x622F, 0x622F, 0x6A2E, 0x6A2E, 0x722D,
+        0x7A2D, 0x7A2C, 0x822C, 0x822B, 0x8A2B, 0x922A, 0x922A, 0x9A29, 0x9A29, 0xA228, 0xAA28, 0xAA27,
+        0xB227, 0xB226, 0xBA26, 0xC225, 0xC225, 0xCA24, 0xD224, 0xD223, 0xDA23, 0xDA22, 0xE222, 0xEA21,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3,
+        0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0x22D3, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0,
+        0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0,
+        0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0,
+        0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0,
+        0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F,
+        0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F,
+        0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F,
+        0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0,
+        0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0,
+        0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0,
+        0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0,
+        0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F,
+        0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F,
+        0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F,
+        0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0xF800, 0xF800, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x07E0, 0x07E0, 0x07E0, 0x001F, 0x001F, 0x001F, 0xFFE0, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800,
+        0x7E3C, 0xABE2, 0xE409, 0x9B56, 0xDA7E, 0x77C9, 0xB70C, 0xAFDC, 0xBAB8, 0xD7AB, 0x35E4, 0xF6EA,
+        0x23E5, 0xE8E2, 0x470A, 0xEC36, 0xD81A, 0xA5E4, 0x9995, 0xCEFB, 0x7AB1, 0x8389, 0x989E, 0x924F,
+        0x4322, 0xF329, 0x7C3C, 0x0ACA, 0x4544, 0x145D, 0x21E8, 0x92C6, 0x4F50, 0xAABD, 0x38B9, 0x7BD7,
+        0xDE9C, 0x7421, 0x3509, 0xBEB9, 0x51E4, 0xAABF, 0x3AAD, 0x1184, 0xA9DB, 0x8D71, 0x333E, 0xF2CC,
+        0xBEDD, 0xD00F, 0xCBD6, 0xA4CD, 0x1640, 0x3F10, 0x70CB, 0x23BC, 0xEC7C, 0x0AED, 0x5ED5, 0x1CD4,
+        0x646B, 0x591D, 0x620D, 0x19AB, 0x4763, 0x1A39, 0x43CA, 0x4A79, 0x107B, 0xDFD8, 0x65E5, 0xBD37,
+        0x1ECE, 0xF713, 0xE435, 0x247D, 0x6ED2, 0x9141, 0xC373, 0xEA62, 0xCFE0, 0x7ABA, 0xAF16, 0x6B9E,
+        0xD10F, 0x5FD8, 0xFC77, 0x958A, 0xCAD7, 0x8831, 0xE48E, 0x263D, 0xB051, 0x26DC, 0x5AB2, 0x8E71,
+        0x6D55, 0xF1F4, 0xFA5B, 0x14DB, 0x6A9A, 0xB690, 0x4282, 0xACF5, 0x0838, 0xB4E7, 0x575E, 0x1DB6,
+        0x5609, 0x0831, 0x10A8, 0xDCD7, 0x1243, 0x9587, 0x3817, 0x28F0, 0xCD5D, 0xE980, 0x3444, 0xF998,
+        0xD4F2, 0x7A94, 0x2227, 0x14A8, 0x3B98, 0x49BC, 0xFC76, 0xEAB6, 0xC7A8, 0x49D0, 0x60EC, 0xB8BD,
+        0xFFD9, 0x0448, 0xCBBE, 0x8FB3, 0x34C4, 0xDBFA, 0x60C7, 0x0AF0, 0x7200, 0xEDC1, 0x137C, 0xB38D,
+        0x8465, 0x1892, 0x7B98, 0xCAC2, 0xF62C, 0xF008, 0x18F1, 0x5186, 0x19AD, 0xD9F8, 0x149F, 0xF5F1,
+        0xE8FF, 0xED3C, 0x487B, 0x407C, 0x4D5A, 0x09AC, 0x7C7C, 0x63FE, 0xBAF7, 0xBC7F, 0x11FB, 0x5F31,
+        0x834E, 0x73AE, 0x2D30, 0xE1CA, 0xBD96, 0x4E10, 0xB491, 0x8084, 0x2548, 0x133E, 0x6E39, 0x6ED3,
+        0x4E5B, 0x6EEF, 0xAB1D, 0x9F13, 0x8788, 0xADFB, 0xA858, 0xC81B, 0xD326, 0xFD1C, 0x5700, 0x8122,
+        0x0D0D, 0x3108, 0x498D, 0xEC21, 0xAEB6, 0xEB17, 0xFE38, 0x1D4E, 0x0A99, 0x83E2, 0x9978, 0xB044,
+        0x3B4D, 0x14A0, 0x14E6, 0x3D79, 0xF36B, 0x754A, 0x14F9, 0xEAC6, 0xD06A, 0x4A37, 0xF38B, 0xCC02,
+        0x25A3, 0xEE60, 0xF251, 0x9065, 0xE52D, 0x7D3B, 0x0145, 0xB6A8, 0xED40, 0xD7C4, 0xBD1E, 0x7743,
+        0xCDB5, 0x83CF, 0x9935, 0xC38C, 0xC124, 0xF495, 0xBA41, 0x6C1D, 0xDE24, 0x4D30, 0x253B, 0xE42F,
+        0xF5AD, 0x4EB5, 0x5C7A, 0x6C97, 0x8F18, 0x9D5E, 0xEB17, 0xF22F, 0xEA9D, 0xA324, 0xF70A, 0x4CEF,
+        0x29B3, 0x693B, 0x67C9, 0xD2EE, 0x0D53, 0xDDDF, 0xE38F, 0xDB04, 0x1AF4, 0x9267, 0xE392, 0x63EA,
+        0xA5EE, 0xE549, 0x946A, 0x1AB7, 0xB8DA, 0xEB9F, 0xD610, 0x8645, 0x2AF0, 0x9722, 0x595B, 0xD1A9,
+        0x7548, 0x6447, 0x9284, 0x133C, 0xED18, 0xC3C7, 0xA3A3, 0xEB38, 0x9B3A, 0xCCDB, 0x734E, 0xE773,
+        0x5366, 0x5ABB, 0xBA1F, 0x4506, 0x98F3, 0x129E, 0xE62E, 0xF008, 0xBFB9, 0x45DD, 0x1C92, 0xB231,
+        0xC5F1, 0x0B6F, 0x4065, 0x15BA, 0x89D3, 0x4E4D, 0x109B, 0x2FFA, 0x8DD6, 0x92AE, 0xE291, 0x18EB,
+        0x1BD2, 0x504B, 0xFCBB, 0x8142, 0x4481, 0x9BFB, 0x3C93, 0xEE19, 0xCE98, 0x4E37, 0x4D30, 0x9308,
+        0x4A91, 0xF816, 0x91CB, 0x71C6, 0x0524, 0x0DF1, 0x4F9B, 0x402B, 0x0068, 0x88BF, 0x5CD9, 0x8C10,
+        0x1916, 0x6C18, 0x6EBC, 0x752C, 0xD345, 0x3C56, 0xEBFD, 0x0CF8, 0x75AD, 0x580F, 0x0ED4, 0x0C8C,
+        0x10C8, 0xDA3B, 0xAC57, 0xD89E, 0x758B, 0xA812, 0x81A1, 0xD2E9, 0x2A90, 0x5EAE, 0xF708, 0xDAA4,
+        0x752F, 0x4565, 0x3204, 0xC245, 0x6AFE, 0x86EF, 0x2C2E, 0xF306, 0xDF58, 0x0025, 0x789D, 0xAF1E,
+        0x4893, 0x54DD, 0xA74A, 0xF126, 0x0168, 0xC312, 0xC6CD, 0x7B15, 0x1A4E, 0x8B5A, 0xCB7C, 0xC0A5,
+        0x56FD, 0x702E, 0x6C32, 0x0A4B, 0x3B8F, 0x2226, 0x06C5, 0x44A1, 0x1E39, 0xEBF8, 0xC0ED, 0x369E,
+        0x0835, 0xE9FE, 0xA723, 0x4C9B, 0xCB9B, 0x0A30, 0x42FE, 0xD370, 0xE823, 0xD026, 0x0D97, 0xCF54,
+        0xBD83, 0xA916, 0x31A5, 0xDA7F, 0x4BF5, 0xAB3A, 0x9A81, 0x900A, 0x59B1, 0xB5EA, 0x01A3, 0x2F0D,
+        0x708E, 0x5E5D, 0xB9C2, 0x897E, 0xEF44, 0x094C, 0x08D5, 0x8A98, 0xD2EC, 0xC58E, 0xCE97, 0x9251,
+        0xEC5E, 0x79FC, 0xAABE, 0xEFE2, 0xC4F1, 0xC20D, 0x2764, 0x9122, 0xA93D, 0xF9BA, 0x53DE, 0x3069,
+        0xA89B, 0x3D7A, 0x2266, 0x5890, 0x9464, 0x6186, 0x4E93, 0x3ECE, 0xE3ED, 0x0EB5, 0x30BE, 0xCABC,
+        0xF70F, 0x9520, 0xFE7E, 0xD3F2, 0xCE03, 0x157E, 0xA30C, 0xD5E7, 0x40A1, 0x6708, 0xCC20, 0xF273,
+        0xC9C0, 0x2E15, 0xE590, 0x486F, 0xCAD8, 0xBCDD, 0x1A56, 0x7AD3, 0x42C3, 0x3DFA, 0x53CB, 0x0BF6,
+    },
+};
@@ -0,0 +1,162 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file gc9a01_test.h
+ * @brief Checks shared by the tests, which drive the driver against `GC9A01MockPanel`
+ */
+#pragma once
+
+#include <cstdio>
+#include <vector>
+
+#include "gc9a01.h"
+#include "gc9a01_mock.h"
+#include "gc9a01_private.h"
+
+static int test_failures = 0;
+
+#define CHECK(condition)                                                              \
+    do {                                                                              \
+        if (!(condition)) {                                                           \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            test_failures++;                                                          \
+        }                                                                             \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                                                      \
+    do {                                                                                                \
+        const long long actual_ = static_cast<long long>(actual);                                     \
+        const long long expected_ = static_cast<long long>(expected);                                 \
+        if (actual_ != expected_) {                                                                     \
+            std::printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, actual_, expected_); \
+            test_failures++;                                                                            \
+        }                                                                                               \
+    } while (0)
+
+/**
+ * @brief Whether the round mask sends pixel `x`, `y`, the corners outside may be skipped
+ */
+inline bool visible(const u16 x, const u16 y) {
+#ifdef CONFIG_GC9A01_ROUND_MASK
+    return x >= round_mask[y].x0 && x < round_mask[y].x1;
+#else
+    (void)x;
+    (void)y;
+    return true;
+#endif
+}
+
+/**
+ * @brief RGB565 value GRAM holds after `color16` went through the wire format of `colmod`
+ */
+inline u16 through_wire(const u8 colmod, const u16 color16) {
+    if (colmod != COLOR_MODE_MCU_12BIT) {
+        // RGB666 repeats the top bits of each channel, which gives them back
+        return color16;
+    }
+    const u32 r = color16 >> 12;
+    const u32 g = (color16 >> 7) & 0x0F;
+    const u32 b = (color16 >> 1) & 0x0F;
+    return static_cast<u16>((((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3)));
+}
+
+/**
+ * @brief Pixels of GRAM that differ from `expected`, a full screen of RGB565
+ * @param visible_only Skip the pixels outside the round mask
+ */
+inline u32 count_diff(const GC9A01MockPanel& panel, const u16* expected, const bool visible_only = false) {
+    u32 diff = 0;
+    for (u16 y = 0; y < GC9A01_HEIGHT; y++) {
+        for (u16 x = 0; x < GC9A01_WIDTH; x++) {
+            if ((!visible_only || visible(x, y)) && panel.pixel(x, y) != expected[y * GC9A01_WIDTH + x]) {
+                diff++;
+            }
+        }
+    }
+    return diff;
+}
+
+/**
+ * @brief Pixels where GRAM differs from `reference` placed at `x`, `y`, clipped to the screen
+ */
+inline u32 diff_at(const GC9A01MockPanel& panel, const u16* reference, const u16 w, const u16 h,
+                   const i32 x, const i32 y, const u8 colmod) {
+    u32 diff = 0;
+    for (i32 row = 0; row < h; row++) {
+        for (i32 col = 0; col < w; col++) {
+            const i32 sx = x + col;
+            const i32 sy = y + row;
+            if (sx >= 0 && sy >= 0 && sx < GC9A01_WIDTH && sy < GC9A01_HEIGHT
+                && panel.pixel(sx, sy) != through_wire(colmod, reference[row * w + col])) {
+                diff++;
+            }
+        }
+    }
+    return diff;
+}
+
+/**
+ * @brief Commands of the transfers recorded since the last `clear()`
+ */
+inline std::vector<u8> commands(const GC9A01MockPanel& panel) {
+    std::vector<u8> result;
+    for (const GC9A01MemoryTransport::Record& record : panel.records()) {
+        if (!record.dc) {
+            result.push_back(panel.log()[record.offset]);
+        }
+    }
+    return result;
+}
+
+/**
+ * Small font for the text tests, `' '` to `'~'` with glyphs of varying width,
+ * anti-aliased edges and runs that continue on the next row.
+ */
+struct TestFont {
+    static constexpr u8 HEIGHT = 8;
+
+    std::vector<u8> runs;
+    std::vector<GC9A01Glyph> glyphs;
+    GC9A01Font font;
+
+    // Alpha of pixel `x`, `y` of the glyph of `c`
+    static u8 alpha(const char c, const u16 x, const u16 y) {
+        static const u8 levels[5] = {0, 15, 15, 8, 3};
+        return levels[(x * 7 + y * 3 + c) % 5];
+    }
+
+    // `line_height` and `top`, the `y_offset` of every glyph, can make lines taller than the glyphs
+    explicit TestFont(const u8 line_height = HEIGHT + 2, const i8 top = 1) {
+        for (int c = ' '; c <= '~'; c++) {
+            const u8 width = c == ' ' ? 0 : 3 + c % 5;
+            glyphs.push_back({static_cast<u32>(runs.size()), width, width == 0 ? u8(0) : HEIGHT,
+                              static_cast<u8>(width + 1 + (c == ' ') * 3), static_cast<i8>(c % 2), top});
+            u8 current = 0;
+            u8 length = 0;
+            for (u16 y = 0; y < glyphs.back().height; y++) {
+                for (u16 x = 0; x < width; x++) {
+                    const u8 a = alpha(static_cast<char>(c), x, y);
+                    if (length > 0 && (a != current || length == 16)) {
+                        runs.push_back(static_cast<u8>(current << 4 | (length - 1)));
+                        length = 0;
+                    }
+                    current = a;
+                    length++;
+                }
+            }
+            if (length > 0) {
+                runs.push_back(static_cast<u8>(current << 4 | (length - 1)));
+            }
+        }
+        font = {runs.data(), glyphs.data(), ' ', '~', line_height, static_cast<u8>(top + HEIGHT - 1)};
+    }
+};
+
+/**
+ * @brief Exit code of a test, prints a summary
+ */
+inline int test_result(const char* name) {
+    std::printf("%s: %d failures\n", name, test_failures);
+    return test_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_animation.cpp
+ * @brief Animations against the frames they were converted from by `tools/gc9a01_animconv.py`,
+ *        see `fixtures/make_fixtures.py`
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gc9a01_animation.h"
+#include "gc9a01_test.h"
+
+#include "fixtures/test_anim.h"
+#include "fixtures/test_anim_ref.h"
+
+constexpr u16 FRAME_WIDTH = 32;
+constexpr u16 FRAME_HEIGHT = 32;
+
+static std::vector<u8> anim_file;
+
+static bool read_anim(void*, const u32 offset, u8* dst, const u32 size) {
+    if (offset + size > anim_file.size()) {
+        return false;
+    }
+    std::memcpy(dst, anim_file.data() + offset, size);
+    return true;
+}
+
+/**
+ * @brief Every frame of an animation shows the frame it was made from
+ *
+ * @param from_reader Read the animation through a function instead of from memory
+ */
+static void test_animations(const bool from_reader) {
+    anim_file.assign(test_anim, test_anim + sizeof(test_anim));
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    GC9A01Animation animation(display);
+    if (from_reader) {
+        CHECK_EQ(animation.open(read_anim, nullptr, anim_file.size()), GC9A01::OK);
+    } else {
+        CHECK_EQ(animation.open(test_anim, sizeof(test_anim)), GC9A01::OK);
+    }
+    CHECK_EQ(animation.width(), FRAME_WIDTH);
+    CHECK_EQ(animation.height(), FRAME_HEIGHT);
+    CHECK_EQ(animation.frame_count(), 6);
+    animation.set_position(100, 90);
+    // The panel refresh, frames are paced by its TE pulses
+    std::atomic<bool> running = true;
+    std::thread refresh([&] {
+        while (running) {
+            panel.tear();
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    });
+    for (u32 frame = 0; frame < 6; frame++) {
+        CHECK(!animation.finished());
+        const u32 shown = animation.stats().shown;
+        CHECK_EQ(animation.play_frame(), GC9A01::OK);
+        CHECK_EQ(display.sync(), GC9A01::OK);
+        // Buffer mode sends a late frame together with the next one
+        if (animation.stats().shown != shown) {
+            CHECK_EQ(diff_at(panel, test_anim_ref[frame], FRAME_WIDTH, FRAME_HEIGHT, 100, 90, COLOR_MODE_MCU_16BIT), 0);
+        }
+    }
+    running = false;
+    refresh.join();
+    CHECK_EQ(animation.stats().shown + animation.stats().dropped, 6);
+#ifndef CONFIG_GC9A01_BUFFER_MODE
+    CHECK_EQ(animation.stats().dropped, 0);
+#endif
+    // The last frame is never dropped
+    CHECK_EQ(diff_at(panel, test_anim_ref[5], FRAME_WIDTH, FRAME_HEIGHT, 100, 90, COLOR_MODE_MCU_16BIT), 0);
+    CHECK(animation.finished());
+
+    CHECK_EQ(animation.open(test_anim + 1, sizeof(test_anim) - 1), GC9A01::INVALID_ARGUMENT);
+}
+
+int main() {
+    test_animations(false);
+    test_animations(true);
+    return test_result("test_animation");
+}
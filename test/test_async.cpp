@@ -0,0 +1,155 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_async.cpp
+ * @brief Asynchronous operation: fences and buffers still on the wire
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "gc9a01_test.h"
+
+/**
+ * @brief Whether the `w` x `h` area at `x`, `y` of GRAM is all `color16`
+ */
+static bool area_is(const GC9A01MockPanel& panel, const u16 x, const u16 y, const u16 w, const u16 h, const u16 color16) {
+    for (u16 row = y; row < y + h; row++) {
+        for (u16 col = x; col < x + w; col++) {
+            if (panel.pixel(col, row) != color16) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+#ifndef CONFIG_GC9A01_BUFFER_MODE
+static void record_completion(const u32 fence, void* arg) {
+    static_cast<std::vector<u32>*>(arg)->push_back(fence);
+}
+
+/**
+ * @brief Transfers finish in queue order, a fence covers everything queued before it
+ */
+static void test_fences() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    std::vector<u32> finished;
+    display.set_completion_callback(record_completion, &finished);
+    const u16 red = Color(255, 0, 0).to_16bit();
+    // Sent from where it is, so nothing waits for the fill before it
+    static u16 bitmap[8 * 8];
+    std::fill_n(bitmap, 8 * 8, 0x4242);
+
+    display.set_async(true);
+    const u32 start = display.fence();
+    CHECK_EQ(display.fill_rect(10, 10, 8, 8, Color(255, 0, 0)), GC9A01::OK);
+    const u32 first = display.fence();
+    CHECK_EQ(display.draw_bitmap_be(30, 40, 8, 8, bitmap), GC9A01::OK);
+    const u32 second = display.fence();
+    CHECK(first > start);
+    CHECK(second > first);
+    // Only what did not fit into the queue was collected
+    CHECK_EQ(panel.in_flight(), std::min<u32>(second - start, GC9A01_QUEUE_SIZE));
+    CHECK(area_is(panel, 30, 40, 8, 8, 0));
+
+    // Collects up to the fence and not further
+    CHECK(display.is_done(first));
+    CHECK_EQ(panel.in_flight(), second - first);
+    CHECK(area_is(panel, 10, 10, 8, 8, red));
+    CHECK(area_is(panel, 30, 40, 8, 8, 0));
+    CHECK_EQ(finished.back(), first);
+
+    CHECK_EQ(display.wait(second), GC9A01::OK);
+    CHECK_EQ(panel.in_flight(), 0);
+    CHECK(area_is(panel, 30, 40, 8, 8, 0x4242));
+    CHECK_EQ(finished.back(), second);
+    // The callback saw every transaction once, in order
+    for (u32 i = 1; i < finished.size(); i++) {
+        CHECK_EQ(finished[i], finished[i - 1] + 1);
+    }
+    // Fences already passed do not block
+    CHECK(display.is_done(start));
+    CHECK_EQ(display.wait(first), GC9A01::OK);
+
+    // Synchronous calls return with their transfers sent
+    display.set_async(false);
+    CHECK_EQ(display.fill_rect(100, 100, 20, 20, Color(0, 0, 255)), GC9A01::OK);
+    CHECK_EQ(panel.in_flight(), 0);
+    CHECK(area_is(panel, 100, 100, 20, 20, Color(0, 0, 255).to_16bit()));
+    display.set_completion_callback(nullptr, nullptr);
+}
+
+/**
+ * @brief The DMA buffers are only refilled once the transfers reading them are done
+ *
+ * The mock reads a transfer when it is collected, so a buffer rewritten too early
+ * shows up in GRAM.
+ */
+static void test_buffer_reuse() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    std::vector<u16> expected(GC9A01_PIXELS);
+    // Little-endian bitmaps are staged in the ping-pong buffers
+    static u16 first[240 * 40];
+    static u16 second[240 * 40];
+    for (u32 i = 0; i < 240 * 40; i++) {
+        first[i] = static_cast<u16>(i * 3);
+        second[i] = static_cast<u16>(0xFFFF - i);
+    }
+
+    display.set_async(true);
+    // Same fill buffer, another color
+    CHECK_EQ(display.fill_rect(0, 0, 240, 60, Color(255, 0, 0)), GC9A01::OK);
+    CHECK_EQ(display.fill_rect(0, 60, 240, 60, Color(0, 255, 0)), GC9A01::OK);
+    CHECK_EQ(display.draw_bitmap(0, 120, 240, 40, first), GC9A01::OK);
+    CHECK_EQ(display.draw_bitmap(0, 160, 240, 40, second), GC9A01::OK);
+    CHECK_EQ(display.sync(), GC9A01::OK);
+
+    std::fill_n(expected.begin(), 240 * 60, Color(255, 0, 0).to_16bit());
+    std::fill_n(expected.begin() + 240 * 60, 240 * 60, Color(0, 255, 0).to_16bit());
+    std::copy_n(first, 240 * 40, expected.begin() + 240 * 120);
+    std::copy_n(second, 240 * 40, expected.begin() + 240 * 160);
+    CHECK_EQ(count_diff(panel, expected.data()), 0);
+}
+#else
+/**
+ * @brief Drawing after an asynchronous flush waits until the framebuffer was sent
+ */
+static void test_framebuffer_fence() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    const u16 red = Color(255, 0, 0).to_16bit();
+
+    display.set_async(true);
+    CHECK_EQ(display.fill(Color(255, 0, 0)), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK(panel.in_flight() > 0);
+    // Overwrites the whole framebuffer while the flush may still read it
+    CHECK_EQ(display.fill(Color(0, 0, 255)), GC9A01::OK);
+    CHECK_EQ(display.sync(), GC9A01::OK);
+    CHECK(area_is(panel, 0, 0, GC9A01_WIDTH, GC9A01_HEIGHT, red));
+
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(display.sync(), GC9A01::OK);
+    CHECK(area_is(panel, 0, 0, GC9A01_WIDTH, GC9A01_HEIGHT, Color(0, 0, 255).to_16bit()));
+}
+#endif
+
+int main() {
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    test_framebuffer_fence();
+#else
+    test_fences();
+    test_buffer_reuse();
+#endif
+    return test_result("test_async");
+}
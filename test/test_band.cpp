@@ -0,0 +1,164 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_band.cpp
+ * @brief Band mode: compositing of the display list, also when it runs out mid-frame
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "gc9a01_test.h"
+
+/**
+ * @brief Expected screen, painted in the order the calls were made
+ */
+struct Canvas {
+    std::vector<u16> pixels = std::vector<u16>(GC9A01_PIXELS);
+
+    void put(const i32 x, const i32 y, const u16 color16) {
+        if (x >= 0 && y >= 0 && x < GC9A01_WIDTH && y < GC9A01_HEIGHT) {
+            pixels[y * GC9A01_WIDTH + x] = color16;
+        }
+    }
+    void rect(const i32 x, const i32 y, const i32 w, const i32 h, const Color color) {
+        for (i32 row = y; row < y + h; row++) {
+            for (i32 col = x; col < x + w; col++) {
+                put(col, row, color.to_16bit());
+            }
+        }
+    }
+    // Same shape as the midpoint circle, see `half_width()`
+    void disc(const i32 cx, const i32 cy, const i32 r, const Color color) {
+        for (i32 dy = -r; dy <= r; dy++) {
+            for (i32 dx = -r; dx <= r; dx++) {
+                if (dx * dx + dy * dy <= r * r + r) {
+                    put(cx + dx, cy + dy, color.to_16bit());
+                }
+            }
+        }
+    }
+};
+
+/**
+ * @brief Whether GRAM shows `canvas`, only behind the glass if the round mask is on
+ */
+static u32 diff(const GC9A01MockPanel& panel, const Canvas& canvas, const bool mask) {
+    return count_diff(panel, canvas.pixels.data(), mask);
+}
+
+/**
+ * @brief Calls of one frame are composited in order, the rest of their bounding box gets the background
+ */
+static void test_compositing(const bool mask) {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(mask);
+    Canvas canvas;
+    panel.clear();
+
+    static u16 bitmap[24 * 16];
+    for (u32 i = 0; i < 24 * 16; i++) {
+        bitmap[i] = static_cast<u16>(0xF81F ^ (i * 97));
+    }
+    // A ring in a square, the key color leaves the middle transparent
+    static u16 ring[9 * 9];
+    for (u32 i = 0; i < 9 * 9; i++) {
+        const i32 dx = i % 9 - 4;
+        const i32 dy = i / 9 - 4;
+        ring[i] = dx * dx + dy * dy > 9 ? Color(0, 255, 255).to_16bit() : 0x0001;
+    }
+    const GC9A01Sprite sprite = {ring, nullptr, 9, 9, GC9A01_SPRITE_KEY, 0x0001};
+
+    CHECK_EQ(display.fill(Color(10, 10, 10)), GC9A01::OK);
+    canvas.rect(0, 0, GC9A01_WIDTH, GC9A01_HEIGHT, Color(10, 10, 10));
+    CHECK_EQ(display.fill_rect(60, 60, 120, 40, Color(255, 128, 0)), GC9A01::OK);
+    canvas.rect(60, 60, 120, 40, Color(255, 128, 0));
+    CHECK_EQ(display.fill_circle(120, 120, 50, Color(0, 0, 255)), GC9A01::OK);
+    canvas.disc(120, 120, 50, Color(0, 0, 255));
+    CHECK_EQ(display.draw_bitmap(110, 90, 24, 16, bitmap), GC9A01::OK);
+    for (u32 i = 0; i < 24 * 16; i++) {
+        canvas.put(110 + i % 24, 90 + i / 24, bitmap[i]);
+    }
+    CHECK_EQ(display.draw_sprite(100, 150, sprite), GC9A01::OK);
+    for (u32 i = 0; i < 9 * 9; i++) {
+        if (ring[i] != sprite.key) {
+            canvas.put(100 + i % 9, 150 + i / 9, ring[i]);
+        }
+    }
+    // Off-screen parts are clipped
+    CHECK_EQ(display.fill_circle(230, 10, 30, Color(0, 255, 0)), GC9A01::OK);
+    canvas.disc(230, 10, 30, Color(0, 255, 0));
+    // Nothing is sent before `flush()`
+    CHECK_EQ(panel.pixels_written(), 0);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(diff(panel, canvas, mask), 0);
+
+    // Only the bounding box of the next frame changes
+    display.set_background(Color(0, 0, 80));
+    CHECK_EQ(display.fill_rect(30, 30, 20, 20, Color(255, 255, 255)), GC9A01::OK);
+    CHECK_EQ(display.fill_rect(150, 150, 10, 10, Color(0, 255, 0)), GC9A01::OK);
+    canvas.rect(30, 30, 130, 130, Color(0, 0, 80));
+    canvas.rect(30, 30, 20, 20, Color(255, 255, 255));
+    canvas.rect(150, 150, 10, 10, Color(0, 255, 0));
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(diff(panel, canvas, mask), 0);
+}
+
+/**
+ * @brief A frame that overflows the display list keeps what the early renders sent
+ *
+ * @param bitmaps Draw single-pixel bitmaps, which fill the list of calls, else
+ *                single-pixel fills of one color, which fill the pool of fill areas
+ */
+static void test_overflow(const bool mask, const bool bitmaps) {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(mask);
+    Canvas canvas;
+    CHECK_EQ(display.fill(Color(0, 0, 0)), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+
+    display.set_background(Color(60, 60, 60));
+    CHECK_EQ(display.fill_rect(100, 100, 40, 40, Color(255, 0, 0)), GC9A01::OK);
+    static u16 dots[1500];
+    for (u32 i = 0; i < 1500; i++) {
+        dots[i] = static_cast<u16>(0x07E0 + i);
+        const i16 x = 20 + (i * 37) % 200;
+        const i16 y = 20 + (i * 11) % 60;
+        if (bitmaps) {
+            CHECK_EQ(display.draw_bitmap(x, y, 1, 1, &dots[i]), GC9A01::OK);
+            canvas.put(x, y, dots[i]);
+        } else {
+            CHECK_EQ(display.fill_rect(x, y, 1, 1, Color(255, 255, 0)), GC9A01::OK);
+            canvas.put(x, y, Color(255, 255, 0).to_16bit());
+        }
+    }
+    // The list was rendered early, the red area went out then
+    CHECK(panel.pixels_written() > 0);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+
+    // Bounding box of the frame, the pixels nothing drew to get the background
+    Canvas expected;
+    expected.rect(20, 20, 200, 120, Color(60, 60, 60));
+    expected.rect(100, 100, 40, 40, Color(255, 0, 0));
+    for (u32 i = 0; i < GC9A01_PIXELS; i++) {
+        if (canvas.pixels[i] != 0) {
+            expected.pixels[i] = canvas.pixels[i];
+        }
+    }
+    CHECK_EQ(diff(panel, expected, mask), 0);
+    CHECK_EQ(panel.pixel(120, 120), Color(255, 0, 0).to_16bit());
+}
+
+int main() {
+    for (const bool mask : {false, true}) {
+        test_compositing(mask);
+        test_overflow(mask, true);
+        test_overflow(mask, false);
+    }
+    return test_result("test_band");
+}
@@ -0,0 +1,60 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_buffer.cpp
+ * @brief Buffer mode: only the dirty rectangles are sent
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "gc9a01_test.h"
+
+/**
+ * @brief Expected screen, drawn the same way as the framebuffer
+ */
+static void fill_expected(std::vector<u16>& expected, const u16 x, const u16 y, const u16 w, const u16 h, const Color color) {
+    for (u16 row = y; row < y + h; row++) {
+        std::fill_n(expected.begin() + row * GC9A01_WIDTH + x, w, color.to_16bit());
+    }
+}
+
+/**
+ * @brief Only the dirty rectangles are sent, and only what changed in them
+ */
+static void test_dirty_rects() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    std::vector<u16> expected(GC9A01_PIXELS);
+    panel.clear();
+
+    CHECK_EQ(display.fill(Color(0, 0, 64)), GC9A01::OK);
+    fill_expected(expected, 0, 0, GC9A01_WIDTH, GC9A01_HEIGHT, Color(0, 0, 64));
+    // Nothing reaches the panel before `flush()`
+    CHECK_EQ(panel.pixels_written(), 0);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(count_diff(panel, expected.data()), 0);
+
+    // Two areas far apart stay two rectangles
+    panel.clear();
+    CHECK_EQ(display.fill_rect(10, 20, 30, 10, Color(255, 0, 0)), GC9A01::OK);
+    CHECK_EQ(display.fill_rect(180, 200, 12, 5, Color(0, 255, 0)), GC9A01::OK);
+    fill_expected(expected, 10, 20, 30, 10, Color(255, 0, 0));
+    fill_expected(expected, 180, 200, 12, 5, Color(0, 255, 0));
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(count_diff(panel, expected.data()), 0);
+    CHECK_EQ(panel.pixels_written(), 30 * 10 + 12 * 5);
+
+    // A flush with nothing drawn sends nothing
+    panel.clear();
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(panel.pixels_written(), 0);
+}
+
+int main() {
+    test_dirty_rects();
+    return test_result("test_buffer");
+}
@@ -0,0 +1,196 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_bus.cpp
+ * @brief Two displays sharing one bus, and the transfer limit of the bus
+ */
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gc9a01_bus.h"
+#include "gc9a01_test.h"
+
+#include "fixtures/test_image.h"
+
+#define SPRITE_W    40
+#define SPRITE_H    30
+#define FRAMES      6
+
+/**
+ * @brief One bus, a transfer at a time, the order they went out in
+ */
+struct Bus {
+    std::mutex lock;
+    std::vector<u8> order;
+};
+
+/**
+ * @brief Panel on `bus`, each transfer holds the bus for a while
+ */
+class BusPanel : public GC9A01MockPanel {
+public:
+    BusPanel(Bus& bus, const u8 id) : bus_(bus), id_(id) {}
+
+protected:
+    void transfer(const bool dc, const u8* data, const u32 size) override {
+        std::lock_guard<std::mutex> guard(bus_.lock);
+        std::this_thread::sleep_for(std::chrono::microseconds(20));
+        bus_.order.push_back(id_);
+        GC9A01MockPanel::transfer(dc, data, size);
+    }
+
+private:
+    Bus& bus_;
+    u8 id_;
+};
+
+static u16 sprite_pixels[SPRITE_W * SPRITE_H];
+static u8 sprite_alpha[SPRITE_W * SPRITE_H];
+
+static GC9A01Sprite make_sprite() {
+    for (u16 y = 0; y < SPRITE_H; y++) {
+        for (u16 x = 0; x < SPRITE_W; x++) {
+            sprite_pixels[y * SPRITE_W + x] = Color(x * 6, y * 8, 255 - x * 6).to_16bit();
+            sprite_alpha[y * SPRITE_W + x] = static_cast<u8>((x + y) * 4);
+        }
+    }
+    return {sprite_pixels, sprite_alpha, SPRITE_W, SPRITE_H, GC9A01_SPRITE_ALPHA8, 0};
+}
+
+/**
+ * @brief Frame `frame` of a scene that goes through every path sending from the DMA buffer
+ */
+static void draw_frame(const GC9A01& display, const u32 frame, const u8 seed) {
+    static const GC9A01Sprite sprite = make_sprite();
+    CHECK_EQ(display.fill(Color(seed, frame * 30, 0)), GC9A01::OK);
+    CHECK_EQ(display.fill_rect(20 + frame * 10, 30, 90, 70, Color(0, 0, 255 - seed)), GC9A01::OK);
+    CHECK_EQ(display.fill_circle(120, 150 - frame * 5, 40, Color(255, 255, seed)), GC9A01::OK);
+    CHECK_EQ(display.draw_image(frame * 20, 140, test_image, sizeof(test_image)), GC9A01::OK);
+    CHECK_EQ(display.draw_sprite(150, 60 + frame * 3, sprite), GC9A01::OK);
+    CHECK_EQ(display.draw_rotated(100, 100, sprite, 20, 15, frame * 250 + seed, 384), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+}
+
+/**
+ * @brief Pixels where the GRAM of `panel` and `reference` differ
+ */
+static u32 gram_diff(const GC9A01MockPanel& panel, const GC9A01MockPanel& reference) {
+    u32 diff = 0;
+    for (u16 y = 0; y < GC9A01_HEIGHT; y++) {
+        for (u16 x = 0; x < GC9A01_WIDTH; x++) {
+            diff += panel.pixel(x, y) != reference.pixel(x, y);
+        }
+    }
+    return diff;
+}
+
+/**
+ * @brief The frames of `seed` drawn alone on a bus of its own
+ */
+static void draw_reference(GC9A01MockPanel& panel, const u8 seed) {
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    for (u32 frame = 0; frame < FRAMES; frame++) {
+        draw_frame(display, frame, seed);
+    }
+}
+
+/**
+ * @brief Two displays flushing from their own threads both end up with their frames,
+ *        taking turns on the bus from start to end
+ */
+static void test_shared() {
+    Bus bus;
+    BusPanel panels[2] = {BusPanel(bus, 0), BusPanel(bus, 1)};
+    GC9A01BusScheduler scheduler;
+    GC9A01SharedTransport first(scheduler, panels[0]);
+    GC9A01SharedTransport second(scheduler, panels[1]);
+    GC9A01 displays[2] = {GC9A01(first), GC9A01(second)};
+    for (GC9A01& display : displays) {
+        CHECK_EQ(display.init(), GC9A01::OK);
+    }
+    bus.order.clear();
+
+    std::atomic<u32> ready = 0;
+    auto draw = [&](const u8 id) {
+        ready++;
+        while (ready.load() < 2) {
+            std::this_thread::yield();
+        }
+        for (u32 frame = 0; frame < FRAMES; frame++) {
+            draw_frame(displays[id], frame, id * 200);
+        }
+    };
+    std::thread threads[2] = {std::thread(draw, 0), std::thread(draw, 1)};
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (u8 id = 0; id < 2; id++) {
+        GC9A01MockPanel reference;
+        draw_reference(reference, id * 200);
+        CHECK_EQ(gram_diff(panels[id], reference), 0);
+        CHECK_EQ(panels[id].protocol_errors(), 0);
+        for (const GC9A01MemoryTransport::Record& record : panels[id].records()) {
+            CHECK(record.size <= scheduler.quantum());
+        }
+    }
+
+    // Neither display waits for the other to finish: each has a fair share of the
+    // first half of the transfers, and the bus switches between them all along
+    const std::vector<u8>& order = bus.order;
+    CHECK(order.size() > 100);
+    u32 firsts = 0;
+    for (size_t i = 0; i < order.size() / 2; i++) {
+        firsts += order[i] == 0;
+    }
+    CHECK(firsts >= order.size() / 8);
+    CHECK(firsts <= order.size() * 3 / 8);
+    u32 switches = 0;
+    for (size_t i = 1; i < order.size(); i++) {
+        switches += order[i] != order[i - 1];
+    }
+    CHECK(switches >= FRAMES * 4);
+    CHECK(scheduler.yields() > 0);
+}
+
+/**
+ * @brief No transfer goes over the limit of the bus, the frames are the same as without it
+ */
+static void test_max_transfer() {
+    GC9A01MockPanel panel;
+    panel.set_max_transfer(1000);
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    for (u32 frame = 0; frame < 2; frame++) {
+        draw_frame(display, frame, 99);
+    }
+    for (const GC9A01MemoryTransport::Record& record : panel.records()) {
+        CHECK(record.size <= 1000);
+    }
+
+    GC9A01MockPanel reference;
+    GC9A01 unlimited(reference);
+    CHECK_EQ(unlimited.init(), GC9A01::OK);
+    for (u32 frame = 0; frame < 2; frame++) {
+        draw_frame(unlimited, frame, 99);
+    }
+    CHECK_EQ(gram_diff(panel, reference), 0);
+
+    // A bus that cannot take a row of pixels is refused
+    GC9A01MockPanel narrow;
+    narrow.set_max_transfer(GC9A01_MIN_TRANSFER_SZ - 1);
+    GC9A01 refused(narrow);
+    CHECK_EQ(refused.init(), GC9A01::INVALID_ARGUMENT);
+}
+
+int main() {
+    test_shared();
+    test_max_transfer();
+    return test_result("test_bus");
+}
@@ -0,0 +1,55 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_color_modes.cpp
+ * @brief Fills and bitmaps in all three COLMOD formats
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "gc9a01_test.h"
+
+/**
+ * @brief Fills and bitmaps reach GRAM in all three COLMOD formats
+ */
+static void test_color_modes() {
+    for (const u8 colmod : {COLOR_MODE_MCU_12BIT, COLOR_MODE_MCU_16BIT, COLOR_MODE_MCU_18BIT}) {
+        GC9A01MockPanel panel;
+        GC9A01 display(panel);
+        CHECK_EQ(display.init(), GC9A01::OK);
+        CHECK_EQ(display.set_color_mode(colmod), GC9A01::OK);
+        CHECK_EQ(panel.colmod(), colmod);
+        display.set_round_mask(false);
+
+        const Color background(200, 100, 50);
+        CHECK_EQ(display.fill(background), GC9A01::OK);
+        std::vector<u16> expected(GC9A01_PIXELS, through_wire(colmod, background.to_16bit()));
+        CHECK_EQ(count_diff(panel, expected.data()), 0);
+
+        // Odd sizes and positions, so 12-bit mode ends on half a pixel pair
+        const Color red(255, 0, 0);
+        CHECK_EQ(display.fill_rect(7, 9, 31, 3, red), GC9A01::OK);
+        for (u16 y = 9; y < 12; y++) {
+            std::fill_n(expected.begin() + y * GC9A01_WIDTH + 7, 31, through_wire(colmod, red.to_16bit()));
+        }
+        static u16 bitmap[37 * 23];
+        for (u32 i = 0; i < 37 * 23; i++) {
+            bitmap[i] = static_cast<u16>(i * 2654435761u >> 16);
+        }
+        CHECK_EQ(display.draw_bitmap(101, 57, 37, 23, bitmap), GC9A01::OK);
+        for (u16 y = 0; y < 23; y++) {
+            for (u16 x = 0; x < 37; x++) {
+                expected[(57 + y) * GC9A01_WIDTH + 101 + x] = through_wire(colmod, bitmap[y * 37 + x]);
+            }
+        }
+        CHECK_EQ(count_diff(panel, expected.data()), 0);
+        CHECK_EQ(panel.protocol_errors(), 0);
+    }
+}
+
+int main() {
+    test_color_modes();
+    return test_result("test_color_modes");
+}
@@ -0,0 +1,159 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_console.cpp
+ * @brief Scrolling console, checked on what the glass shows
+ */
+
+#include <string>
+#include <vector>
+
+#include "gc9a01_console.h"
+#include "gc9a01_test.h"
+
+// Scroll area of the consoles, 20 lines
+#define TOP     40
+#define HEIGHT  160
+#define LINES   (HEIGHT / GC9A01_CONSOLE_CHAR_H)
+
+/**
+ * @brief Rows of the glass where `panel` shows something else than `reference`
+ */
+static u32 shown_diff(const GC9A01MockPanel& panel, const GC9A01MockPanel& reference) {
+    u32 rows = 0;
+    for (u16 y = 0; y < GC9A01_HEIGHT; y++) {
+        for (u16 x = 0; x < GC9A01_WIDTH; x++) {
+            if (panel.shown_pixel(x, y) != reference.shown_pixel(x, y)) {
+                rows++;
+                break;
+            }
+        }
+    }
+    return rows;
+}
+
+/**
+ * @brief Pixels of the foreground color shown in the console rows
+ */
+static u32 ink(const GC9A01MockPanel& panel) {
+    u32 count = 0;
+    for (u16 y = TOP; y < TOP + HEIGHT; y++) {
+        for (u16 x = 0; x < GC9A01_WIDTH; x++) {
+            count += panel.shown_pixel(x, y) == Color(255, 255, 255).to_16bit();
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief A fresh console holding `lines` without scrolling, what a scrolled one has to show
+ */
+static void print_reference(GC9A01MockPanel& panel, const std::vector<std::string>& lines) {
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    GC9A01Console console(display);
+    CHECK_EQ(console.begin(TOP, HEIGHT), GC9A01::OK);
+    for (const std::string& line : lines) {
+        CHECK_EQ(console.print(line.c_str()), GC9A01::OK);
+    }
+}
+
+/**
+ * @brief Nothing is drawn before `begin()`
+ */
+static void test_before_begin() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    GC9A01Console console(display);
+    panel.clear();
+    CHECK_EQ(console.print("hello"), GC9A01::INVALID_ARGUMENT);
+    CHECK_EQ(console.printf("%d", 42), GC9A01::INVALID_ARGUMENT);
+    CHECK_EQ(panel.pixels_written(), 0);
+    CHECK_EQ(console.begin(0, GC9A01_CONSOLE_CHAR_H - 1), GC9A01::INVALID_ARGUMENT);
+    CHECK_EQ(console.begin(200, 80), GC9A01::INVALID_ARGUMENT);
+}
+
+/**
+ * @brief Once full, each line scrolls the area by one line and costs one line of pixels
+ */
+static void test_scroll() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    GC9A01Console console(display);
+    CHECK_EQ(console.begin(TOP, HEIGHT), GC9A01::OK);
+
+    std::vector<std::string> printed;
+    for (u16 i = 0; i < LINES; i++) {
+        printed.push_back("line " + std::to_string(i));
+        CHECK_EQ(console.print(printed.back().c_str()), GC9A01::OK);
+    }
+    CHECK_EQ(panel.scroll_start(), TOP);
+    for (u16 i = LINES; i < 2 * LINES + 7; i++) {
+        printed.push_back("line " + std::to_string(i));
+        panel.clear();
+        CHECK_EQ(console.printf("line %u", i), GC9A01::OK);
+        CHECK_EQ(panel.pixels_written(), GC9A01_WIDTH * GC9A01_CONSOLE_CHAR_H);
+        // The oldest line left is at the top of the area
+        CHECK_EQ(panel.scroll_start(), TOP + (i + 1) % LINES * GC9A01_CONSOLE_CHAR_H);
+    }
+
+    GC9A01MockPanel reference;
+    print_reference(reference, std::vector<std::string>(printed.end() - LINES, printed.end()));
+    CHECK_EQ(shown_diff(panel, reference), 0);
+    CHECK(ink(panel) > 0);
+}
+
+/**
+ * @brief Long lines wrap, `\n` splits lines, a trailing one adds none
+ */
+static void test_wrap() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    GC9A01Console console(display);
+    CHECK_EQ(console.begin(TOP, HEIGHT), GC9A01::OK);
+
+    // Scrolled before the long line comes, so it wraps across the end of GRAM
+    for (u16 i = 0; i < LINES - 1; i++) {
+        CHECK_EQ(console.printf("%u", i), GC9A01::OK);
+    }
+    const std::string long_line(GC9A01_CONSOLE_COLUMNS + 5, 'W');
+    CHECK_EQ(console.print(long_line.c_str()), GC9A01::OK);
+    CHECK_EQ(console.print("first\n\nthird\n"), GC9A01::OK);
+    CHECK_EQ(console.print("last"), GC9A01::OK);
+
+    std::vector<std::string> shown;
+    for (u16 i = 0; i < LINES - 1; i++) {
+        shown.push_back(std::to_string(i));
+    }
+    shown.push_back(long_line.substr(0, GC9A01_CONSOLE_COLUMNS));
+    shown.push_back(long_line.substr(GC9A01_CONSOLE_COLUMNS));
+    shown.push_back("first");
+    shown.push_back("");
+    shown.push_back("third");
+    shown.push_back("last");
+    CHECK_EQ(panel.scroll_start(), TOP + (shown.size() % LINES) * GC9A01_CONSOLE_CHAR_H);
+
+    GC9A01MockPanel reference;
+    print_reference(reference, std::vector<std::string>(shown.end() - LINES, shown.end()));
+    CHECK_EQ(shown_diff(panel, reference), 0);
+    CHECK(ink(panel) > 0);
+
+    // `clear()` starts again at the top
+    CHECK_EQ(console.clear(), GC9A01::OK);
+    CHECK_EQ(panel.scroll_start(), TOP);
+    CHECK_EQ(ink(panel), 0);
+}
+
+int main() {
+    test_before_begin();
+    test_scroll();
+    test_wrap();
+    return test_result("test_console");
+}
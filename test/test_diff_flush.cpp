@@ -0,0 +1,63 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_diff_flush.cpp
+ * @brief Diff flush: only the pixels that changed since the last flush are sent
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "gc9a01_test.h"
+
+/**
+ * @brief Expected screen, drawn the same way as the framebuffer
+ */
+static void fill_expected(std::vector<u16>& expected, const u16 x, const u16 y, const u16 w, const u16 h, const Color color) {
+    for (u16 row = y; row < y + h; row++) {
+        std::fill_n(expected.begin() + row * GC9A01_WIDTH + x, w, color.to_16bit());
+    }
+}
+
+/**
+ * @brief Redrawing a whole frame only sends the pixels that differ from the last one
+ */
+static void test_diff_flush() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    std::vector<u16> expected(GC9A01_PIXELS);
+
+    const auto draw_frame = [&](const i16 needle) {
+        display.fill(Color(20, 20, 20));
+        display.fill_rect(40, 40, 160, 20, Color(255, 255, 0));
+        display.fill_rect(needle, 100, 2, 60, Color(255, 0, 0));
+    };
+    draw_frame(100);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+
+    panel.clear();
+    draw_frame(103);
+    fill_expected(expected, 0, 0, GC9A01_WIDTH, GC9A01_HEIGHT, Color(20, 20, 20));
+    fill_expected(expected, 40, 40, 160, 20, Color(255, 255, 0));
+    fill_expected(expected, 103, 100, 2, 60, Color(255, 0, 0));
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(count_diff(panel, expected.data()), 0);
+    // The old and the new needle, with the pixels between them if that is cheaper than a window
+    CHECK(panel.pixels_written() >= 4 * 60);
+    CHECK(panel.pixels_written() <= 5 * 60);
+
+    // The same frame again sends no pixels at all
+    panel.clear();
+    draw_frame(103);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(panel.pixels_written(), 0);
+    CHECK_EQ(count_diff(panel, expected.data()), 0);
+}
+
+int main() {
+    test_diff_flush();
+    return test_result("test_diff_flush");
+}
@@ -0,0 +1,140 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_frame.cpp
+ * @brief Frame pacing of `present()` against TE pulses from another thread
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "gc9a01_test.h"
+
+// 25 fps, a TE pulse every 4 ms
+#define FRAME_RATE      25
+#define FRAME_PERIOD_US (1000000 / FRAME_RATE)
+#define TEAR_PERIOD_MS  4
+
+/**
+ * @brief The panel refresh, pulses TE until destroyed
+ */
+struct Refresh {
+    GC9A01MockPanel& panel;
+    std::atomic<bool> running = true;
+    std::thread thread;
+
+    explicit Refresh(GC9A01MockPanel& panel) : panel(panel), thread([this] {
+        while (running) {
+            this->panel.tear();
+            std::this_thread::sleep_for(std::chrono::milliseconds(TEAR_PERIOD_MS));
+        }
+    }) {}
+    ~Refresh() {
+        running = false;
+        thread.join();
+    }
+};
+
+/**
+ * @brief Frames follow the pulses at the set rate, late ones count the slots they missed
+ */
+static void test_pacing() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    CHECK(panel.tear_on());
+    display.set_frame_rate(FRAME_RATE);
+    display.reset_frame_stats();
+
+    {
+        Refresh refresh(panel);
+        for (u32 frame = 0; frame < 10; frame++) {
+            CHECK_EQ(display.fill_rect(0, 0, 40, 40, Color(frame * 20, 0, 0)), GC9A01::OK);
+            const u32 tears = panel.tears();
+            CHECK_EQ(display.present(), GC9A01::OK);
+            // Sent on a pulse that came during the call
+            CHECK(panel.tears() > tears);
+        }
+        const GC9A01::FrameStats& stats = display.frame_stats();
+        CHECK_EQ(stats.presented, 10);
+        CHECK_EQ(stats.missed, 0);
+        CHECK_EQ(stats.tear_timeouts, 0);
+        // Never earlier than a quarter period before the slot
+        CHECK(stats.last_interval_us >= FRAME_PERIOD_US * 3 / 4);
+        CHECK(stats.max_interval_us < FRAME_PERIOD_US * 3 / 2);
+
+        // Drawing took 100 ms, two and a half periods: two slots passed without a frame
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        CHECK_EQ(display.present(), GC9A01::OK);
+        CHECK_EQ(stats.presented, 11);
+        CHECK_EQ(stats.missed, 2);
+        CHECK(stats.max_interval_us >= 100000);
+        CHECK_EQ(stats.last_interval_us, stats.max_interval_us);
+
+        // The next slot is a period after the late frame, not on the old grid
+        CHECK_EQ(display.present(), GC9A01::OK);
+        CHECK_EQ(stats.missed, 2);
+        CHECK(stats.last_interval_us >= FRAME_PERIOD_US * 3 / 4);
+    }
+
+    // Without pulses each call gives up after the timeout and sends anyway
+    const u32 pixels = panel.pixels_written();
+    CHECK_EQ(display.fill_rect(0, 0, 40, 40, Color(0, 255, 0)), GC9A01::OK);
+    CHECK_EQ(display.present(), GC9A01::OK);
+    CHECK_EQ(display.present(), GC9A01::OK);
+    const GC9A01::FrameStats& stats = display.frame_stats();
+    CHECK_EQ(stats.presented, 14);
+    CHECK_EQ(stats.tear_timeouts, 2);
+    CHECK(stats.last_interval_us >= GC9A01_TEAR_TIMEOUT_MS * 1000);
+    CHECK(panel.pixels_written() > pixels);
+    CHECK_EQ(panel.pixel(20, 20), Color(0, 255, 0).to_16bit());
+
+    display.reset_frame_stats();
+    CHECK_EQ(display.frame_stats().presented, 0);
+    CHECK_EQ(display.frame_stats().missed, 0);
+    CHECK_EQ(display.frame_stats().tear_timeouts, 0);
+    CHECK_EQ(display.frame_stats().max_interval_us, 0);
+}
+
+/**
+ * @brief At rate 0 every pulse may carry a frame
+ */
+static void test_every_pulse() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_frame_rate(0);
+    Refresh refresh(panel);
+    for (u32 frame = 0; frame < 10; frame++) {
+        CHECK_EQ(display.present(), GC9A01::OK);
+    }
+    CHECK_EQ(display.frame_stats().presented, 10);
+    CHECK_EQ(display.frame_stats().missed, 0);
+    CHECK_EQ(display.frame_stats().tear_timeouts, 0);
+    CHECK(display.frame_stats().max_interval_us < GC9A01_TEAR_TIMEOUT_MS * 1000);
+}
+
+/**
+ * @brief The TE scanline reaches the panel, off-screen lines are refused
+ */
+static void test_tear_scanline() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    CHECK_EQ(panel.tear_scanline(), 0);
+    CHECK_EQ(display.set_tear_scanline(180), GC9A01::OK);
+    CHECK_EQ(panel.tear_scanline(), 180);
+    CHECK_EQ(display.set_tear_scanline(GC9A01_HEIGHT), GC9A01::INVALID_ARGUMENT);
+    CHECK_EQ(panel.tear_scanline(), 180);
+    CHECK_EQ(panel.protocol_errors(), 0);
+}
+
+int main() {
+    test_pacing();
+    test_every_pulse();
+    test_tear_scanline();
+    return test_result("test_frame");
+}
@@ -0,0 +1,46 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_image.cpp
+ * @brief Images against the pixels they were converted from by `tools/gc9a01_imgconv.py`,
+ *        see `fixtures/make_fixtures.py`
+ */
+
+#include "gc9a01_test.h"
+
+#include "fixtures/test_image.h"
+#include "fixtures/test_image_ref.h"
+
+constexpr u16 IMAGE_WIDTH = 48;
+constexpr u16 IMAGE_HEIGHT = 40;
+
+/**
+ * @brief Images decode to the pixels they were made from, also when clipped
+ */
+static void test_images() {
+    const i16 positions[][2] = {{0, 0}, {100, 77}, {-20, -13}, {215, 221}};
+    for (const u8 colmod : {COLOR_MODE_MCU_12BIT, COLOR_MODE_MCU_16BIT, COLOR_MODE_MCU_18BIT}) {
+        for (const auto& position : positions) {
+            GC9A01MockPanel panel;
+            GC9A01 display(panel);
+            CHECK_EQ(display.init(), GC9A01::OK);
+            CHECK_EQ(display.set_color_mode(colmod), GC9A01::OK);
+            display.set_round_mask(false);
+            CHECK_EQ(display.draw_image(position[0], position[1], test_image, sizeof(test_image)), GC9A01::OK);
+            CHECK_EQ(display.flush(), GC9A01::OK);
+            CHECK_EQ(diff_at(panel, test_image_ref[0], IMAGE_WIDTH, IMAGE_HEIGHT, position[0], position[1], colmod), 0);
+        }
+    }
+
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    CHECK_EQ(display.draw_image(0, 0, test_image + 1, sizeof(test_image) - 1), GC9A01::INVALID_ARGUMENT);
+    CHECK_EQ(display.draw_image(0, 0, test_image, 5), GC9A01::INVALID_ARGUMENT);
+}
+
+int main() {
+    test_images();
+    return test_result("test_image");
+}
@@ -0,0 +1,133 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_init.cpp
+ * @brief The initialization stream as the panel decodes it
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "gc9a01_test.h"
+
+/**
+ * @brief Position of the first `command` in `sent`, `sent.size()` if it is missing
+ */
+static size_t position(const std::vector<u8>& sent, const u8 command) {
+    return std::find(sent.begin(), sent.end(), command) - sent.begin();
+}
+
+/**
+ * @brief Parameters sent with the first `command` recorded
+ */
+static std::vector<u8> parameters(const GC9A01MockPanel& panel, const u8 command) {
+    const std::vector<GC9A01MemoryTransport::Record>& records = panel.records();
+    for (size_t i = 0; i < records.size(); i++) {
+        if (!records[i].dc && panel.log()[records[i].offset] == command) {
+            if (i + 1 < records.size() && records[i + 1].dc) {
+                const u8* data = &panel.log()[records[i + 1].offset];
+                return std::vector<u8>(data, data + records[i + 1].size);
+            }
+            return {};
+        }
+    }
+    return {};
+}
+
+/**
+ * @brief The panel leaves sleep with the configured color mode and the TE output on, and shows a cleared GRAM
+ */
+static void test_init_stream() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK(panel.sleeping());
+    CHECK(!panel.display_on());
+    CHECK_EQ(display.init(), GC9A01::OK);
+
+    CHECK(!panel.sleeping());
+    CHECK(panel.display_on());
+    CHECK(panel.inverted());
+    CHECK(panel.reset_level());
+    CHECK_EQ(panel.colmod(), CONFIG_GC9A01_COLOR_MODE & 0x07);
+    CHECK_EQ(panel.madctl(), 0x08);
+    // TEON with V-blank pulses only
+    CHECK(panel.tear_on());
+    CHECK_EQ(panel.tear_mode(), 0);
+    CHECK(parameters(panel, CMD_TEARING_ON) == std::vector<u8>{0x00});
+    CHECK(parameters(panel, CMD_COLMOD) == std::vector<u8>{CONFIG_GC9A01_COLOR_MODE});
+    // Every parameter was expected by its command
+    CHECK_EQ(panel.protocol_errors(), 0);
+
+    const std::vector<u8> sent = commands(panel);
+    const size_t colmod = position(sent, CMD_COLMOD);
+    const size_t teon = position(sent, CMD_TEARING_ON);
+    const size_t slpout = position(sent, CMD_SLEEP_OFF);
+    const size_t ramwr = position(sent, CMD_MEMORY_WRITE);
+    CHECK(colmod < sent.size());
+    CHECK(teon < sent.size());
+    CHECK(slpout < sent.size());
+    CHECK(ramwr < sent.size());
+    // Configured before leaving sleep, GRAM cleared while the panel wakes up
+    CHECK(colmod < slpout);
+    CHECK(teon < slpout);
+    CHECK(ramwr < slpout);
+    CHECK_EQ(std::count(sent.begin(), sent.end(), CMD_SLEEP_OFF), 1);
+    // Turned on last, once GRAM holds a defined image
+    CHECK(!sent.empty() && sent.back() == CMD_DISPLAY_ON);
+    CHECK_EQ(std::count(sent.begin(), sent.end(), CMD_DISPLAY_ON), 1);
+}
+
+/**
+ * @brief A second initialization resets the panel and clears what was drawn
+ */
+static void test_reinit() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    CHECK_EQ(display.fill(Color(255, 0, 0)), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(panel.pixel(0, 0), Color(255, 0, 0).to_16bit());
+
+    panel.clear();
+    CHECK_EQ(display.init(), GC9A01::OK);
+    CHECK(!panel.sleeping());
+    CHECK(panel.display_on());
+    CHECK_EQ(panel.protocol_errors(), 0);
+    u32 left = 0;
+    for (u16 y = 0; y < GC9A01_HEIGHT; y++) {
+        for (u16 x = 0; x < GC9A01_WIDTH; x++) {
+            left += visible(x, y) && panel.pixel(x, y) != 0;
+        }
+    }
+    CHECK_EQ(left, 0);
+}
+
+/**
+ * @brief The background initialization leaves the panel in the same state
+ */
+static void test_init_async() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.wait_ready(0), GC9A01::INVALID_ARGUMENT);
+    CHECK_EQ(display.init_async(), GC9A01::OK);
+    CHECK_EQ(display.wait_ready(), GC9A01::OK);
+    // Later calls return at once
+    CHECK_EQ(display.wait_ready(0), GC9A01::OK);
+
+    CHECK(!panel.sleeping());
+    CHECK(panel.display_on());
+    CHECK(panel.tear_on());
+    CHECK_EQ(panel.colmod(), CONFIG_GC9A01_COLOR_MODE & 0x07);
+    CHECK_EQ(panel.protocol_errors(), 0);
+    const std::vector<u8> sent = commands(panel);
+    CHECK(!sent.empty() && sent.back() == CMD_DISPLAY_ON);
+}
+
+int main() {
+    test_init_stream();
+    test_reinit();
+    test_init_async();
+    return test_result("test_init");
+}
@@ -0,0 +1,178 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_queue.cpp
+ * @brief Several threads drawing through a command queue, against the same calls made directly
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gc9a01_queue.h"
+#include "gc9a01_test.h"
+
+#include "fixtures/test_image.h"
+
+#define PRODUCERS   4
+#define ROUNDS      24
+#define BAND_TOP    20
+#define BAND_HEIGHT 45
+#define SPRITE_W    20
+#define SPRITE_H    16
+
+static const TestFont test_font;
+static u16 sprite_pixels[SPRITE_W * SPRITE_H];
+
+static GC9A01Sprite make_sprite() {
+    for (u16 y = 0; y < SPRITE_H; y++) {
+        for (u16 x = 0; x < SPRITE_W; x++) {
+            // The key color is a diagonal stripe
+            sprite_pixels[y * SPRITE_W + x] = (x + y) % 7 == 0 ? 0xF81F : Color(x * 12, 255 - y * 15, 90).to_16bit();
+        }
+    }
+    return {sprite_pixels, nullptr, SPRITE_W, SPRITE_H, GC9A01_SPRITE_KEY, 0xF81F};
+}
+
+static const GC9A01Sprite sprite = make_sprite();
+
+// Outline drawn through `call()`
+struct Frame {
+    i16 x;
+    i16 y;
+    Color color;
+};
+
+static GC9A01::Error draw_frame(GC9A01& display, void* arg) {
+    const Frame* frame = static_cast<const Frame*>(arg);
+    return display.draw_round_rect(frame->x, frame->y, 40, 20, 5, frame->color);
+}
+
+/**
+ * @brief Round `round` of producer `id`, drawn on `target`, a queue or a display
+ *
+ * Each producer keeps to a band of its own, so only the order of its own calls matters.
+ */
+template <class Target>
+static void draw_round(Target& target, const u16 id, const u16 round, const std::string& text, Frame& frame) {
+    const i16 top = BAND_TOP + id * BAND_HEIGHT;
+    const Color color(id * 60, round * 10, 255 - round * 10);
+    CHECK_EQ(target.fill_rect(10, top, 220, BAND_HEIGHT, color), GC9A01::OK);
+    CHECK_EQ(target.draw_text(15, top + 2, text.c_str(), test_font.font, Color(255, 255, 255), color), GC9A01::OK);
+    CHECK_EQ(target.draw_image(150 + round % 4, top + 2, test_image, sizeof(test_image)), GC9A01::OK);
+    CHECK_EQ(target.draw_sprite(100, top + 20 + round % 5, sprite, color), GC9A01::OK);
+    CHECK_EQ(target.draw_rotated(40, top + 30, sprite, 10, 8, round * 150 + id * 45, 256 + id * 32, color), GC9A01::OK);
+    CHECK_EQ(target.draw_line(10, top, 229, top + BAND_HEIGHT - 1, Color(255, 0, 0)), GC9A01::OK);
+    frame = {static_cast<i16>(60 + round), static_cast<i16>(top + 20), Color(0, 255, round * 10)};
+    CHECK_EQ(target.call(draw_frame, &frame), GC9A01::OK);
+}
+
+/**
+ * @brief Lets a display take the calls of a queue, `call()` included
+ */
+struct Direct {
+    GC9A01& display;
+
+    GC9A01::Error fill_rect(i16 x, i16 y, u16 w, u16 h, Color color) { return display.fill_rect(x, y, w, h, color); }
+    GC9A01::Error draw_text(i16 x, i16 y, const char* text, const GC9A01Font& font, Color color, Color background) {
+        return display.draw_text(x, y, text, font, color, background);
+    }
+    GC9A01::Error draw_image(i16 x, i16 y, const u8* image, u32 size) { return display.draw_image(x, y, image, size); }
+    GC9A01::Error draw_sprite(i16 x, i16 y, const GC9A01Sprite& s, Color background) {
+        return display.draw_sprite(x, y, s, background);
+    }
+    GC9A01::Error draw_rotated(i16 x, i16 y, const GC9A01Sprite& s, i16 px, i16 py, i16 angle, u16 scale, Color background) {
+        return display.draw_rotated(x, y, s, px, py, angle, scale, background);
+    }
+    GC9A01::Error draw_line(i16 x0, i16 y0, i16 x1, i16 y1, Color color) { return display.draw_line(x0, y0, x1, y1, color); }
+    GC9A01::Error call(GC9A01CommandQueue::Function function, void* arg) { return function(display, arg); }
+};
+
+static std::string label(const u16 id, const u16 round) {
+    return "Task " + std::to_string(id) + " round " + std::to_string(round);
+}
+
+/**
+ * @brief What the producers submit ends up in GRAM as if the calls were made directly
+ */
+static void test_producers() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    GC9A01CommandQueue queue(display);
+    CHECK_EQ(queue.begin(), GC9A01::OK);
+    CHECK_EQ(queue.set_rotation(2), GC9A01::OK);
+
+    std::vector<std::thread> producers;
+    for (u16 id = 0; id < PRODUCERS; id++) {
+        producers.emplace_back([&queue, id] {
+            // Strings and frames stay untouched until `sync()` returned
+            std::vector<std::string> texts(ROUNDS);
+            std::vector<Frame> frames(ROUNDS);
+            for (u16 round = 0; round < ROUNDS; round++) {
+                texts[round] = label(id, round);
+                draw_round(queue, id, round, texts[round], frames[round]);
+            }
+            CHECK_EQ(queue.sync(), GC9A01::OK);
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    CHECK_EQ(queue.flush(), GC9A01::OK);
+    CHECK_EQ(queue.sync(), GC9A01::OK);
+    CHECK_EQ(queue.error(), GC9A01::OK);
+    queue.end();
+
+    GC9A01MockPanel reference;
+    GC9A01 direct(reference);
+    CHECK_EQ(direct.init(), GC9A01::OK);
+    direct.set_round_mask(false);
+    CHECK_EQ(direct.set_rotation(2), GC9A01::OK);
+    Direct target{direct};
+    for (u16 id = 0; id < PRODUCERS; id++) {
+        for (u16 round = 0; round < ROUNDS; round++) {
+            Frame frame;
+            draw_round(target, id, round, label(id, round), frame);
+        }
+    }
+    CHECK_EQ(direct.flush(), GC9A01::OK);
+
+    CHECK_EQ(panel.madctl(), reference.madctl());
+    u32 diff = 0;
+    u32 drawn = 0;
+    for (u16 y = 0; y < GC9A01_HEIGHT; y++) {
+        for (u16 x = 0; x < GC9A01_WIDTH; x++) {
+            diff += panel.pixel(x, y) != reference.pixel(x, y);
+            drawn += reference.pixel(x, y) != 0;
+        }
+    }
+    CHECK_EQ(diff, 0);
+    CHECK(drawn > PRODUCERS * 200 * BAND_HEIGHT / 2);
+}
+
+/**
+ * @brief Errors of commands are kept for `error()`, the queue goes on
+ */
+static void test_errors() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    GC9A01CommandQueue queue(display);
+    CHECK_EQ(queue.begin(), GC9A01::OK);
+    CHECK_EQ(queue.draw_image(0, 0, test_image, 5), GC9A01::OK);
+    CHECK_EQ(queue.fill_rect(100, 100, 4, 4, Color(255, 255, 255)), GC9A01::OK);
+    CHECK_EQ(queue.flush(), GC9A01::OK);
+    CHECK_EQ(queue.sync(), GC9A01::OK);
+    CHECK_EQ(queue.error(), GC9A01::INVALID_ARGUMENT);
+    CHECK_EQ(queue.error(), GC9A01::OK);
+    CHECK_EQ(panel.pixel(101, 101), Color(255, 255, 255).to_16bit());
+}
+
+int main() {
+    test_producers();
+    test_errors();
+    return test_result("test_queue");
+}
@@ -0,0 +1,273 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_rotated.cpp
+ * @brief Rotated and scaled sprites against an inverse mapping in floating point
+ */
+
+#include <cmath>
+
+#include "gc9a01_test.h"
+
+#define SPRITE_W    32
+#define SPRITE_H    24
+#define KEY         0xFFFF
+
+// What lies beneath the sprite
+static const Color PAPER(20, 60, 100);
+
+static u16 sprite_pixels[SPRITE_W * SPRITE_H];
+static u8 sprite_alpha[SPRITE_W * SPRITE_H];
+
+/**
+ * @brief A sprite whose pixels all differ from their neighbours, with transparent holes
+ */
+static void make_sprite() {
+    for (u16 y = 0; y < SPRITE_H; y++) {
+        for (u16 x = 0; x < SPRITE_W; x++) {
+            const bool hole = (x * 3 + y * 5) % 11 == 0;
+            sprite_pixels[y * SPRITE_W + x] = hole ? KEY : static_cast<u16>(x << 11 | y << 5 | ((x + y) & 31));
+            sprite_alpha[y * SPRITE_W + x] = static_cast<u8>(hole ? 0 : (x * 8 + y * 5) & 0xFF);
+        }
+    }
+}
+
+/**
+ * @brief RGB565 `fg` over `bg` with the weight `a` from 0 to 32, per channel
+ */
+static u16 blend(const u16 fg, const u16 bg, const u32 a) {
+    const auto mix = [a](const u32 f, const u32 b) {
+        return static_cast<u32>(static_cast<i32>(b) + ((static_cast<i32>(f) - static_cast<i32>(b)) * static_cast<i32>(a) >> 5));
+    };
+    const u32 r = mix(fg >> 11, bg >> 11);
+    const u32 g = mix((fg >> 5) & 0x3F, (bg >> 5) & 0x3F);
+    const u32 b = mix(fg & 0x1F, bg & 0x1F);
+    return static_cast<u16>(r << 11 | g << 5 | b);
+}
+
+struct Case {
+    i16 x;
+    i16 y;
+    i16 pivot_x;
+    i16 pivot_y;
+    i16 angle;
+    u16 scale;
+};
+
+/**
+ * @brief Result of comparing GRAM with the reference mapping
+ */
+struct Outcome {
+    // Pixels of the sprite that are not transparent
+    u32 covered = 0;
+    // Pixels whose sample lies so close to a pixel edge that the rounding of either side is fine
+    u32 loose = 0;
+    // Pixels that differ from the reference, loose ones left out
+    u32 diff = 0;
+    // Bounding box of the covered and loose pixels, `x1` and `y1` exclusive
+    i32 x0 = GC9A01_WIDTH;
+    i32 y0 = GC9A01_HEIGHT;
+    i32 x1 = 0;
+    i32 y1 = 0;
+};
+
+/**
+ * @brief Map every screen pixel back into the sprite and compare GRAM with what it samples
+ */
+static Outcome compare(const GC9A01MockPanel& panel, const GC9A01Sprite& sprite, const Case& t, const u8 colmod) {
+    const double c = cos_q15_fine(t.angle) / 32768.0;
+    const double s = sin_q15_fine(t.angle) / 32768.0;
+    const double k = 256.0 / t.scale;
+    const u16 paper = PAPER.to_16bit();
+    Outcome out;
+    for (i32 row = 0; row < GC9A01_HEIGHT; row++) {
+        for (i32 col = 0; col < GC9A01_WIDTH; col++) {
+            const double dx = col - t.x;
+            const double dy = row - t.y;
+            const double u = t.pivot_x + 0.5 + (dx * c + dy * s) * k;
+            const double v = t.pivot_y + 0.5 + (-dx * s + dy * c) * k;
+            if (std::fabs(u - std::round(u)) < 0.01 || std::fabs(v - std::round(v)) < 0.01) {
+                if (u > -0.01 && v > -0.01 && u < sprite.width + 0.01 && v < sprite.height + 0.01) {
+                    out.loose++;
+                    out.x0 = std::min(out.x0, col);
+                    out.y0 = std::min(out.y0, row);
+                    out.x1 = std::max(out.x1, col + 1);
+                    out.y1 = std::max(out.y1, row + 1);
+                }
+                continue;
+            }
+            u16 expected = paper;
+            if (u >= 0 && v >= 0 && u < sprite.width && v < sprite.height) {
+                const u32 sx = static_cast<u32>(u);
+                const u32 sy = static_cast<u32>(v);
+                const u16 fg = sprite.pixels[sy * sprite.width + sx];
+                const u32 a = sprite.mode == GC9A01_SPRITE_ALPHA8 ? (sprite.alpha[sy * sprite.width + sx] + 4) >> 3
+                            : fg == sprite.key ? 0 : 32;
+                if (a > 0) {
+                    expected = a == 32 ? fg : blend(fg, paper, a);
+                    out.covered++;
+                    out.x0 = std::min(out.x0, col);
+                    out.y0 = std::min(out.y0, row);
+                    out.x1 = std::max(out.x1, col + 1);
+                    out.y1 = std::max(out.y1, row + 1);
+                }
+            }
+            out.diff += panel.pixel(col, row) != through_wire(colmod, expected);
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Draw one case on a panel filled with the paper color and check GRAM and the wire
+ * @param exact Whether every sample has to lie well inside a pixel, as for quarter turns at scale 256
+ */
+static void check_case(const GC9A01Sprite& sprite, const Case& t, const bool exact) {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    CHECK_EQ(display.fill(PAPER), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+
+    panel.clear();
+    CHECK_EQ(display.draw_rotated(t.x, t.y, sprite, t.pivot_x, t.pivot_y, t.angle, t.scale, PAPER), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(panel.protocol_errors(), 0);
+
+    const Outcome out = compare(panel, sprite, t, display.color_mode());
+    if (out.diff != 0) {
+        std::printf("draw_rotated(%d, %d, %d, %d, %d, %u)\n", t.x, t.y, t.pivot_x, t.pivot_y, t.angle, t.scale);
+    }
+    CHECK_EQ(out.diff, 0);
+    if (exact) {
+        CHECK_EQ(out.loose, 0);
+    } else {
+        CHECK(out.loose * 8 <= out.covered + 8);
+    }
+
+    const u32 written = panel.pixels_written();
+    if (out.covered + out.loose == 0) {
+        CHECK_EQ(written, 0);
+        return;
+    }
+#ifdef CONFIG_GC9A01_BUFFER_MODE
+    // The box around the corners of the sprite goes out, a few pixels larger than what it covers
+    CHECK(written >= out.covered + out.loose);
+    CHECK(written <= static_cast<u32>((out.x1 - out.x0 + 6) * (out.y1 - out.y0 + 6)));
+#else
+    // Only the pixels that are not transparent
+    CHECK(written >= out.covered);
+    CHECK(written <= out.covered + out.loose);
+#endif
+}
+
+/**
+ * @brief Quarter turns at scale 256 move every pixel of the sprite to exactly one pixel of the screen
+ */
+static void test_quarter_turns() {
+    const GC9A01Sprite sprite = {sprite_pixels, nullptr, SPRITE_W, SPRITE_H, GC9A01_SPRITE_KEY, KEY};
+    const Case cases[] = {
+        {120, 120, 10, 8, 0, 256},
+        {120, 120, 10, 8, 900, 256},
+        {100, 140, 0, 0, 1800, 256},
+        {120, 120, 31, 23, 2700, 256},
+        {120, 120, 16, 12, -900, 256},
+        {120, 120, 16, 12, 3600, 256},
+    };
+    for (const Case& t : cases) {
+        check_case(sprite, t, true);
+    }
+
+    // Unturned, the sprite lands where `draw_sprite()` puts it
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    CHECK_EQ(display.fill(PAPER), GC9A01::OK);
+    CHECK_EQ(display.draw_rotated(70, 90, sprite, 10, 8, 0), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    for (u16 y = 0; y < SPRITE_H; y++) {
+        for (u16 x = 0; x < SPRITE_W; x++) {
+            const u16 fg = sprite_pixels[y * SPRITE_W + x];
+            CHECK_EQ(panel.pixel(60 + x, 82 + y), fg == KEY ? PAPER.to_16bit() : fg);
+        }
+    }
+}
+
+/**
+ * @brief Arbitrary angles and scales, up and down
+ */
+static void test_angles_and_scales() {
+    const GC9A01Sprite sprite = {sprite_pixels, nullptr, SPRITE_W, SPRITE_H, GC9A01_SPRITE_KEY, KEY};
+    const Case cases[] = {
+        {100, 110, 10, 8, 337, 256},
+        {120, 120, 16, 12, 1234, 256},
+        {120, 120, 16, 12, 451, 128},
+        {120, 120, 16, 12, -455, 640},
+        {130, 100, 5, 5, 3000, 300},
+        {120, 120, 16, 12, 31, 1024},
+        {120, 120, 16, 12, 2000, 64},
+    };
+    for (const Case& t : cases) {
+        check_case(sprite, t, false);
+    }
+}
+
+/**
+ * @brief Pivots off the screen or outside of the sprite, and sprites that miss the screen entirely
+ */
+static void test_off_screen() {
+    const GC9A01Sprite sprite = {sprite_pixels, nullptr, SPRITE_W, SPRITE_H, GC9A01_SPRITE_KEY, KEY};
+    const Case cases[] = {
+        // The pivot is off the screen, part of the sprite is on it
+        {-10, 60, 16, 12, 200, 512},
+        {250, 235, 16, 12, 450, 512},
+        {120, -20, 16, 0, 1800, 384},
+        // The pivot lies outside of the sprite, which swings around it
+        {120, 120, -40, 8, 600, 256},
+        {10, 200, 60, 40, 2450, 200},
+        // Nothing on screen
+        {-100, -100, 10, 8, 450, 256},
+        {400, 120, 16, 12, 0, 512},
+    };
+    for (const Case& t : cases) {
+        check_case(sprite, t, false);
+    }
+
+    // Nothing on screen sends nothing in direct mode and leaves GRAM as it was
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    panel.clear();
+    CHECK_EQ(display.draw_rotated(-100, -100, sprite, 10, 8, 450), GC9A01::OK);
+    CHECK_EQ(display.draw_rotated(120, 120, sprite, 10, 8, 450, 0), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(panel.pixels_written(), 0);
+}
+
+/**
+ * @brief Alpha blends against the background in direct mode, against the framebuffer in buffer mode
+ */
+static void test_alpha() {
+    const GC9A01Sprite sprite = {sprite_pixels, sprite_alpha, SPRITE_W, SPRITE_H, GC9A01_SPRITE_ALPHA8, 0};
+    check_case(sprite, {120, 120, 16, 12, 0, 256}, true);
+    check_case(sprite, {120, 120, 16, 12, 900, 256}, true);
+    check_case(sprite, {120, 120, 16, 12, 777, 333}, false);
+
+    const GC9A01Sprite broken = {sprite_pixels, nullptr, SPRITE_W, SPRITE_H, GC9A01_SPRITE_ALPHA8, 0};
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    CHECK_EQ(display.draw_rotated(120, 120, broken, 0, 0, 0), GC9A01::INVALID_ARGUMENT);
+}
+
+int main() {
+    make_sprite();
+    test_quarter_turns();
+    test_angles_and_scales();
+    test_off_screen();
+    test_alpha();
+    return test_result("test_rotated");
+}
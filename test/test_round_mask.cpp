@@ -0,0 +1,91 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_round_mask.cpp
+ * @brief Skipping the invisible corners of the round panel
+ */
+
+#include <vector>
+
+#include "gc9a01_test.h"
+
+/**
+ * @brief With the round mask only the pixels behind the glass are sent
+ */
+static void test_round_mask() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    CHECK_EQ(display.fill(Color(0, 0, 0)), GC9A01::OK);
+    display.set_round_mask(true);
+
+    panel.clear();
+    const u16 white = Color(255, 255, 255).to_16bit();
+    CHECK_EQ(display.fill(Color(255, 255, 255)), GC9A01::OK);
+    u32 shown = 0;
+    u32 sent = 0;
+    for (u16 y = 0; y < GC9A01_HEIGHT; y++) {
+        for (u16 x = 0; x < GC9A01_WIDTH; x++) {
+            if (visible(x, y)) {
+                CHECK_EQ(panel.pixel(x, y), white);
+                shown++;
+            }
+            sent += panel.pixel(x, y) == white;
+        }
+    }
+    // Merged bands send a few invisible pixels, the corners are skipped
+    CHECK(sent < GC9A01_PIXELS * 85 / 100);
+    CHECK(sent >= shown);
+    CHECK_EQ(panel.pixel(0, 0), 0);
+    CHECK_EQ(panel.pixel(GC9A01_WIDTH - 1, GC9A01_HEIGHT - 1), 0);
+    CHECK_EQ(panel.pixels_written(), sent);
+}
+
+/**
+ * @brief The bands of an area cover each of its visible pixels once, and nothing past its last row
+ */
+static void test_visible_bands() {
+    const u16 areas[][4] = {
+        {0, 0, GC9A01_WIDTH, GC9A01_HEIGHT},
+        {100, 100, 40, 40},
+        {0, 0, 30, 30},   // a corner, nothing visible
+        {0, 200, 240, 40},
+    };
+    for (const auto& a : areas) {
+        std::vector<u8> covered(GC9A01_PIXELS);
+        u16 row = a[1];
+        Band band;
+        while (next_visible_band(a[0], a[2], row, a[1] + a[3], band)) {
+            CHECK(band.x >= a[0] && band.x + band.w <= a[0] + a[2]);
+            CHECK(band.y >= a[1] && band.y + band.h <= a[1] + a[3]);
+            for (u16 y = band.y; y < band.y + band.h; y++) {
+                for (u16 x = band.x; x < band.x + band.w; x++) {
+                    covered[y * GC9A01_WIDTH + x]++;
+                }
+            }
+        }
+        CHECK_EQ(row, a[1] + a[3]);
+        for (u16 y = a[1]; y < a[1] + a[3]; y++) {
+            for (u16 x = a[0]; x < a[0] + a[2]; x++) {
+                CHECK(covered[y * GC9A01_WIDTH + x] <= 1);
+                if (visible(x, y)) {
+                    CHECK_EQ(covered[y * GC9A01_WIDTH + x], 1);
+                }
+            }
+        }
+    }
+
+    // A start past the end finds nothing and leaves the row alone
+    u16 row = 200;
+    Band band;
+    CHECK(!next_visible_band(0, GC9A01_WIDTH, row, 100, band));
+    CHECK_EQ(row, 200);
+}
+
+int main() {
+    test_round_mask();
+    test_visible_bands();
+    return test_result("test_round_mask");
+}
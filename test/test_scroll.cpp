@@ -0,0 +1,45 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_scroll.cpp
+ * @brief Hardware vertical scrolling
+ */
+
+#include "gc9a01_test.h"
+
+/**
+ * @brief Hardware scrolling moves what is shown, not GRAM
+ */
+static void test_scrolling() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    // A different color on every row
+    static u16 screen[GC9A01_PIXELS];
+    for (u32 i = 0; i < GC9A01_PIXELS; i++) {
+        screen[i] = static_cast<u16>(i / GC9A01_WIDTH * 0x0123);
+    }
+    CHECK_EQ(display.draw_bitmap(0, 0, GC9A01_WIDTH, GC9A01_HEIGHT, screen), GC9A01::OK);
+
+    constexpr u16 top = 40;
+    constexpr u16 lines = 160;
+    CHECK_EQ(display.set_scroll_area(top, lines), GC9A01::OK);
+    CHECK_EQ(display.scroll_to(50), GC9A01::OK);
+    for (u16 y = 0; y < GC9A01_HEIGHT; y++) {
+        const u16 row = y < top || y >= top + lines ? y : top + (y - top + 50) % lines;
+        CHECK_EQ(panel.shown_pixel(17, y), screen[row * GC9A01_WIDTH]);
+        CHECK_EQ(panel.pixel(17, y), screen[y * GC9A01_WIDTH]);
+    }
+
+    CHECK_EQ(display.reset_scroll(), GC9A01::OK);
+    for (u16 y = 0; y < GC9A01_HEIGHT; y++) {
+        CHECK_EQ(panel.shown_pixel(200, y), screen[y * GC9A01_WIDTH]);
+    }
+}
+
+int main() {
+    test_scrolling();
+    return test_result("test_scroll");
+}
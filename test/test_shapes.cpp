@@ -0,0 +1,430 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_shapes.cpp
+ * @brief Shapes drawn by the span rasterizer
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "gc9a01_test.h"
+
+static const u16 ink = Color(255, 255, 0).to_16bit();
+
+/**
+ * @brief Expected screen: black, with the pixels of a shape set
+ *
+ * Pixels marked `loose` may be either, for edges that depend on rounding.
+ */
+struct Screen {
+    std::vector<u16> pixels = std::vector<u16>(GC9A01_PIXELS);
+    std::vector<bool> loose = std::vector<bool>(GC9A01_PIXELS);
+
+    static bool inside(const i32 x, const i32 y) {
+        return x >= 0 && y >= 0 && x < GC9A01_WIDTH && y < GC9A01_HEIGHT;
+    }
+    void put(const i32 x, const i32 y) {
+        if (inside(x, y)) {
+            pixels[y * GC9A01_WIDTH + x] = ink;
+        }
+    }
+    void either(const i32 x, const i32 y) {
+        if (inside(x, y)) {
+            loose[y * GC9A01_WIDTH + x] = true;
+        }
+    }
+    // Pixels where GRAM differs, the loose ones aside
+    u32 diff(const GC9A01MockPanel& panel) const {
+        u32 count = 0;
+        for (u16 y = 0; y < GC9A01_HEIGHT; y++) {
+            for (u16 x = 0; x < GC9A01_WIDTH; x++) {
+                const u32 i = y * GC9A01_WIDTH + x;
+                if (!loose[i] && panel.pixel(x, y) != pixels[i]) {
+                    count++;
+                }
+            }
+        }
+        return count;
+    }
+};
+
+/**
+ * @brief Clear the screen, draw a shape and count the pixels where GRAM differs from `expected`
+ */
+template <typename Draw>
+static u32 draw_diff(const GC9A01MockPanel& panel, GC9A01& display, const Screen& expected, Draw draw) {
+    CHECK_EQ(display.fill(Color(0, 0, 0)), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(draw(), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    return expected.diff(panel);
+}
+
+/**
+ * @brief Bresenham's line, one pixel at a time
+ */
+static void ref_line(Screen& screen, i32 x0, i32 y0, const i32 x1, const i32 y1) {
+    const i32 dx = std::abs(x1 - x0);
+    const i32 dy = -std::abs(y1 - y0);
+    const i32 sx = x0 < x1 ? 1 : -1;
+    const i32 sy = y0 < y1 ? 1 : -1;
+    i32 err = dx + dy;
+    while (true) {
+        screen.put(x0, y0);
+        if (x0 == x1 && y0 == y1) {
+            return;
+        }
+        const i32 e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+/**
+ * @brief Largest `h` with `h * h + d * d <= r * r + r`, -1 if there is none
+ */
+static i32 ref_half_width(const i32 r, const i32 d) {
+    const i32 n = r * r + r - d * d;
+    if (n < 0) {
+        return -1;
+    }
+    i32 h = static_cast<i32>(std::sqrt(static_cast<double>(n)));
+    while (h * h > n) {
+        h--;
+    }
+    while ((h + 1) * (h + 1) <= n) {
+        h++;
+    }
+    return h;
+}
+
+static bool in_disc(const i32 r, const i32 dx, const i32 dy) {
+    return dx * dx + dy * dy <= r * r + r;
+}
+
+/**
+ * @brief Outline of a circle: the outermost pixel of each column where it is flat, of each row where it is steep
+ */
+static bool on_circle(const i32 r, i32 dx, i32 dy) {
+    dx = std::abs(dx);
+    dy = std::abs(dy);
+    return (dx <= dy && dy == ref_half_width(r, dx)) || (dy <= dx && dx == ref_half_width(r, dy));
+}
+
+static void ref_circle(Screen& screen, const i32 x0, const i32 y0, const i32 r, const bool filled) {
+    for (i32 dy = -r; dy <= r; dy++) {
+        for (i32 dx = -r; dx <= r; dx++) {
+            if (filled ? in_disc(r, dx, dy) : on_circle(r, dx, dy)) {
+                screen.put(x0 + dx, y0 + dy);
+            }
+        }
+    }
+}
+
+static void ref_round_rect(Screen& screen, const i32 x, const i32 y, const i32 w, const i32 h, i32 r, const bool filled) {
+    r = std::min(r, std::min(w, h) / 2);
+    // Corner centers, every pixel is measured from the nearest one
+    const i32 left = x + r;
+    const i32 right = x + w - 1 - r;
+    const i32 top = y + r;
+    const i32 bottom = y + h - 1 - r;
+    for (i32 py = y; py < y + h; py++) {
+        for (i32 px = x; px < x + w; px++) {
+            const i32 dx = px - std::clamp(px, left, right);
+            const i32 dy = py - std::clamp(py, top, bottom);
+            bool set;
+            if (filled) {
+                set = in_disc(r, dx, dy);
+            } else if (r == 0) {
+                set = px == x || px == x + w - 1 || py == y || py == y + h - 1;
+            } else {
+                set = on_circle(r, dx, dy);
+            }
+            if (set) {
+                screen.put(px, py);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Ring segment, clockwise from 12 o'clock
+ *
+ * Pixels within one pixel of the start and end rays may go either way.
+ */
+static void ref_arc(Screen& screen, const i32 x0, const i32 y0, const i32 r_outer, const i32 r_inner, const i32 start, const i32 end) {
+    constexpr double degree = 3.14159265358979323846 / 180.0;
+    const i32 sweep = ((end - start) % 360 + 360) % 360;
+    const bool full = end - start >= 360 || start - end >= 360 || (sweep == 0 && end != start);
+    for (i32 dy = -r_outer; dy <= r_outer; dy++) {
+        for (i32 dx = -r_outer; dx <= r_outer; dx++) {
+            if (!in_disc(r_outer, dx, dy) || (r_inner > 0 && in_disc(r_inner - 1, dx, dy))) {
+                continue;
+            }
+            const double angle = std::fmod(std::atan2(dx, -dy) / degree - start + 720.0, 360.0);
+            if (full || angle <= sweep) {
+                screen.put(x0 + dx, y0 + dy);
+            }
+            if (full) {
+                continue;
+            }
+            for (const i32 ray : {start, end}) {
+                // Distance from the ray, the side behind the center does not count
+                const double ux = std::sin(ray * degree);
+                const double uy = -std::cos(ray * degree);
+                if (std::abs(dx * uy - dy * ux) <= 1.0 && dx * ux + dy * uy >= -1.0) {
+                    screen.either(x0 + dx, y0 + dy);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Filled triangle: pixels a pixel inside all edges are set, pixels a pixel outside any are not
+ */
+static void ref_triangle(Screen& screen, const i32 x0, const i32 y0, const i32 x1, const i32 y1, const i32 x2, const i32 y2) {
+    const i32 xs[3] = {x0, x1, x2};
+    const i32 ys[3] = {y0, y1, y2};
+    const i64 area = static_cast<i64>(x1 - x0) * (y2 - y0) - static_cast<i64>(y1 - y0) * (x2 - x0);
+    const i32 min_x = std::min({x0, x1, x2});
+    const i32 max_x = std::max({x0, x1, x2});
+    const i32 min_y = std::min({y0, y1, y2});
+    const i32 max_y = std::max({y0, y1, y2});
+    for (i32 py = min_y - 1; py <= max_y + 1; py++) {
+        for (i32 px = min_x - 1; px <= max_x + 1; px++) {
+            // Signed distance from the nearest edge, positive inside
+            double distance = 1e9;
+            for (u8 i = 0; i < 3; i++) {
+                const i32 ax = xs[i];
+                const i32 ay = ys[i];
+                const i32 bx = xs[(i + 1) % 3];
+                const i32 by = ys[(i + 1) % 3];
+                const double cross = static_cast<double>(bx - ax) * (py - ay) - static_cast<double>(by - ay) * (px - ax);
+                distance = std::min(distance, (area > 0 ? cross : -cross) / std::hypot(bx - ax, by - ay));
+            }
+            if (distance >= 1.0) {
+                screen.put(px, py);
+            } else if (distance > -1.0) {
+                screen.either(px, py);
+            }
+        }
+    }
+    // The corners themselves are always drawn
+    for (u8 i = 0; i < 3; i++) {
+        if (Screen::inside(xs[i], ys[i])) {
+            screen.put(xs[i], ys[i]);
+            screen.loose[ys[i] * GC9A01_WIDTH + xs[i]] = false;
+        }
+    }
+}
+
+/**
+ * @brief Lines against Bresenham's, flat, steep, axis-aligned and clipped on both ends
+ */
+static void test_lines(GC9A01MockPanel& panel, GC9A01& display) {
+    const i16 lines[][4] = {
+        {10, 10, 200, 50},     // flat
+        {200, 50, 10, 10},     // flat, right to left
+        {30, 200, 50, 20},     // steep, upwards
+        {120, 30, 121, 210},   // steep, one step
+        {0, 0, 239, 239},      // diagonal
+        {239, 0, 0, 239},      // anti-diagonal
+        {-50, -30, 300, 260},  // clipped on both ends
+        {100, -40, 130, 300},  // steep, clipped on both ends
+        {-10, 5, 250, 5},      // horizontal, clipped
+        {7, 260, 7, -3},       // vertical, clipped
+        {50, 50, 50, 50},      // a single pixel
+        {-20, -20, -5, 100},   // off-screen
+    };
+    for (const auto& l : lines) {
+        Screen expected;
+        ref_line(expected, l[0], l[1], l[2], l[3]);
+        const u32 diff = draw_diff(panel, display, expected, [&] {
+            return display.draw_line(l[0], l[1], l[2], l[3], Color(255, 255, 0));
+        });
+        if (diff != 0) {
+            std::printf("line %d,%d to %d,%d\n", l[0], l[1], l[2], l[3]);
+        }
+        CHECK_EQ(diff, 0);
+    }
+}
+
+/**
+ * @brief Circles against one pixel per column (flat) or row (steep) of the outline, and discs
+ */
+static void test_circles(GC9A01MockPanel& panel, GC9A01& display) {
+    const i16 circles[][3] = {
+        {120, 120, 100},
+        {120, 120, 0},
+        {60, 60, 1},
+        {60, 60, 2},
+        {80, 150, 7},
+        {20, 30, 50},    // clipped at the top left
+        {230, 230, 40},  // clipped at the bottom right
+        {-10, 120, 30},  // center off-screen
+        {120, 300, 70},  // center below the screen, only the top shows
+        {120, 120, 200}, // larger than the screen
+    };
+    for (const bool filled : {false, true}) {
+        for (const auto& c : circles) {
+            Screen expected;
+            ref_circle(expected, c[0], c[1], c[2], filled);
+            const u32 diff = draw_diff(panel, display, expected, [&] {
+                return filled ? display.fill_circle(c[0], c[1], c[2], Color(255, 255, 0))
+                              : display.draw_circle(c[0], c[1], c[2], Color(255, 255, 0));
+            });
+            if (diff != 0) {
+                std::printf("%s circle %d,%d r %d\n", filled ? "filled" : "outlined", c[0], c[1], c[2]);
+            }
+            CHECK_EQ(diff, 0);
+        }
+    }
+}
+
+/**
+ * @brief Ring segments against the angle of each pixel
+ */
+static void test_arc_pixels(GC9A01MockPanel& panel, GC9A01& display) {
+    const i16 arcs[][6] = {
+        {120, 120, 100, 80, 30, 300},   // more than half
+        {120, 120, 60, 0, -45, 45},     // pie slice, less than half
+        {120, 120, 90, 85, 0, 360},     // full ring
+        {120, 120, 50, 20, 90, 270},    // exactly half
+        {10, 10, 50, 40, 90, 180},      // clipped
+        {120, 250, 80, 60, 270, 450},   // upper half, center off-screen
+    };
+    for (const auto& a : arcs) {
+        Screen expected;
+        ref_arc(expected, a[0], a[1], a[2], a[3], a[4], a[5]);
+        const u32 diff = draw_diff(panel, display, expected, [&] {
+            return display.draw_arc(a[0], a[1], a[2], a[3], a[4], a[5], Color(255, 255, 0));
+        });
+        if (diff != 0) {
+            std::printf("arc %d,%d r %d..%d, %d to %d\n", a[0], a[1], a[3], a[2], a[4], a[5]);
+        }
+        CHECK_EQ(diff, 0);
+    }
+}
+
+/**
+ * @brief Rounded rectangles, outlined and filled, with the corners of a circle of the same radius
+ */
+static void test_round_rects(GC9A01MockPanel& panel, GC9A01& display) {
+    const i16 rects[][5] = {
+        {20, 30, 101, 61, 15},
+        {50, 50, 21, 21, 10},     // a circle
+        {60, 60, 41, 31, 100},    // radius limited to half the height
+        {100, 100, 30, 20, 0},    // plain rectangle
+        {-20, -10, 80, 60, 12},   // clipped at the top left
+        {200, 180, 80, 90, 25},   // clipped at the bottom right
+    };
+    for (const bool filled : {false, true}) {
+        for (const auto& r : rects) {
+            Screen expected;
+            ref_round_rect(expected, r[0], r[1], r[2], r[3], r[4], filled);
+            const u32 diff = draw_diff(panel, display, expected, [&] {
+                return filled ? display.fill_round_rect(r[0], r[1], r[2], r[3], r[4], Color(255, 255, 0))
+                              : display.draw_round_rect(r[0], r[1], r[2], r[3], r[4], Color(255, 255, 0));
+            });
+            if (diff != 0) {
+                std::printf("%s round rect %d,%d %dx%d r %d\n", filled ? "filled" : "outlined", r[0], r[1], r[2], r[3], r[4]);
+            }
+            CHECK_EQ(diff, 0);
+        }
+    }
+}
+
+/**
+ * @brief Triangle outlines are three Bresenham lines, filled triangles one run per row inside the edges
+ */
+static void test_triangles(GC9A01MockPanel& panel, GC9A01& display) {
+    const i16 triangles[][6] = {
+        {20, 20, 200, 60, 90, 220},
+        {10, 100, 100, 100, 50, 150},   // flat top
+        {50, 10, 10, 60, 90, 60},       // flat bottom
+        {118, 5, 122, 235, 120, 120},   // thin and steep
+        {-30, -30, 260, 40, 120, 300},  // clipped on three sides
+        {30, 200, 180, 200, 100, 200},  // a single row
+    };
+    for (const auto& t : triangles) {
+        Screen outline;
+        ref_line(outline, t[0], t[1], t[2], t[3]);
+        ref_line(outline, t[2], t[3], t[4], t[5]);
+        ref_line(outline, t[4], t[5], t[0], t[1]);
+        u32 diff = draw_diff(panel, display, outline, [&] {
+            return display.draw_triangle(t[0], t[1], t[2], t[3], t[4], t[5], Color(255, 255, 0));
+        });
+        if (diff != 0) {
+            std::printf("triangle %d,%d %d,%d %d,%d\n", t[0], t[1], t[2], t[3], t[4], t[5]);
+        }
+        CHECK_EQ(diff, 0);
+
+        Screen filled;
+        if (t[1] == t[3] && t[3] == t[5]) {
+            ref_line(filled, std::min({t[0], t[2], t[4]}), t[1], std::max({t[0], t[2], t[4]}), t[1]);
+        } else {
+            ref_triangle(filled, t[0], t[1], t[2], t[3], t[4], t[5]);
+        }
+        diff = draw_diff(panel, display, filled, [&] {
+            return display.fill_triangle(t[0], t[1], t[2], t[3], t[4], t[5], Color(255, 255, 0));
+        });
+        if (diff != 0) {
+            std::printf("filled triangle %d,%d %d,%d %d,%d\n", t[0], t[1], t[2], t[3], t[4], t[5]);
+        }
+        CHECK_EQ(diff, 0);
+        // One run per row
+        for (u16 y = 0; y < GC9A01_HEIGHT; y++) {
+            u8 runs = 0;
+            for (u16 x = 0; x < GC9A01_WIDTH; x++) {
+                if (panel.pixel(x, y) == ink && (x == 0 || panel.pixel(x - 1, y) != ink)) {
+                    runs++;
+                }
+            }
+            CHECK(runs <= 1);
+        }
+    }
+}
+
+/**
+ * @brief Arcs drawn over a fill keep it where they leave a gap
+ */
+static void test_arcs() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    CHECK_EQ(display.fill_rect(110, 110, 20, 20, Color(255, 0, 0)), GC9A01::OK);
+    for (u16 k = 0; k < 4; k++) {
+        CHECK_EQ(display.draw_arc(120, 120, 100 - 5 * k, 97 - 5 * k, 30, 300, Color(0, 255, 0)), GC9A01::OK);
+    }
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(panel.pixel(120, 120), Color(255, 0, 0).to_16bit());
+    // Left of the center, 12 o'clock is 0 degrees, so 270 degrees is inside the arc
+    CHECK_EQ(panel.pixel(21, 120), Color(0, 255, 0).to_16bit());
+    // 12 o'clock is outside of 30 to 300 degrees, the background shows
+    CHECK_EQ(panel.pixel(120, 21), 0);
+}
+
+int main() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    test_lines(panel, display);
+    test_circles(panel, display);
+    test_arc_pixels(panel, display);
+    test_round_rects(panel, display);
+    test_triangles(panel, display);
+    test_arcs();
+    return test_result("test_shapes");
+}
@@ -0,0 +1,246 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_text.cpp
+ * @brief Text and the cache of rendered lines, checked on GRAM
+ *
+ * Whether a line came from the cache shows by changing the font after it was
+ * drawn: a cached line keeps the glyphs it was rendered with, a line rendered
+ * again shows the new ones.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gc9a01_test.h"
+
+static const Color INK(255, 240, 0);
+static const Color PAPER(0, 40, 120);
+
+/**
+ * @brief Turn every pixel of the glyph boxes into foreground, keeping the runs
+ */
+static void make_solid(TestFont& font) {
+    for (u8& run : font.runs) {
+        run = static_cast<u8>(0xF0 | (run & 0x0F));
+    }
+}
+
+/**
+ * @brief Pixels of the box of a line drawn at `x`, `y` where GRAM differs from the font,
+ *        the part on screen
+ * @param solid Whether to expect the glyphs of `make_solid()`
+ */
+static u32 line_diff(const GC9A01MockPanel& panel, const u8 colmod, const i16 x, const i16 y, const std::string& text,
+                     const GC9A01Font& font, const bool solid, const Color color = INK, const Color background = PAPER) {
+    // Box of the line, like `draw_text()` measures it
+    i32 pen = 0;
+    i32 left = 0;
+    i32 right = 0;
+    for (const char c : text) {
+        const GC9A01Glyph& glyph = font.glyphs[c - font.first];
+        if (glyph.width > 0) {
+            left = std::min<i32>(left, pen + glyph.x_offset);
+            right = std::max<i32>(right, pen + glyph.x_offset + glyph.width);
+        }
+        pen += glyph.advance;
+    }
+    right = std::max(right, pen);
+    const i32 w = right - left;
+    const i32 h = font.line_height;
+
+    const auto shade = [&](const u8 a) {
+        const auto mix = [a](const u8 bg, const u8 fg) {
+            return static_cast<u8>((bg * (15 - a) + fg * a + 7) / 15);
+        };
+        return through_wire(colmod, Color(mix(background.r, color.r), mix(background.g, color.g),
+                                          mix(background.b, color.b)).to_16bit());
+    };
+    std::vector<u16> expected(w * h, shade(0));
+    pen = 0;
+    for (const char c : text) {
+        const GC9A01Glyph& glyph = font.glyphs[c - font.first];
+        for (u16 gy = 0; gy < glyph.height; gy++) {
+            for (u16 gx = 0; gx < glyph.width; gx++) {
+                const u8 a = solid ? 15 : TestFont::alpha(c, gx, gy);
+                if (a != 0) {
+                    expected[(glyph.y_offset + gy) * w + pen + glyph.x_offset + gx - left] = shade(a);
+                }
+            }
+        }
+        pen += glyph.advance;
+    }
+
+    u32 diff = 0;
+    for (i32 row = 0; row < h; row++) {
+        for (i32 col = 0; col < w; col++) {
+            const i32 sx = x + left + col;
+            const i32 sy = y + row;
+            if (sx >= 0 && sy >= 0 && sx < GC9A01_WIDTH && sy < GC9A01_HEIGHT) {
+                diff += panel.pixel(sx, sy) != expected[row * w + col];
+            }
+        }
+    }
+    return diff;
+}
+
+static void start(GC9A01& display) {
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+}
+
+/**
+ * @brief A line drawn again with the same text, font and colors comes from the cache, anywhere on screen
+ */
+static void test_hits() {
+    TestFont font;
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    start(display);
+    const u8 colmod = display.color_mode();
+    const std::string text = "Hello, cache!";
+
+    CHECK_EQ(display.draw_text(20, 60, text.c_str(), font.font, INK, PAPER), GC9A01::OK);
+    CHECK_EQ(display.draw_text(-5, 200, text.c_str(), font.font, INK, PAPER), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(line_diff(panel, colmod, 20, 60, text, font.font, false), 0);
+    CHECK_EQ(line_diff(panel, colmod, -5, 200, text, font.font, false), 0);
+
+    make_solid(font);
+    // Same key elsewhere: the cached pixels
+    CHECK_EQ(display.draw_text(100, 120, text.c_str(), font.font, INK, PAPER), GC9A01::OK);
+    // Other colors, other text: rendered with the font as it is now
+    CHECK_EQ(display.draw_text(20, 140, text.c_str(), font.font, INK, Color(0, 0, 0)), GC9A01::OK);
+    CHECK_EQ(display.draw_text(20, 160, "Hello, cache?", font.font, INK, PAPER), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(line_diff(panel, colmod, 100, 120, text, font.font, false), 0);
+    CHECK_EQ(line_diff(panel, colmod, 20, 140, text, font.font, true, INK, Color(0, 0, 0)), 0);
+    CHECK_EQ(line_diff(panel, colmod, 20, 160, "Hello, cache?", font.font, true), 0);
+
+    // Text of several lines is looked up line by line, clipped lines are neither kept nor looked up
+    CHECK_EQ(display.draw_text(30, 80, "Hello, cache!\nnew", font.font, INK, PAPER), GC9A01::OK);
+    CHECK_EQ(display.draw_text(-5, 200, text.c_str(), font.font, INK, PAPER), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(line_diff(panel, colmod, 30, 80, text, font.font, false), 0);
+    CHECK_EQ(line_diff(panel, colmod, 30, 80 + font.font.line_height, "new", font.font, true), 0);
+    CHECK_EQ(line_diff(panel, colmod, -5, 200, text, font.font, true), 0);
+}
+
+// Lines that take a slot each, one more than the cache holds
+#define LINES (GC9A01_TEXT_CACHE_SLOTS + 1)
+
+static std::string label(const u16 i) {
+    return "L" + std::to_string(i);
+}
+
+static i16 label_x(const u16 i) {
+    return 20 + i % 4 * 52;
+}
+
+static i16 label_y(const u16 i) {
+    return 40 + i / 4 * 13;
+}
+
+/**
+ * @brief A full cache makes room by dropping the least recently used line
+ */
+static void test_eviction() {
+    TestFont font;
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    start(display);
+    const u8 colmod = display.color_mode();
+    static_assert(8 * TestFont::HEIGHT * 4 <= GC9A01_TEXT_SLOT_PIXELS, "A label takes one slot");
+
+    // Fill the cache, then use the first line again so the second one is the oldest
+    for (u16 i = 0; i < GC9A01_TEXT_CACHE_SLOTS; i++) {
+        CHECK_EQ(display.draw_text(label_x(i), label_y(i), label(i).c_str(), font.font, INK, PAPER), GC9A01::OK);
+        CHECK_EQ(display.flush(), GC9A01::OK);
+    }
+    // A frame each, a band mode frame fills the rest of its bounding box with the background
+    CHECK_EQ(display.draw_text(label_x(0), label_y(0), label(0).c_str(), font.font, INK, PAPER), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(display.draw_text(label_x(LINES - 1), label_y(LINES - 1), label(LINES - 1).c_str(), font.font, INK, PAPER), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    for (u16 i = 0; i < LINES; i++) {
+        CHECK_EQ(line_diff(panel, colmod, label_x(i), label_y(i), label(i), font.font, false), 0);
+    }
+
+    make_solid(font);
+    for (u16 i = 0; i < LINES; i++) {
+        CHECK_EQ(display.draw_text(label_x(i), label_y(i), label(i).c_str(), font.font, INK, PAPER), GC9A01::OK);
+        CHECK_EQ(display.flush(), GC9A01::OK);
+    }
+    // The first line was kept, the second one dropped. Rendering it again dropped the
+    // third one and so on, each miss evicting the line drawn next, the last one the first
+    CHECK_EQ(line_diff(panel, colmod, label_x(0), label_y(0), label(0), font.font, false), 0);
+    for (u16 i = 1; i < LINES; i++) {
+        CHECK_EQ(line_diff(panel, colmod, label_x(i), label_y(i), label(i), font.font, true), 0);
+    }
+}
+
+/**
+ * @brief More text in one frame than the cache holds: lines waiting in the display list are
+ *        not overwritten, in band mode the list is rendered early to make room
+ */
+static void test_pinned() {
+    TestFont font;
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    start(display);
+    const u8 colmod = display.color_mode();
+    const u16 lines = GC9A01_TEXT_CACHE_SLOTS + 8;
+
+    CHECK_EQ(display.fill(PAPER), GC9A01::OK);
+    for (u16 i = 0; i < lines; i++) {
+        CHECK_EQ(display.draw_text(label_x(i), label_y(i), label(i).c_str(), font.font, INK, PAPER), GC9A01::OK);
+    }
+    // A hit in the same frame
+    CHECK_EQ(display.draw_text(100, 200, label(lines - 1).c_str(), font.font, INK, PAPER), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    for (u16 i = 0; i < lines; i++) {
+        CHECK_EQ(line_diff(panel, colmod, label_x(i), label_y(i), label(i), font.font, false), 0);
+    }
+    CHECK_EQ(line_diff(panel, colmod, 100, 200, label(lines - 1), font.font, false), 0);
+}
+
+/**
+ * @brief A line larger than the whole cache goes out in strips of rows, a glyph may cross
+ *        from one strip into the next, and it is not kept
+ */
+static void test_strips() {
+    // 120 rows with the glyphs at rows 80 to 87
+    TestFont font(120, 80);
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    start(display);
+    const u8 colmod = display.color_mode();
+    const std::string text = "Strips of text, 0123";
+    CHECK(display.text_width(text.c_str(), font.font) * font.font.line_height
+          > GC9A01_TEXT_CACHE_SLOTS * GC9A01_TEXT_SLOT_PIXELS);
+
+    panel.clear();
+    CHECK_EQ(display.draw_text(10, 60, text.c_str(), font.font, INK, PAPER), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(line_diff(panel, colmod, 10, 60, text, font.font, false), 0);
+#ifndef CONFIG_GC9A01_BUFFER_MODE
+    // Sent as it is rendered, one window per strip
+    const std::vector<u8> sent = commands(panel);
+    CHECK(std::count(sent.begin(), sent.end(), CMD_MEMORY_WRITE) >= 2);
+#endif
+
+    make_solid(font);
+    CHECK_EQ(display.draw_text(10, 60, text.c_str(), font.font, INK, PAPER), GC9A01::OK);
+    CHECK_EQ(display.flush(), GC9A01::OK);
+    CHECK_EQ(line_diff(panel, colmod, 10, 60, text, font.font, true), 0);
+}
+
+int main() {
+    test_hits();
+    test_eviction();
+    test_pinned();
+    test_strips();
+    return test_result("test_text");
+}
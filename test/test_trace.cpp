@@ -0,0 +1,177 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_trace.cpp
+ * @brief Trace ring buffer and statistics against the transfers the panel saw
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gc9a01_test.h"
+
+/**
+ * @brief Trace entries of transfers, waits left out
+ */
+static std::vector<GC9A01::TraceEntry> transfers(const GC9A01& display, const u32 count = CONFIG_GC9A01_TRACE_DEPTH) {
+    std::vector<GC9A01::TraceEntry> entries(count);
+    entries.resize(display.read_trace(entries.data(), count));
+    std::vector<GC9A01::TraceEntry> result;
+    for (const GC9A01::TraceEntry& entry : entries) {
+        if (entry.event == GC9A01::TRACE_CMD || entry.event == GC9A01::TRACE_DATA) {
+            result.push_back(entry);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Number of trace entries that do not match the transfers recorded by the panel
+ *
+ * Both are compared from the end, as far as the shorter one goes.
+ */
+static u32 mismatches(const GC9A01MockPanel& panel, const std::vector<GC9A01::TraceEntry>& entries) {
+    const std::vector<GC9A01MemoryTransport::Record>& records = panel.records();
+    const size_t n = std::min(entries.size(), records.size());
+    u32 count = 0;
+    for (size_t i = 0; i < n; i++) {
+        const GC9A01::TraceEntry& entry = entries[entries.size() - n + i];
+        const GC9A01MemoryTransport::Record& record = records[records.size() - n + i];
+        const bool match = record.dc
+            ? entry.event == GC9A01::TRACE_DATA && entry.value == record.size
+            : entry.event == GC9A01::TRACE_CMD && entry.value == panel.log()[record.offset];
+        count += !match;
+    }
+    return count;
+}
+
+/**
+ * @brief A known sequence shows up entry by entry, tagged with its primitive
+ */
+static void test_sequence() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+
+    // Away from the window left by init, so it is set up in full
+    panel.clear();
+    display.reset_stats();
+    CHECK_EQ(display.fill_rect(10, 10, 8, 8, Color(255, 0, 0)), GC9A01::OK);
+    std::vector<GC9A01::TraceEntry> entries = transfers(display);
+    CHECK_EQ(panel.transactions(), 6);
+    CHECK(entries.size() >= 6);
+    entries.erase(entries.begin(), entries.end() - 6);
+    CHECK_EQ(mismatches(panel, entries), 0);
+    // 64 pixels of 12, 16 or 18 bits on the wire
+    const u32 pixel_bytes = CONFIG_GC9A01_COLOR_MODE == COLOR_MODE_MCU_12BIT ? 96
+                          : CONFIG_GC9A01_COLOR_MODE == COLOR_MODE_MCU_16BIT ? 128 : 192;
+    const u32 sequence[][2] = {
+        {GC9A01::TRACE_CMD, CMD_COLADDRSET}, {GC9A01::TRACE_DATA, 4},
+        {GC9A01::TRACE_CMD, CMD_ROWADDRSET}, {GC9A01::TRACE_DATA, 4},
+        {GC9A01::TRACE_CMD, CMD_MEMORY_WRITE}, {GC9A01::TRACE_DATA, pixel_bytes},
+    };
+    for (u32 i = 0; i < 6; i++) {
+        CHECK_EQ(entries[i].event, sequence[i][0]);
+        CHECK_EQ(entries[i].value, sequence[i][1]);
+        CHECK_EQ(entries[i].primitive, GC9A01::PRIM_FILL_RECT);
+        if (i > 0) {
+            CHECK(entries[i].time_us >= entries[i - 1].time_us);
+        }
+    }
+
+    // The call ends waiting for its transfers
+    GC9A01::TraceEntry last[1];
+    CHECK_EQ(display.read_trace(last, 1), 1);
+    CHECK_EQ(last[0].event, GC9A01::TRACE_WAIT);
+    CHECK_EQ(last[0].primitive, GC9A01::PRIM_FILL_RECT);
+
+    // Statistics count the same transfers
+    const GC9A01::Stats& stats = display.stats();
+    CHECK_EQ(stats.calls[GC9A01::PRIM_FILL_RECT], 1);
+    CHECK_EQ(stats.transactions[GC9A01::PRIM_FILL_RECT], panel.transactions());
+    CHECK_EQ(stats.bytes[GC9A01::PRIM_FILL_RECT], panel.bytes());
+    CHECK_EQ(stats.window_setups[GC9A01::PRIM_FILL_RECT], 1);
+
+    // Each primitive is tagged with its own
+    display.reset_stats();
+    CHECK_EQ(display.draw_line(0, 0, 20, 1, Color(0, 255, 0)), GC9A01::OK);
+    CHECK_EQ(display.set_pixel(100, 100, Color(0, 0, 255)), GC9A01::OK);
+    entries = transfers(display);
+    CHECK_EQ(mismatches(panel, entries), 0);
+    CHECK_EQ(entries.back().primitive, GC9A01::PRIM_SET_PIXEL);
+    u32 lines = 0;
+    for (const GC9A01::TraceEntry& entry : entries) {
+        lines += entry.primitive == GC9A01::PRIM_LINE;
+    }
+    CHECK_EQ(lines, display.stats().transactions[GC9A01::PRIM_LINE]);
+}
+
+/**
+ * @brief Once the ring wrapped only the most recent entries are kept, oldest first
+ */
+static void test_wrap() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    panel.clear();
+    for (u16 i = 0; i < 40; i++) {
+        CHECK_EQ(display.fill_rect(i * 5, i * 3, 4, 4, Color(255, 255, 255)), GC9A01::OK);
+    }
+    CHECK(panel.transactions() > CONFIG_GC9A01_TRACE_DEPTH);
+
+    // The oldest slot is the next one written, it is left out
+    GC9A01::TraceEntry entries[CONFIG_GC9A01_TRACE_DEPTH];
+    const u32 count = display.read_trace(entries, CONFIG_GC9A01_TRACE_DEPTH);
+    CHECK_EQ(count, CONFIG_GC9A01_TRACE_DEPTH - 1);
+    // Fewer requested, the most recent ones
+    GC9A01::TraceEntry recent[4];
+    CHECK_EQ(display.read_trace(recent, 4), 4);
+    for (u32 i = 0; i < 4; i++) {
+        CHECK_EQ(recent[i].event, entries[count - 4 + i].event);
+        CHECK_EQ(recent[i].value, entries[count - 4 + i].value);
+        CHECK_EQ(recent[i].time_us, entries[count - 4 + i].time_us);
+    }
+    CHECK_EQ(mismatches(panel, transfers(display)), 0);
+}
+
+/**
+ * @brief A reader on another thread gets consistent snapshots while the drawing thread traces
+ */
+static void test_concurrent_reader() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    std::atomic<bool> done = false;
+    u32 bad = 0;
+    u32 reads = 0;
+    std::thread reader([&] {
+        GC9A01::TraceEntry entries[CONFIG_GC9A01_TRACE_DEPTH];
+        while (!done.load()) {
+            const u32 count = display.read_trace(entries, CONFIG_GC9A01_TRACE_DEPTH);
+            for (u32 i = 0; i < count; i++) {
+                bad += entries[i].event > GC9A01::TRACE_WAIT || entries[i].primitive >= GC9A01::PRIM_COUNT;
+                bad += i > 0 && entries[i].time_us < entries[i - 1].time_us;
+            }
+            reads++;
+        }
+    });
+    for (u16 i = 0; i < 2000; i++) {
+        CHECK_EQ(display.fill_rect(i % 200, i % 180, 16, 16, Color(i, 255 - i, 0)), GC9A01::OK);
+    }
+    done = true;
+    reader.join();
+    CHECK(reads > 0);
+    CHECK_EQ(bad, 0);
+}
+
+int main() {
+    test_sequence();
+    test_wrap();
+    test_concurrent_reader();
+    return test_result("test_trace");
+}
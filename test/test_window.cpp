@@ -0,0 +1,49 @@
+/*
+ * @author Daniel Mironov
+ * @copyright Copyright (c) 2024, Daniel Mironov
+ * @license MIT
+ * @file test_window.cpp
+ * @brief The cached write window and `CMD_WRITE_MEM_CONTINUE`
+ */
+
+#include "gc9a01_test.h"
+
+/**
+ * @brief A write continuing the last one only sends `CMD_WRITE_MEM_CONTINUE`
+ */
+static void test_window_cache() {
+    GC9A01MockPanel panel;
+    GC9A01 display(panel);
+    CHECK_EQ(display.init(), GC9A01::OK);
+    display.set_round_mask(false);
+    static u16 rows[20 * 10];
+    for (u32 i = 0; i < 20 * 10; i++) {
+        rows[i] = static_cast<u16>(0x0841 * (i % 31));
+    }
+
+    panel.clear();
+    CHECK_EQ(display.draw_bitmap(50, 60, 20, 5, rows), GC9A01::OK);
+    CHECK(commands(panel) == std::vector<u8>({CMD_COLADDRSET, CMD_ROWADDRSET, CMD_MEMORY_WRITE}));
+
+    // Drawn again in place, the address counter wrapped around to the start of the window
+    panel.clear();
+    CHECK_EQ(display.draw_bitmap(50, 60, 20, 5, rows + 20 * 5), GC9A01::OK);
+    CHECK(commands(panel) == std::vector<u8>({CMD_WRITE_MEM_CONTINUE}));
+
+    // Same columns, other rows: only RASET
+    panel.clear();
+    CHECK_EQ(display.fill_rect(50, 100, 20, 4, Color(0, 0, 255)), GC9A01::OK);
+    CHECK(commands(panel) == std::vector<u8>({CMD_ROWADDRSET, CMD_MEMORY_WRITE}));
+
+    for (u16 y = 0; y < 5; y++) {
+        for (u16 x = 0; x < 20; x++) {
+            CHECK_EQ(panel.pixel(50 + x, 60 + y), rows[(5 + y) * 20 + x]);
+        }
+    }
+    CHECK_EQ(panel.pixel(69, 103), Color(0, 0, 255).to_16bit());
+}
+
+int main() {
+    test_window_cache();
+    return test_result("test_window");
+}
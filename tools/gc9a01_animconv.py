@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""
+@author Daniel Mironov
+@copyright Copyright (c) 2024, Daniel Mironov
+@license MIT
+@file gc9a01_animconv.py
+@brief Convert an animated GIF/PNG/WebP or a list of images into a delta-coded animation
+
+Frames are reduced to RGB565 and compared to the frame before in tiles. Changed
+tiles next to each other become rectangles, each stored as an image of
+`gc9a01_imgconv.py` (see `gc9a01_animation.h`). By default a header with one
+array is written, `--bin` writes the raw animation, e.g. for a data partition.
+
+    python3 tools/gc9a01_animconv.py boot.gif -o boot.h
+    python3 tools/gc9a01_animconv.py frames/*.png --fps 30 --bin -o face.g5an
+
+Needs Pillow (`pip install pillow`).
+"""
+
+import argparse
+import os
+import sys
+
+from PIL import Image, ImageSequence
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from gc9a01_imgconv import encode, to_rgb565  # noqa: E402
+
+
+def load_frames(paths, size):
+    """RGB565 pixels of each frame and the frame duration of the first file in ms"""
+    frames = []
+    duration = None
+    for path in paths:
+        image = Image.open(path)
+        if duration is None:
+            duration = image.info.get("duration")
+        for frame in ImageSequence.Iterator(image):
+            frame = frame.convert("RGB")
+            if size is None:
+                size = frame.size
+            if frame.size != size:
+                frame = frame.resize(size, Image.LANCZOS)
+            frames.append(to_rgb565(frame))
+    return frames, size, duration
+
+
+def changed_rects(prev, cur, width, height, tile):
+    """Rectangles covering the tiles that differ, as (x, y, w, h)"""
+    cols = (width + tile - 1) // tile
+    rows = (height + tile - 1) // tile
+    rects = []
+    # Spans of changed tiles of the rows above that may still grow downwards, (col0, col1) -> [row0, rows]
+    open_spans = {}
+    for ty in range(rows + 1):
+        spans = []
+        if ty < rows:
+            changed = [False] * cols
+            for y in range(ty * tile, min((ty + 1) * tile, height)):
+                row = y * width
+                for tx in range(cols):
+                    if not changed[tx]:
+                        x0, x1 = tx * tile, min((tx + 1) * tile, width)
+                        changed[tx] = prev[row + x0:row + x1] != cur[row + x0:row + x1]
+            tx = 0
+            while tx < cols:
+                if not changed[tx]:
+                    tx += 1
+                    continue
+                start = tx
+                # A gap of one tile costs less than the header of another rectangle
+                while tx < cols and (changed[tx] or (tx + 1 < cols and changed[tx + 1])):
+                    tx += 1
+                spans.append((start, tx))
+        grown = {}
+        for span in spans:
+            if span in open_spans:
+                grown[span] = open_spans.pop(span)
+            else:
+                grown[span] = [ty, 0]
+            grown[span][1] += 1
+        for (c0, c1), (r0, n) in open_spans.items():
+            x, y = c0 * tile, r0 * tile
+            rects.append((x, y, min(c1 * tile, width) - x, min((r0 + n) * tile, height) - y))
+        open_spans = grown
+    return rects
+
+
+def crop(pixels, width, rect):
+    x, y, w, h = rect
+    out = []
+    for row in range(y, y + h):
+        out += pixels[row * width + x:row * width + x + w]
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[1], formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("images", nargs="+", help="Animated images or single frames, in order")
+    parser.add_argument("-o", "--output", help="File to write, stdout if missing")
+    parser.add_argument("--name", help="Name of the array in C, derived from the output by default")
+    parser.add_argument("--resize", help="Scale to WxH first")
+    parser.add_argument("--fps", type=int, help="Frame rate, taken from the first image by default")
+    parser.add_argument("--tile", type=int, default=8, help="Size of the tiles frames are compared in")
+    parser.add_argument("--bin", action="store_true", help="Write the raw animation instead of a header")
+    args = parser.parse_args()
+
+    size = None
+    if args.resize:
+        size = tuple(int(v) for v in args.resize.lower().split("x"))
+    frames, (width, height), duration = load_frames(args.images, size)
+    fps = args.fps or (round(1000 / duration) if duration else 30)
+    if len(frames) > 0xFFFF or width > 0xFFFF or height > 0xFFFF or not 0 <= fps <= 0xFFFF:
+        sys.exit("Animation is too large")
+
+    body = bytearray()
+    max_frame = 0
+    prev = None
+    for pixels in frames:
+        if prev is None:
+            rects = [(0, 0, width, height)]
+        else:
+            rects = changed_rects(prev, pixels, width, height, args.tile)
+        frame = bytearray(len(rects).to_bytes(2, "big"))
+        for rect in rects:
+            image = encode(crop(pixels, width, rect), rect[2], rect[3])
+            frame += rect[0].to_bytes(2, "big") + rect[1].to_bytes(2, "big") + len(image).to_bytes(4, "big") + image
+        body += len(frame).to_bytes(4, "big") + frame
+        max_frame = max(max_frame, len(frame))
+        prev = pixels
+    data = (b"G5AN" + width.to_bytes(2, "big") + height.to_bytes(2, "big") + len(frames).to_bytes(2, "big")
+            + fps.to_bytes(2, "big") + max_frame.to_bytes(4, "big") + body)
+
+    name = args.name
+    if name is None:
+        base = (args.output or "animation").rsplit("/", 1)[-1].split(".")[0]
+        name = "".join(c if c.isalnum() else "_" for c in base)
+
+    if args.bin:
+        if not args.output:
+            sys.exit("--bin needs --output")
+        with open(args.output, "wb") as f:
+            f.write(data)
+    else:
+        out = []
+        out.append(f"// {len(frames)} frames, {width}x{height} at {fps} fps, generated by tools/gc9a01_animconv.py")
+        out.append("#pragma once")
+        out.append("")
+        out.append("#include <cstdint>")
+        out.append("")
+        out.append(f"static const uint8_t {name}[] = {{")
+        for i in range(0, len(data), 16):
+            out.append("    " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+        out.append("};")
+        text = "\n".join(out) + "\n"
+        if args.output:
+            with open(args.output, "w") as f:
+                f.write(text)
+        else:
+            sys.stdout.write(text)
+    if args.output:
+        raw = len(frames) * width * height * 2
+        print(f"{name}: {len(frames)} frames, {len(data)} bytes, {len(data) * 100 / raw:.1f} % of RGB565, "
+              f"largest frame {max_frame} bytes", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+@author Daniel Mironov
+@copyright Copyright (c) 2024, Daniel Mironov
+@license MIT
+@file gc9a01_fontconv.py
+@brief Convert a TrueType/OpenType font into a `GC9A01Font` header
+
+Each glyph is rasterized at the given pixel size, cropped to its ink and
+stored as runs of 4-bit alpha values (see `gc9a01_font.h`). `--mono`
+thresholds the glyphs instead, for crisp text on any background.
+
+    python3 tools/gc9a01_fontconv.py DejaVuSans.ttf 24 -o dejavu24.h --name dejavu24
+    python3 tools/gc9a01_fontconv.py DejaVuSans.ttf 48 --chars "0123456789.:-+ " -o digits48.h
+
+Needs Pillow (`pip install pillow`).
+"""
+
+import argparse
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+
+def rasterize(font, char, mono):
+    """Alpha values (0-15) of the ink of `char` and the position of its box"""
+    left, top, right, bottom = font.getbbox(char)
+    advance = round(font.getlength(char))
+    width, height = right - left, bottom - top
+    if width <= 0 or height <= 0:
+        return advance, 0, 0, 0, 0, []
+    image = Image.new("L", (width, height), 0)
+    ImageDraw.Draw(image).text((-left, -top), char, font=font, fill=255)
+    pixels = image.tobytes()
+    if mono:
+        alpha = [15 if p >= 128 else 0 for p in pixels]
+    else:
+        alpha = [(p * 15 + 127) // 255 for p in pixels]
+    return advance, left, top, width, height, alpha
+
+
+def encode_runs(alpha):
+    """One byte per run: alpha in the upper nibble, length minus one in the lower"""
+    runs = []
+    i = 0
+    while i < len(alpha):
+        n = 1
+        while i + n < len(alpha) and alpha[i + n] == alpha[i] and n < 16:
+            n += 1
+        runs.append((alpha[i] << 4) | (n - 1))
+        i += n
+    return runs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[1], formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("font", help="TrueType/OpenType file")
+    parser.add_argument("size", type=int, help="Pixel size")
+    parser.add_argument("-o", "--output", help="Header to write, stdout if missing")
+    parser.add_argument("--name", help="Name of the font in C, derived from the output by default")
+    parser.add_argument("--first", type=lambda v: int(v, 0), default=0x20, help="First character code")
+    parser.add_argument("--last", type=lambda v: int(v, 0), default=0x7E, help="Last character code")
+    parser.add_argument("--chars", help="Only these characters, instead of --first to --last")
+    parser.add_argument("--mono", action="store_true", help="No anti-aliasing")
+    args = parser.parse_args()
+
+    name = args.name
+    if name is None:
+        base = (args.output or "font").rsplit("/", 1)[-1].split(".")[0]
+        name = "".join(c if c.isalnum() else "_" for c in base)
+    if not 0 <= args.first <= args.last <= 0xFF:
+        sys.exit("--first and --last have to be in 0..255")
+    first, last = args.first, args.last
+    if args.chars:
+        codes = [ord(c) for c in args.chars]
+        if max(codes) > 0xFF:
+            sys.exit("--chars has to be 8-bit characters")
+        first, last = min(codes), max(codes)
+
+    font = ImageFont.truetype(args.font, args.size)
+    ascent, descent = font.getmetrics()
+
+    runs = []
+    glyphs = []
+    for code in range(first, last + 1):
+        char = chr(code)
+        if args.chars and char not in args.chars:
+            glyphs.append((len(runs), 0, 0, 0, 0, 0, char))
+            continue
+        advance, left, top, width, height, alpha = rasterize(font, char, args.mono)
+        if width > 255 or height > 255 or advance > 255 or not -128 <= left <= 127 or not -128 <= top <= 127:
+            sys.exit(f"Glyph {char!r} is too large")
+        glyphs.append((len(runs), width, height, advance, left, top, char))
+        runs += encode_runs(alpha)
+
+    out = []
+    out.append(f"// {args.font} at {args.size} px, generated by tools/gc9a01_fontconv.py")
+    out.append("#pragma once")
+    out.append("")
+    out.append('#include "gc9a01_font.h"')
+    out.append("")
+    out.append(f"static const uint8_t {name}_runs[] = {{")
+    for i in range(0, len(runs), 16):
+        out.append("    " + ", ".join(f"0x{r:02X}" for r in runs[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+    out.append(f"static const GC9A01Glyph {name}_glyphs[] = {{")
+    for offset, width, height, advance, left, top, char in glyphs:
+        label = char if char.isprintable() and char not in "\\" else f"0x{ord(char):02X}"
+        out.append(f"    {{{offset}, {width}, {height}, {advance}, {left}, {top}}},  // {label}")
+    out.append("};")
+    out.append("")
+    out.append(f"static const GC9A01Font {name} = {{")
+    out.append(f"    {name}_runs, {name}_glyphs, {first}, {last}, {ascent + descent}, {ascent}")
+    out.append("};")
+    text = "\n".join(out) + "\n"
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+        print(f"{name}: {last - first + 1} glyphs, {len(runs)} bytes of runs", file=sys.stderr)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
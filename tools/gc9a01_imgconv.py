@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""
+@author Daniel Mironov
+@copyright Copyright (c) 2024, Daniel Mironov
+@license MIT
+@file gc9a01_imgconv.py
+@brief Convert an image into the compressed RGB565 format of `draw_image()`
+
+The image is reduced to RGB565 and encoded as described in `gc9a01_image.h`.
+By default a header with one array is written, `--bin` writes the raw image,
+e.g. for an asset partition that is memory-mapped at runtime.
+
+    python3 tools/gc9a01_imgconv.py logo.png -o logo.h
+    python3 tools/gc9a01_imgconv.py background.png --resize 240x240 --bin -o background.g565
+
+Needs Pillow (`pip install pillow`).
+"""
+
+import argparse
+import sys
+
+from PIL import Image
+
+MAX_RUN = 63 + 0xFFFF
+
+
+def to_rgb565(image):
+    """RGB565 values of the pixels, row after row"""
+    data = image.convert("RGB").tobytes()
+    pixels = []
+    for i in range(0, len(data), 3):
+        r, g, b = data[i:i + 3]
+        pixels.append((((r * 31 + 127) // 255) << 11) | (((g * 63 + 127) // 255) << 5) | ((b * 31 + 127) // 255))
+    return pixels
+
+
+def channels(px):
+    return px >> 11, (px >> 5) & 0x3F, px & 0x1F
+
+
+def wrap(value, bits):
+    """Difference between two channel values, wrapped into -2^(bits-1)..2^(bits-1)-1"""
+    half = 1 << (bits - 1)
+    return (value + half) % (1 << bits) - half
+
+
+def image_hash(px):
+    r, g, b = channels(px)
+    return (r * 3 + g * 5 + b * 7) % 64
+
+
+def encode_run(out, n):
+    while n > 0:
+        k = min(n, MAX_RUN)
+        if k < 63:
+            out.append(0xC0 + k - 1)
+        else:
+            out += [0xFF, (k - 63) >> 8, (k - 63) & 0xFF]
+        n -= k
+
+
+def encode(pixels, width, height):
+    out = [ord("G"), ord("5"), ord("6"), ord("5"), width >> 8, width & 0xFF, height >> 8, height & 0xFF]
+    index = [0] * 64
+    prev = 0
+    run = 0
+    for px in pixels:
+        if px == prev:
+            run += 1
+            continue
+        encode_run(out, run)
+        run = 0
+
+        h = image_hash(px)
+        r, g, b = channels(px)
+        pr, pg, pb = channels(prev)
+        dr, dg, db = wrap(r - pr, 5), wrap(g - pg, 6), wrap(b - pb, 5)
+        if index[h] == px:
+            out.append(h)
+        elif -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+            out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+        elif -32 <= dg <= 31 and -8 <= wrap(dr - dg, 5) <= 7 and -8 <= wrap(db - dg, 5) <= 7:
+            out += [0x80 | (dg + 32), ((wrap(dr - dg, 5) + 8) << 4) | (wrap(db - dg, 5) + 8)]
+        else:
+            out += [0xFE, px >> 8, px & 0xFF]
+        index[h] = px
+        prev = px
+    encode_run(out, run)
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[1], formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("image", help="Any image Pillow reads, transparency is dropped")
+    parser.add_argument("-o", "--output", help="File to write, stdout if missing")
+    parser.add_argument("--name", help="Name of the array in C, derived from the output by default")
+    parser.add_argument("--resize", help="Scale to WxH first")
+    parser.add_argument("--bin", action="store_true", help="Write the raw image instead of a header")
+    args = parser.parse_args()
+
+    image = Image.open(args.image)
+    if args.resize:
+        width, height = (int(v) for v in args.resize.lower().split("x"))
+        image = image.resize((width, height), Image.LANCZOS)
+    width, height = image.size
+    if width > 0xFFFF or height > 0xFFFF:
+        sys.exit("Image is too large")
+    data = encode(to_rgb565(image), width, height)
+
+    name = args.name
+    if name is None:
+        base = (args.output or "image").rsplit("/", 1)[-1].split(".")[0]
+        name = "".join(c if c.isalnum() else "_" for c in base)
+
+    if args.bin:
+        if not args.output:
+            sys.exit("--bin needs --output")
+        with open(args.output, "wb") as f:
+            f.write(data)
+    else:
+        out = []
+        out.append(f"// {args.image}, {width}x{height}, generated by tools/gc9a01_imgconv.py")
+        out.append("#pragma once")
+        out.append("")
+        out.append("#include <cstdint>")
+        out.append("")
+        out.append(f"static const uint8_t {name}[] = {{")
+        for i in range(0, len(data), 16):
+            out.append("    " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+        out.append("};")
+        text = "\n".join(out) + "\n"
+        if args.output:
+            with open(args.output, "w") as f:
+                f.write(text)
+        else:
+            sys.stdout.write(text)
+    if args.output:
+        print(f"{name}: {width}x{height}, {len(data)} bytes, {len(data) * 100 / (width * height * 2):.1f} % of RGB565",
+              file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()